@@ -0,0 +1,81 @@
+//----------------------------------------------------------------------------------------------------------------------
+//	CDataBenchmark.cpp			©2026 Stevo Brock	All rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+//	Times CData base64 encoding and decoding and hex encoding, reported as throughput of input bytes.  Only public
+//		API is used, so the same file builds against older trees for before and after numbers.  See SBenchmark.h for
+//		how to build.
+//----------------------------------------------------------------------------------------------------------------------
+
+#include "CDictionary.h"
+#include "SBenchmark.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: Local proc definitions
+
+//----------------------------------------------------------------------------------------------------------------------
+static void sRun(UInt32 byteCount, UInt32 repeatCount)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Setup
+	UInt8*	bytes = (UInt8*) ::malloc(byteCount);
+	for (UInt32 i = 0; i < byteCount; i++)
+		// Fill with a pattern that covers every byte value
+		bytes[i] = (UInt8) ((i * 131) ^ (i >> 3));
+	CData	data(bytes, byteCount);
+	::free(bytes);
+
+	CString	base64String = data.getBase64String();
+	UInt64	totalByteCount = (UInt64) byteCount * repeatCount;
+	UInt64	sum = 0;
+	char	name[64];
+
+	// Base64 encode
+	Float64	startTime = SBenchmark::getTime();
+	UInt64	startAllocationsCount = SBenchmark::getAllocationsCount();
+	for (UInt32 r = 0; r < repeatCount; r++)
+		// Encode
+		sum += data.getBase64String().getLength();
+	::snprintf(name, sizeof(name), "base64 encode, %u bytes", byteCount);
+	SBenchmark::reportThroughput(name, totalByteCount, repeatCount, startTime, startAllocationsCount);
+
+	// Base64 decode
+	startTime = SBenchmark::getTime();
+	startAllocationsCount = SBenchmark::getAllocationsCount();
+	for (UInt32 r = 0; r < repeatCount; r++)
+		// Decode
+		sum += CData::fromBase64String(base64String).getByteCount();
+	::snprintf(name, sizeof(name), "base64 decode, %u bytes", byteCount);
+	SBenchmark::reportThroughput(name, totalByteCount, repeatCount, startTime, startAllocationsCount);
+
+	// Hex encode
+	startTime = SBenchmark::getTime();
+	startAllocationsCount = SBenchmark::getAllocationsCount();
+	for (UInt32 r = 0; r < repeatCount; r++)
+		// Encode
+		sum += data.getHexString().getLength();
+	::snprintf(name, sizeof(name), "hex encode, %u bytes", byteCount);
+	SBenchmark::reportThroughput(name, totalByteCount, repeatCount, startTime, startAllocationsCount);
+
+	// Keep the result alive
+	if (sum == 0)
+		// Unexpected
+		::printf("no work done\n");
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - Main
+
+//----------------------------------------------------------------------------------------------------------------------
+int main()
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Run
+	sRun(64, 200000);
+	sRun(4096, 4000);
+	sRun(1024 * 1024, 20);
+
+	return 0;
+}
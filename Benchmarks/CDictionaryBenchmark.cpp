@@ -0,0 +1,100 @@
+//----------------------------------------------------------------------------------------------------------------------
+//	CDictionaryBenchmark.cpp			©2026 Stevo Brock	All rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+//	Times CDictionary set, lookup, iteration and remove for dictionaries of 10 to 1M keys.  Only public API is used, so
+//		the same file builds against older backings, but only in trees that have a CString backend for the platform.
+//		On Linux that means the chained backing has to be built into a later tree to get before numbers.  See
+//		SBenchmark.h for how to build.
+//----------------------------------------------------------------------------------------------------------------------
+
+#include "CDictionary.h"
+#include "SBenchmark.h"
+
+#include <stdio.h>
+
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: Local proc definitions
+
+//----------------------------------------------------------------------------------------------------------------------
+static void sRun(UInt32 keysCount, UInt32 repeatCount)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Setup
+	TNArray<CString>	keys;
+	for (UInt32 i = 0; i < keysCount; i++)
+		// Add key
+		keys += CString(OSSTR("key")) + CString(i);
+
+	CString	label = CString(keysCount) + CString(OSSTR(" keys"));
+	char	name[64];
+	UInt64	sum = 0;
+
+	// Set
+	Float64	startTime = SBenchmark::getTime();
+	UInt64	startAllocationsCount = SBenchmark::getAllocationsCount();
+	for (UInt32 r = 0; r < repeatCount; r++) {
+		// Fill a new dictionary
+		CDictionary	dictionary;
+		for (UInt32 i = 0; i < keysCount; i++)
+			// Set
+			dictionary.set(keys[i], i);
+		sum += dictionary.getCount();
+	}
+	::snprintf(name, sizeof(name), "set, %s", *label.getUTF8Chars());
+	SBenchmark::report(name, (UInt64) keysCount * repeatCount, startTime, startAllocationsCount);
+
+	// Lookup
+	CDictionary	dictionary;
+	for (UInt32 i = 0; i < keysCount; i++)
+		// Set
+		dictionary.set(keys[i], i);
+
+	startTime = SBenchmark::getTime();
+	startAllocationsCount = SBenchmark::getAllocationsCount();
+	for (UInt32 r = 0; r < repeatCount; r++)
+		for (UInt32 i = 0; i < keysCount; i++)
+			// Lookup
+			sum += dictionary.getUInt32(keys[i]);
+	::snprintf(name, sizeof(name), "lookup, %s", *label.getUTF8Chars());
+	SBenchmark::report(name, (UInt64) keysCount * repeatCount, startTime, startAllocationsCount);
+
+	// Iterate
+	startTime = SBenchmark::getTime();
+	startAllocationsCount = SBenchmark::getAllocationsCount();
+	for (UInt32 r = 0; r < repeatCount; r++)
+		for (CDictionary::Iterator iterator = dictionary.getIterator(); iterator; iterator++)
+			// Add value
+			sum += iterator.getValue().getUInt32();
+	::snprintf(name, sizeof(name), "iterate, %s", *label.getUTF8Chars());
+	SBenchmark::report(name, (UInt64) keysCount * repeatCount, startTime, startAllocationsCount);
+
+	// Remove
+	startTime = SBenchmark::getTime();
+	startAllocationsCount = SBenchmark::getAllocationsCount();
+	for (UInt32 i = 0; i < keysCount; i++)
+		// Remove
+		dictionary.remove(keys[i]);
+	::snprintf(name, sizeof(name), "remove, %s", *label.getUTF8Chars());
+	SBenchmark::report(name, keysCount, startTime, startAllocationsCount);
+
+	// Keep the result alive
+	if (sum == 0)
+		// Unexpected
+		::printf("no work done\n");
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - Main
+
+//----------------------------------------------------------------------------------------------------------------------
+int main()
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Run
+	sRun(10, 100000);
+	sRun(1000, 1000);
+	sRun(100000, 10);
+	sRun(1000000, 1);
+
+	return 0;
+}
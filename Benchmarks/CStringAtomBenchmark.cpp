@@ -0,0 +1,140 @@
+//----------------------------------------------------------------------------------------------------------------------
+//	CStringAtomBenchmark.cpp			©2026 Stevo Brock	All rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+//	Times CDictionary lookups by CString vs by CString::Atom, and interning and finding atoms.  Then parses and
+//		serializes JSON whose records all repeat the same keys, and reads the parsed records by string and by atom.
+//		Also build and include Source/Storage.  See SBenchmark.h for how to build.
+//----------------------------------------------------------------------------------------------------------------------
+
+#include "CJSON.h"
+#include "SBenchmark.h"
+
+#include <stdio.h>
+
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: Local data
+
+static	const	UInt32	kKeysCount = 200;
+static	const	UInt32	kRepeatCount = 20000;
+
+static	const	UInt32	kRecordKeysCount = 8;
+static	const	UInt32	kRecordsCount = 2000;
+static	const	UInt32	kRecordsRepeatCount = 20;
+
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - Main
+
+//----------------------------------------------------------------------------------------------------------------------
+int main()
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Setup.  Keys are longer than the inline string limit, like typical column and notification names.
+	TNArray<CString>		keys;
+	TNArray<CString::Atom>	atoms;
+	CDictionary				dictionary;
+	for (UInt32 i = 0; i < kKeysCount; i++) {
+		// Add key
+		keys += CString(OSSTR("column_name_number_")) + CString(i);
+		atoms += CString::Atom(keys[i]);
+		dictionary.set(atoms[i], SValue(i));
+	}
+
+	UInt64	sum = 0;
+
+	// Lookup by string
+	Float64	startTime = SBenchmark::getTime();
+	UInt64	startAllocationsCount = SBenchmark::getAllocationsCount();
+	for (UInt32 r = 0; r < kRepeatCount; r++)
+		for (UInt32 i = 0; i < kKeysCount; i++)
+			// Lookup
+			sum += dictionary[keys[i]]->getUInt32();
+	SBenchmark::report("lookup by string, 200 keys", (UInt64) kKeysCount * kRepeatCount, startTime,
+			startAllocationsCount);
+
+	// Lookup by atom
+	startTime = SBenchmark::getTime();
+	startAllocationsCount = SBenchmark::getAllocationsCount();
+	for (UInt32 r = 0; r < kRepeatCount; r++)
+		for (UInt32 i = 0; i < kKeysCount; i++)
+			// Lookup
+			sum += dictionary[atoms[i]]->getUInt32();
+	SBenchmark::report("lookup by atom, 200 keys", (UInt64) kKeysCount * kRepeatCount, startTime,
+			startAllocationsCount);
+
+	// Intern existing
+	startTime = SBenchmark::getTime();
+	startAllocationsCount = SBenchmark::getAllocationsCount();
+	for (UInt32 r = 0; r < kRepeatCount; r++)
+		for (UInt32 i = 0; i < kKeysCount; i++)
+			// Intern
+			sum += (CString::Atom(keys[i]) == atoms[i]) ? 1 : 0;
+	SBenchmark::report("intern existing atom", (UInt64) kKeysCount * kRepeatCount, startTime, startAllocationsCount);
+
+	// Find missing
+	CString	missingKey(OSSTR("column_name_that_was_never_interned"));
+	startTime = SBenchmark::getTime();
+	startAllocationsCount = SBenchmark::getAllocationsCount();
+	for (UInt32 r = 0; r < kRepeatCount * kKeysCount; r++)
+		// Find
+		sum += CString::Atom::find(missingKey).hasValue() ? 1 : 0;
+	SBenchmark::report("find missing atom", (UInt64) kKeysCount * kRepeatCount, startTime, startAllocationsCount);
+
+	// Setup records.  Every record has the same keys, like rows of a table.
+	TNArray<CDictionary>	records;
+	for (UInt32 i = 0; i < kRecordsCount; i++) {
+		// Setup record
+		CDictionary	record;
+		for (UInt32 j = 0; j < kRecordKeysCount; j++)
+			// Set value
+			record.set(keys[j], SValue(i + j));
+		records += record;
+	}
+	CData	jsonData = *CJSON::dataFrom(records);
+	UInt64	recordsOperationsCount = (UInt64) kRecordsCount * kRecordsRepeatCount;
+
+	// Parse
+	startTime = SBenchmark::getTime();
+	startAllocationsCount = SBenchmark::getAllocationsCount();
+	for (UInt32 r = 0; r < kRecordsRepeatCount; r++)
+		// Parse
+		sum += CJSON::arrayOfDictionariesFrom(jsonData)->getCount();
+	SBenchmark::report("JSON parse, per record", recordsOperationsCount, startTime, startAllocationsCount);
+
+	// Serialize
+	TArray<CDictionary>	parsedRecords = *CJSON::arrayOfDictionariesFrom(jsonData);
+	startTime = SBenchmark::getTime();
+	startAllocationsCount = SBenchmark::getAllocationsCount();
+	for (UInt32 r = 0; r < kRecordsRepeatCount; r++)
+		// Serialize
+		sum += CJSON::dataFrom(parsedRecords)->getByteCount();
+	SBenchmark::report("JSON serialize, per record", recordsOperationsCount, startTime, startAllocationsCount);
+
+	// Read parsed by string
+	startTime = SBenchmark::getTime();
+	startAllocationsCount = SBenchmark::getAllocationsCount();
+	for (UInt32 r = 0; r < kRecordsRepeatCount; r++)
+		for (TArray<CDictionary>::Iterator iterator = parsedRecords.getIterator(); iterator; iterator++)
+			for (UInt32 j = 0; j < kRecordKeysCount; j++)
+				// Lookup
+				sum += (*iterator)[keys[j]]->getUInt32();
+	SBenchmark::report("JSON record read by string, per record", recordsOperationsCount, startTime,
+			startAllocationsCount);
+
+	// Read parsed by atom
+	startTime = SBenchmark::getTime();
+	startAllocationsCount = SBenchmark::getAllocationsCount();
+	for (UInt32 r = 0; r < kRecordsRepeatCount; r++)
+		for (TArray<CDictionary>::Iterator iterator = parsedRecords.getIterator(); iterator; iterator++)
+			for (UInt32 j = 0; j < kRecordKeysCount; j++)
+				// Lookup
+				sum += (*iterator)[atoms[j]]->getUInt32();
+	SBenchmark::report("JSON record read by atom, per record", recordsOperationsCount, startTime,
+			startAllocationsCount);
+
+	// Keep the result alive
+	if (sum == 0)
+		// Unexpected
+		::printf("no work done\n");
+
+	return 0;
+}
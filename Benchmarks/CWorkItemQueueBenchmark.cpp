@@ -0,0 +1,223 @@
+//----------------------------------------------------------------------------------------------------------------------
+//	CWorkItemQueueBenchmark.cpp			©2026 Stevo Brock	All rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+//	Times CWorkItemQueue dispatch.  A tree of work item queues, each limited to 4 concurrent work items, is paused
+//		and filled at its leaves with empty work items of mixed priority, then resumed and waited on.  Flat adds from
+//		the main thread and a binary fan out of work items adding work items are timed too, as is add() against
+//		submit() for 10M empty work items in batches of 100k.  Pass "workStealing" to run in the work-stealing scheduler
+//		mode.  See SBenchmark.h for how to build.
+//----------------------------------------------------------------------------------------------------------------------
+
+#include "CWorkItemQueue.h"
+#include "SBenchmark.h"
+
+#include <stdio.h>
+#include <string.h>
+
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: Local data
+
+static	CWorkItemQueue*	sFanOutWorkItemQueue = nil;
+
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - Local proc definitions
+
+//----------------------------------------------------------------------------------------------------------------------
+static void sEmptyWorkItemProc(const I<CWorkItem>& workItem, void* userData)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Unused
+	(void) workItem;
+	(void) userData;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+static void sEmptySubmitProc(void* userData)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Unused
+	(void) userData;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+static void sFanOutWorkItemProc(const I<CWorkItem>& workItem, void* userData)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Unused
+	(void) workItem;
+
+	// Check depth
+	UInt32	depth = (UInt32) (intptr_t) userData;
+	if (depth > 0) {
+		// Add 2 more
+		sFanOutWorkItemQueue->add(sFanOutWorkItemProc, (void*) (intptr_t) (depth - 1));
+		sFanOutWorkItemQueue->add(sFanOutWorkItemProc, (void*) (intptr_t) (depth - 1));
+	}
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+static void sAddWorkItemQueues(CWorkItemQueue& workItemQueue, UInt32 depth, UInt32 fanOut,
+		TNArray<I<CWorkItemQueue> >& workItemQueues, TNArray<R<CWorkItemQueue> >& leafWorkItemQueues)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Iterate fan out
+	for (UInt32 i = 0; i < fanOut; i++) {
+		// Add child
+		I<CWorkItemQueue>	childWorkItemQueue(new CWorkItemQueue(workItemQueue, OR<CItemsProgress>(), 4));
+		workItemQueues += childWorkItemQueue;
+
+		// Check depth
+		if (depth > 1)
+			// Add children
+			sAddWorkItemQueues(*childWorkItemQueue, depth - 1, fanOut, workItemQueues, leafWorkItemQueues);
+		else
+			// Leaf
+			leafWorkItemQueues += R<CWorkItemQueue>(*childWorkItemQueue);
+	}
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+static void sRunDispatch(UInt32 depth, UInt32 fanOut, UInt32 workItemsCount)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Setup
+	TNArray<I<CWorkItemQueue> >	workItemQueues;
+	TNArray<R<CWorkItemQueue> >	leafWorkItemQueues;
+	sAddWorkItemQueues(CWorkItemQueue::main(), depth, fanOut, workItemQueues, leafWorkItemQueues);
+
+	// Pause leaves and fill
+	for (TArray<R<CWorkItemQueue> >::Iterator iterator = leafWorkItemQueues.getIterator(); iterator; iterator++)
+		// Pause
+		(*iterator)->pause();
+	for (UInt32 i = 0; i < workItemsCount; i++)
+		// Add
+		leafWorkItemQueues[i % leafWorkItemQueues.getCount()]->add(sEmptyWorkItemProc, nil, OV<CString>(),
+				(CWorkItem::Priority) ((i * 7) % 3));
+
+	// Resume and wait
+	Float64	startTime = SBenchmark::getTime();
+	UInt64	startAllocationsCount = SBenchmark::getAllocationsCount();
+	for (TArray<R<CWorkItemQueue> >::Iterator iterator = leafWorkItemQueues.getIterator(); iterator; iterator++)
+		// Resume
+		(*iterator)->resume();
+	for (TArray<R<CWorkItemQueue> >::Iterator iterator = leafWorkItemQueues.getIterator(); iterator; iterator++)
+		// Wait
+		(*iterator)->wait();
+
+	// Report
+	char	name[64];
+	::snprintf(name, sizeof(name), "dispatch, depth %u x fan out %u, %u items", depth, fanOut, workItemsCount);
+	SBenchmark::report(name, workItemsCount, startTime, startAllocationsCount);
+
+	// Cleanup.  Children must go before the work item queues they target.
+	leafWorkItemQueues.removeAll();
+	while (!workItemQueues.isEmpty())
+		// Remove last
+		workItemQueues.removeAtIndex(workItemQueues.getCount() - 1);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+static void sRunFlat(UInt32 workItemsCount)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Add
+	CWorkItemQueue	workItemQueue(CWorkItemQueue::main());
+	Float64			startTime = SBenchmark::getTime();
+	UInt64			startAllocationsCount = SBenchmark::getAllocationsCount();
+	for (UInt32 i = 0; i < workItemsCount; i++)
+		// Add
+		workItemQueue.add(sEmptyWorkItemProc, nil, OV<CString>(), (CWorkItem::Priority) (i % 3));
+
+	// Wait
+	workItemQueue.wait();
+
+	// Report
+	char	name[64];
+	::snprintf(name, sizeof(name), "flat add and wait, %u items", workItemsCount);
+	SBenchmark::report(name, workItemsCount, startTime, startAllocationsCount);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+static void sRunFanOut(UInt32 depth)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Add the first and wait for all
+	CWorkItemQueue	workItemQueue(CWorkItemQueue::main());
+	sFanOutWorkItemQueue = &workItemQueue;
+	Float64			startTime = SBenchmark::getTime();
+	UInt64			startAllocationsCount = SBenchmark::getAllocationsCount();
+	workItemQueue.add(sFanOutWorkItemProc, (void*) (intptr_t) depth);
+	workItemQueue.wait();
+	sFanOutWorkItemQueue = nil;
+
+	// Report
+	UInt32	workItemsCount = (2 << depth) - 1;
+	char	name[64];
+	::snprintf(name, sizeof(name), "fan out from work items, %u items", workItemsCount);
+	SBenchmark::report(name, workItemsCount, startTime, startAllocationsCount);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+static void sRunBatches(bool useSubmit, UInt32 workItemsCount, UInt32 batchWorkItemsCount)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Setup
+	CWorkItemQueue	workItemQueue(CWorkItemQueue::main());
+	Float64			addTime = 0.0;
+	UInt64			addAllocationsCount = 0;
+
+	// Add and wait in batches
+	Float64	startTime = SBenchmark::getTime();
+	UInt64	startAllocationsCount = SBenchmark::getAllocationsCount();
+	for (UInt32 i = 0; i < workItemsCount; i += batchWorkItemsCount) {
+		// Add batch
+		Float64	batchStartTime = SBenchmark::getTime();
+		UInt64	batchStartAllocationsCount = SBenchmark::getAllocationsCount();
+		if (useSubmit)
+			// Submit
+			for (UInt32 j = 0; j < batchWorkItemsCount; j++)
+				// Submit
+				workItemQueue.submit(sEmptySubmitProc, nil);
+		else
+			// Add
+			for (UInt32 j = 0; j < batchWorkItemsCount; j++)
+				// Add
+				workItemQueue.add(sEmptyWorkItemProc, nil);
+		addTime += SBenchmark::getTime() - batchStartTime;
+		addAllocationsCount += SBenchmark::getAllocationsCount() - batchStartAllocationsCount;
+
+		// Wait
+		workItemQueue.wait();
+	}
+
+	// Report
+	char	name[64];
+	::snprintf(name, sizeof(name), "%s, %u items", useSubmit ? "submit()" : "add()", workItemsCount);
+	SBenchmark::reportTotals(name, workItemsCount, addTime, addAllocationsCount);
+	::snprintf(name, sizeof(name), "%s and wait, %u items", useSubmit ? "submit()" : "add()", workItemsCount);
+	SBenchmark::report(name, workItemsCount, startTime, startAllocationsCount);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - Main
+
+//----------------------------------------------------------------------------------------------------------------------
+int main(int argc, const char* argv[])
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Check scheduler mode
+	if ((argc > 1) && (::strcmp(argv[1], "workStealing") == 0))
+		// Work-stealing
+		CWorkItemQueue::setSchedulerMode(CWorkItemQueue::kSchedulerModeWorkStealing);
+
+	// Run
+	sRunDispatch(1, 1, 20000);
+	sRunDispatch(3, 4, 20000);
+	sRunDispatch(4, 4, 50000);
+	sRunFlat(200000);
+	sRunFanOut(17);
+	sRunBatches(false, 10000000, 100000);
+	sRunBatches(true, 10000000, 100000);
+
+	return 0;
+}
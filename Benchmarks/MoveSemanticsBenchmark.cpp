@@ -0,0 +1,241 @@
+//----------------------------------------------------------------------------------------------------------------------
+//	MoveSemanticsBenchmark.cpp			©2026 Stevo Brock	All rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+//	Times handing freshly made values to TNArray and CDictionary by copy and by move.  Each pair does the same work
+//		except for how the value is passed, so the difference is the cost of the copy.  Then times reading one fixed
+//		document with CJSON and CBinaryPropertyList, which hand every parsed value up to its container.
+//	Also build Source/Storage, Source/Sources and Source/Files with the platform file Add On sources, and put those
+//		folders on the include path.  Define REFERENCE_COUNT_STATISTICS to also print the reference count increments
+//		per operation.  See SBenchmark.h for how to build.
+//----------------------------------------------------------------------------------------------------------------------
+
+#include "CBinaryPropertyList.h"
+#include "CJSON.h"
+#include "SBenchmark.h"
+
+#include <stdio.h>
+
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: Local data
+
+static	const	UInt32	kItemsCount = 1000;
+static	const	UInt32	kRepeatCount = 1000;
+
+static	const	UInt32	kDocumentRecordsCount = 200;
+static	const	UInt32	kDocumentRepeatCount = 200;
+
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - Local proc declarations
+
+static	CDictionary	sMakeDocument();
+static	void		sReportReferenceAdds(const char* name, UInt64 operationsCount, UInt64 startReferenceAddsCount);
+static	UInt64		sGetReferenceAddsCount();
+
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - Main
+
+//----------------------------------------------------------------------------------------------------------------------
+int main()
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Setup.  Strings are longer than the inline string limit so copies share storage.
+	TNArray<CString>	strings;
+	for (UInt32 i = 0; i < kItemsCount; i++)
+		// Add string
+		strings += CString(OSSTR("a string longer than the inline limit ")) + CString(i);
+
+	UInt64	operationsCount = (UInt64) kItemsCount * kRepeatCount;
+	UInt64	sum = 0;
+
+	// Array add, copy
+	Float64	startTime = SBenchmark::getTime();
+	UInt64	startAllocationsCount = SBenchmark::getAllocationsCount();
+	for (UInt32 r = 0; r < kRepeatCount; r++) {
+		// Fill array
+		TNArray<CString>	array;
+		for (UInt32 i = 0; i < kItemsCount; i++) {
+			// Add
+			CString	string(strings[i]);
+			array += string;
+		}
+		sum += array.getCount();
+	}
+	SBenchmark::report("TNArray<CString> add, copy", operationsCount, startTime, startAllocationsCount);
+
+	// Array add, move
+	startTime = SBenchmark::getTime();
+	startAllocationsCount = SBenchmark::getAllocationsCount();
+	for (UInt32 r = 0; r < kRepeatCount; r++) {
+		// Fill array
+		TNArray<CString>	array;
+		for (UInt32 i = 0; i < kItemsCount; i++) {
+			// Add
+			CString	string(strings[i]);
+			array += std::move(string);
+		}
+		sum += array.getCount();
+	}
+	SBenchmark::report("TNArray<CString> add, move", operationsCount, startTime, startAllocationsCount);
+
+	// Dictionary set, copy
+	startTime = SBenchmark::getTime();
+	startAllocationsCount = SBenchmark::getAllocationsCount();
+	for (UInt32 r = 0; r < kRepeatCount; r++) {
+		// Fill dictionary
+		CDictionary	dictionary;
+		for (UInt32 i = 0; i < kItemsCount; i++) {
+			// Set
+			CString	string(strings[i]);
+			dictionary.set(strings[i], string);
+		}
+		sum += dictionary.getCount();
+	}
+	SBenchmark::report("CDictionary set CString, copy", operationsCount, startTime, startAllocationsCount);
+
+	// Dictionary set, move
+	startTime = SBenchmark::getTime();
+	startAllocationsCount = SBenchmark::getAllocationsCount();
+	for (UInt32 r = 0; r < kRepeatCount; r++) {
+		// Fill dictionary
+		CDictionary	dictionary;
+		for (UInt32 i = 0; i < kItemsCount; i++) {
+			// Set
+			CString	string(strings[i]);
+			dictionary.set(strings[i], std::move(string));
+		}
+		sum += dictionary.getCount();
+	}
+	SBenchmark::report("CDictionary set CString, move", operationsCount, startTime, startAllocationsCount);
+
+	// Nested dictionary, copy
+	startTime = SBenchmark::getTime();
+	startAllocationsCount = SBenchmark::getAllocationsCount();
+	for (UInt32 r = 0; r < kRepeatCount; r++) {
+		// Fill dictionary
+		CDictionary	dictionary;
+		for (UInt32 i = 0; i < kItemsCount; i++) {
+			// Set
+			CDictionary	inner;
+			inner.set(strings[i], i);
+			dictionary.set(strings[i], inner);
+		}
+		sum += dictionary.getCount();
+	}
+	SBenchmark::report("CDictionary set CDictionary, copy", operationsCount, startTime, startAllocationsCount);
+
+	// Nested dictionary, move
+	startTime = SBenchmark::getTime();
+	startAllocationsCount = SBenchmark::getAllocationsCount();
+	for (UInt32 r = 0; r < kRepeatCount; r++) {
+		// Fill dictionary
+		CDictionary	dictionary;
+		for (UInt32 i = 0; i < kItemsCount; i++) {
+			// Set
+			CDictionary	inner;
+			inner.set(strings[i], i);
+			dictionary.set(strings[i], std::move(inner));
+		}
+		sum += dictionary.getCount();
+	}
+	SBenchmark::report("CDictionary set CDictionary, move", operationsCount, startTime, startAllocationsCount);
+
+	// Setup document
+	CDictionary	document = sMakeDocument();
+	CData		jsonData = *CJSON::dataFrom(document);
+	CData		binaryPropertyListData = *CBinaryPropertyList::dataFrom(document);
+
+	// JSON dictionaryFrom
+	startTime = SBenchmark::getTime();
+	startAllocationsCount = SBenchmark::getAllocationsCount();
+	UInt64	startReferenceAddsCount = sGetReferenceAddsCount();
+	for (UInt32 r = 0; r < kDocumentRepeatCount; r++)
+		// Read
+		sum += CJSON::dictionaryFrom(jsonData)->getCount();
+	SBenchmark::report("CJSON dictionaryFrom", kDocumentRepeatCount, startTime, startAllocationsCount);
+	sReportReferenceAdds("CJSON dictionaryFrom", kDocumentRepeatCount, startReferenceAddsCount);
+
+	// Binary property list dictionaryFrom.  Composing a standard dictionary reads every value up front like CJSON does.
+	startTime = SBenchmark::getTime();
+	startAllocationsCount = SBenchmark::getAllocationsCount();
+	startReferenceAddsCount = sGetReferenceAddsCount();
+	for (UInt32 r = 0; r < kDocumentRepeatCount; r++) {
+		// Read
+		I<CRandomAccessDataSource>	randomAccessDataSource(new CDataDataSource(binaryPropertyListData));
+		sum += CBinaryPropertyList::dictionaryFrom(randomAccessDataSource, true)->getCount();
+	}
+	SBenchmark::report("CBinaryPropertyList dictionaryFrom", kDocumentRepeatCount, startTime,
+			startAllocationsCount);
+	sReportReferenceAdds("CBinaryPropertyList dictionaryFrom", kDocumentRepeatCount, startReferenceAddsCount);
+
+	// Keep the result alive
+	if (sum == 0)
+		// Unexpected
+		::printf("no work done\n");
+
+	return 0;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - Local proc definitions
+
+//----------------------------------------------------------------------------------------------------------------------
+CDictionary sMakeDocument()
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Setup.  Strings are longer than the inline string limit so copies share storage.
+	CDictionary	document;
+	for (UInt32 i = 0; i < kDocumentRecordsCount; i++) {
+		// Setup metadata
+		CDictionary	metadata;
+		metadata.set(CString(OSSTR("owner")),
+				CString(OSSTR("an owner name longer than the inline limit ")) + CString(i));
+		metadata.set(CString(OSSTR("revision")), (SInt64) i * 7);
+
+		// Setup tags
+		TNArray<CString>	tags;
+		for (UInt32 j = 0; j < 4; j++)
+			// Add tag
+			tags += CString(OSSTR("tag ")) + CString(j);
+
+		// Setup record
+		CDictionary	record;
+		record.set(CString(OSSTR("name")), CString(OSSTR("a record name longer than the inline limit ")) + CString(i));
+		record.set(CString(OSSTR("count")), (SInt64) i);
+		record.set(CString(OSSTR("ratio")), (Float64) i / 3.0);
+		record.set(CString(OSSTR("enabled")), (i % 2) == 0);
+		record.set(CString(OSSTR("tags")), tags);
+		record.set(CString(OSSTR("metadata")), metadata);
+
+		// Add record
+		document.set(CString(OSSTR("record ")) + CString(i), record);
+	}
+
+	return document;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void sReportReferenceAdds(const char* name, UInt64 operationsCount, UInt64 startReferenceAddsCount)
+//----------------------------------------------------------------------------------------------------------------------
+{
+#if defined(REFERENCE_COUNT_STATISTICS)
+	// Print
+	::printf("%-40s %10.1f reference adds/op\n", name,
+			(Float64) (sGetReferenceAddsCount() - startReferenceAddsCount) / (Float64) operationsCount);
+#else
+	// Unused
+	(void) name;
+	(void) operationsCount;
+	(void) startReferenceAddsCount;
+#endif
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+UInt64 sGetReferenceAddsCount()
+//----------------------------------------------------------------------------------------------------------------------
+{
+#if defined(REFERENCE_COUNT_STATISTICS)
+	return SReferenceCount::getAddsCount().load();
+#else
+	return 0;
+#endif
+}
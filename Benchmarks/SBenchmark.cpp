@@ -0,0 +1,104 @@
+//----------------------------------------------------------------------------------------------------------------------
+//	SBenchmark.cpp			©2026 Stevo Brock	All rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+
+#include "SBenchmark.h"
+
+#include <atomic>
+#include <chrono>
+#include <new>
+#include <stdio.h>
+#include <stdlib.h>
+
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: Local data
+
+static	std::atomic<UInt64>	sAllocationsCount(0);
+
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - Global operators
+
+//----------------------------------------------------------------------------------------------------------------------
+void* operator new(size_t byteCount)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Count
+	sAllocationsCount.fetch_add(1, std::memory_order_relaxed);
+
+	// Allocate
+	void*	pointer = ::malloc((byteCount > 0) ? byteCount : 1);
+	if (pointer == nil)
+		// Out of memory
+		throw std::bad_alloc();
+
+	return pointer;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void operator delete(void* pointer) noexcept
+//----------------------------------------------------------------------------------------------------------------------
+{
+	::free(pointer);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void operator delete(void* pointer, size_t byteCount) noexcept
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Unused
+	(void) byteCount;
+
+	::free(pointer);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - SBenchmark
+
+// MARK: Class methods
+
+//----------------------------------------------------------------------------------------------------------------------
+Float64 SBenchmark::getTime()
+//----------------------------------------------------------------------------------------------------------------------
+{
+	return std::chrono::duration<Float64>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+UInt64 SBenchmark::getAllocationsCount()
+//----------------------------------------------------------------------------------------------------------------------
+{
+	return sAllocationsCount.load(std::memory_order_relaxed);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void SBenchmark::report(const char* name, UInt64 operationsCount, Float64 startTime, UInt64 startAllocationsCount)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	reportTotals(name, operationsCount, getTime() - startTime, getAllocationsCount() - startAllocationsCount);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void SBenchmark::reportTotals(const char* name, UInt64 operationsCount, Float64 seconds, UInt64 allocationsCount)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Print
+	::printf("%-40s %10.1f ns/op %8.2f allocs/op\n", name, seconds * 1000000000.0 / (Float64) operationsCount,
+			(Float64) allocationsCount / (Float64) operationsCount);
+	::fflush(stdout);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void SBenchmark::reportThroughput(const char* name, UInt64 byteCount, UInt64 operationsCount, Float64 startTime,
+		UInt64 startAllocationsCount)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Setup
+	Float64	seconds = getTime() - startTime;
+	UInt64	allocationsCount = getAllocationsCount() - startAllocationsCount;
+
+	// Print
+	::printf("%-40s %10.2f GB/s  %8.2f allocs/op\n", name, (Float64) byteCount / seconds / 1000000000.0,
+			(Float64) allocationsCount / (Float64) operationsCount);
+	::fflush(stdout);
+}
@@ -0,0 +1,42 @@
+//----------------------------------------------------------------------------------------------------------------------
+//	SBenchmark.h			©2026 Stevo Brock	All rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include "PlatformDefinitions.h"
+
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: Overview
+//	Each benchmark in this directory is a standalone program.  Build it optimized and without DEBUG together with
+//		SBenchmark.cpp, the Base and Concurrency sources and the platform Add On sources.  Benchmarks, Source/Base,
+//		Source/Concurrency, the platform Add On folders and "Source/Add On - Hash/xxHash" go on the include path.
+//	Numbers are printed as nanoseconds and heap allocations per operation.  Throughput is printed as GB/s, 10^9 bytes
+//		per second, and heap allocations per operation.  Allocations are counted at the global operator new, so
+//		malloc() calls, including those of CSlabAllocator, are not included.
+
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - SBenchmark
+
+struct SBenchmark {
+	// Methods
+	public:
+						// Class methods
+						// Returns a monotonic time in seconds
+		static	Float64	getTime();
+						// Returns the number of global operator new calls so far
+		static	UInt64	getAllocationsCount();
+
+						// Prints one result line of operationsCount operations that took the given time and
+						//	allocations since the given start
+		static	void	report(const char* name, UInt64 operationsCount, Float64 startTime,
+								UInt64 startAllocationsCount);
+						// Prints one result line of operationsCount operations that took the given total time and
+						//	allocations
+		static	void	reportTotals(const char* name, UInt64 operationsCount, Float64 seconds,
+								UInt64 allocationsCount);
+						// Prints one result line of operationsCount operations that processed byteCount bytes in total,
+						//	as throughput, with the time and allocations since the given start
+		static	void	reportThroughput(const char* name, UInt64 byteCount, UInt64 operationsCount,
+								Float64 startTime, UInt64 startAllocationsCount);
+};
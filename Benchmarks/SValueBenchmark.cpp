@@ -0,0 +1,112 @@
+//----------------------------------------------------------------------------------------------------------------------
+//	SValueBenchmark.cpp			©2026 Stevo Brock	All rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+//	Times wrapping CString and CData values in SValue, copying the SValue and disposing both, then building a large
+//		CDictionary tree from JSON.  Only public API is used, so the same file builds against older trees for before
+//		and after numbers.  Also build and include Source/Storage.  See SBenchmark.h for how to build.
+//----------------------------------------------------------------------------------------------------------------------
+
+#include "CJSON.h"
+#include "SBenchmark.h"
+
+#include <stdio.h>
+
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: Local data
+
+static	const	UInt32	kRepeatCount = 1000000;
+
+static	const	UInt32	kDocumentRecordsCount = 2000;
+static	const	UInt32	kDocumentRepeatCount = 20;
+
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - Main
+
+//----------------------------------------------------------------------------------------------------------------------
+int main()
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Setup
+	CString	shortString(OSSTR("short"));
+	CString	longString(OSSTR("a string longer than the inline limit"));
+	UInt8	bytes[64] = {0};
+	CData	data(bytes, sizeof(bytes));
+	UInt64	sum = 0;
+
+	// Short string
+	Float64	startTime = SBenchmark::getTime();
+	UInt64	startAllocationsCount = SBenchmark::getAllocationsCount();
+	for (UInt32 i = 0; i < kRepeatCount; i++) {
+		// Wrap, copy and dispose
+		SValue	value(shortString);
+		SValue	copy(value);
+		sum += copy.getString().getLength();
+		value.dispose(nil);
+		copy.dispose(nil);
+	}
+	SBenchmark::report("SValue CString, short", kRepeatCount, startTime, startAllocationsCount);
+
+	// Long string
+	startTime = SBenchmark::getTime();
+	startAllocationsCount = SBenchmark::getAllocationsCount();
+	for (UInt32 i = 0; i < kRepeatCount; i++) {
+		// Wrap, copy and dispose
+		SValue	value(longString);
+		SValue	copy(value);
+		sum += copy.getString().getLength();
+		value.dispose(nil);
+		copy.dispose(nil);
+	}
+	SBenchmark::report("SValue CString, long", kRepeatCount, startTime, startAllocationsCount);
+
+	// Data
+	startTime = SBenchmark::getTime();
+	startAllocationsCount = SBenchmark::getAllocationsCount();
+	for (UInt32 i = 0; i < kRepeatCount; i++) {
+		// Wrap, copy and dispose
+		SValue	value(data);
+		SValue	copy(value);
+		sum += copy.getData().getByteCount();
+		value.dispose(nil);
+		copy.dispose(nil);
+	}
+	SBenchmark::report("SValue CData", kRepeatCount, startTime, startAllocationsCount);
+
+	// Setup document.  Every record holds string values, most of them short enough to be stored inline.
+	CDictionary	document;
+	for (UInt32 i = 0; i < kDocumentRecordsCount; i++) {
+		// Setup record
+		CDictionary	record;
+		record.set(CString(OSSTR("name")), CString(OSSTR("record ")) + CString(i));
+		record.set(CString(OSSTR("kind")), CString(OSSTR("kind ")) + CString(i % 10));
+		record.set(CString(OSSTR("description")),
+				CString(OSSTR("a description longer than the inline limit ")) + CString(i));
+		record.set(CString(OSSTR("count")), (SInt64) i);
+
+		// Setup metadata
+		CDictionary	metadata;
+		metadata.set(CString(OSSTR("owner")), CString(OSSTR("owner ")) + CString(i % 100));
+		metadata.set(CString(OSSTR("state")), CString(OSSTR("active")));
+		record.set(CString(OSSTR("metadata")), metadata);
+
+		// Add record
+		document.set(CString(OSSTR("record ")) + CString(i), record);
+	}
+	CData	jsonData = *CJSON::dataFrom(document);
+
+	// JSON
+	startTime = SBenchmark::getTime();
+	startAllocationsCount = SBenchmark::getAllocationsCount();
+	for (UInt32 i = 0; i < kDocumentRepeatCount; i++)
+		// Read
+		sum += CJSON::dictionaryFrom(jsonData)->getCount();
+	SBenchmark::report("CJSON dictionaryFrom, per record", (UInt64) kDocumentRecordsCount * kDocumentRepeatCount,
+			startTime, startAllocationsCount);
+
+	// Keep the result alive
+	if (sum == 0)
+		// Unexpected
+		::printf("no work done\n");
+
+	return 0;
+}
@@ -0,0 +1,72 @@
+//----------------------------------------------------------------------------------------------------------------------
+//	TimeAndDateBenchmark.cpp			©2026 Stevo Brock	All rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+//	Times SUniversalTime RFC 3339 formatting and parsing.  Formatting the same timestamp with localtime_r() and
+//		strftime(), the usual C library route, is timed alongside for comparison.  See SBenchmark.h for how to build.
+//----------------------------------------------------------------------------------------------------------------------
+
+#include "SBenchmark.h"
+#include "TimeAndDate.h"
+
+#include <stdio.h>
+#include <time.h>
+
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: Local data
+
+static	const	UInt32	kRepeatCount = 1000000;
+
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - Main
+
+//----------------------------------------------------------------------------------------------------------------------
+int main()
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Setup.  Times advance by 100 us so the per-thread cache sees a new second every 10000 calls, like a busy log.
+	UniversalTime	time = 700000000.0;
+	char			buffer[64];
+	UInt64			sum = 0;
+
+	// Format
+	Float64	startTime = SBenchmark::getTime();
+	UInt64	startAllocationsCount = SBenchmark::getAllocationsCount();
+	for (UInt32 i = 0; i < kRepeatCount; i++)
+		// Format
+		sum += SUniversalTime::getRFC3339Chars(time + i * 0.0001, buffer, -25200.0);
+	SBenchmark::report("getRFC3339Chars()", kRepeatCount, startTime, startAllocationsCount);
+
+	// Format with the C library
+	startTime = SBenchmark::getTime();
+	startAllocationsCount = SBenchmark::getAllocationsCount();
+	for (UInt32 i = 0; i < kRepeatCount; i++) {
+		// Format
+		Float64		unixTime = time + i * 0.0001 + kUniversalTimeInterval1970To2001;
+		time_t		seconds = (time_t) unixTime;
+		struct	tm	tm;
+		::localtime_r(&seconds, &tm);
+		size_t	count = ::strftime(buffer, sizeof(buffer), "%Y-%m-%dT%H:%M:%S", &tm);
+		count +=
+				::snprintf(buffer + count, sizeof(buffer) - count, ".%03d",
+						(int) ((unixTime - (Float64) seconds) * 1000.0));
+		count += ::strftime(buffer + count, sizeof(buffer) - count, "%z", &tm);
+		sum += count;
+	}
+	SBenchmark::report("localtime_r() and strftime()", kRepeatCount, startTime, startAllocationsCount);
+
+	// Parse
+	const	char*	chars = "2023-03-07T22:54:13.922-0700";
+	startTime = SBenchmark::getTime();
+	startAllocationsCount = SBenchmark::getAllocationsCount();
+	for (UInt32 i = 0; i < kRepeatCount; i++)
+		// Parse
+		sum += (UInt64) *SUniversalTime::getFromRFC3339Chars(chars, 28);
+	SBenchmark::report("getFromRFC3339Chars()", kRepeatCount, startTime, startAllocationsCount);
+
+	// Keep the result alive
+	if (sum == 0)
+		// Unexpected
+		::printf("no work done\n");
+
+	return 0;
+}
@@ -50,6 +50,15 @@ CString::CString(const CString& other) : CHashable()
 	mStringRef = (CFStringRef) ::CFRetain(other.mStringRef);
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+CString::CString(CString&& other) : CHashable()
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Take string, leaving other with the (unreleasable) constant empty string
+	mStringRef = other.mStringRef;
+	other.mStringRef = CFSTR("");
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 CString::CString(const OSStringVar(initialString)) : CHashable()
 //----------------------------------------------------------------------------------------------------------------------
@@ -460,6 +469,32 @@ CString::~CString()
 	::CFRelease(mStringRef);
 }
 
+// MARK: CHashable methods
+
+//----------------------------------------------------------------------------------------------------------------------
+void CString::hashInto(CHashable::HashCollector& hashableHashCollector) const
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Hash UTF-16 code units so equal strings hash the same regardless of how CFString stores them internally
+	CFIndex				length = ::CFStringGetLength(mStringRef);
+	const	UniChar*	chars = ::CFStringGetCharactersPtr(mStringRef);
+	if (chars != nil)
+		// Have direct access
+		hashableHashCollector.add((const UInt8*) chars, length * sizeof(UniChar));
+	else {
+		// Copy out in chunks
+		UniChar	buffer[128];
+		for (CFIndex i = 0; i < length; i += 128) {
+			// Setup
+			CFIndex	count = std::min<CFIndex>(length - i, 128);
+
+			// Get characters
+			::CFStringGetCharacters(mStringRef, CFRangeMake(i, count), buffer);
+			hashableHashCollector.add((const UInt8*) buffer, count * sizeof(UniChar));
+		}
+	}
+}
+
 // MARK: Instance methods
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -857,6 +892,16 @@ CString& CString::operator=(const CString& other)
 	return *this;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+CString& CString::operator=(CString&& other)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Swap
+	std::swap(mStringRef, other.mStringRef);
+
+	return *this;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 CString& CString::operator+=(const CString& other)
 //----------------------------------------------------------------------------------------------------------------------
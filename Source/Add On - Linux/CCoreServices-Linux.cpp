@@ -0,0 +1,56 @@
+//----------------------------------------------------------------------------------------------------------------------
+//	CCoreServices-Linux.cpp			©2026 Stevo Brock	All rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+
+#include "CCoreServices.h"
+
+#include <signal.h>
+#include <stdio.h>
+#include <unistd.h>
+
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: CCoreServices
+
+// MARK: Info methods
+
+//----------------------------------------------------------------------------------------------------------------------
+UInt32 CCoreServices::getTotalProcessorCoresCount()
+//----------------------------------------------------------------------------------------------------------------------
+{
+	static	long	sTotalProcessorCoresCount = 0;
+
+	if (sTotalProcessorCoresCount == 0) {
+		// Get info
+		sTotalProcessorCoresCount = ::sysconf(_SC_NPROCESSORS_ONLN);
+		if (sTotalProcessorCoresCount < 1)
+			sTotalProcessorCoresCount = 1;
+	}
+
+	return (UInt32) sTotalProcessorCoresCount;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+UInt64 CCoreServices::getPhysicalMemoryByteCount()
+//----------------------------------------------------------------------------------------------------------------------
+{
+	static	UInt64	sPhysicalMemoryByteCount = 0;
+
+	if (sPhysicalMemoryByteCount == 0)
+		// Get info
+		sPhysicalMemoryByteCount = (UInt64) ::sysconf(_SC_PHYS_PAGES) * (UInt64) ::sysconf(_SC_PAGESIZE);
+
+	return sPhysicalMemoryByteCount;
+}
+
+// MARK: Debugger methods
+
+//----------------------------------------------------------------------------------------------------------------------
+void CCoreServices::stopInDebugger(SInt32 code, OSStringVar(message))
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Report
+	::fprintf(stderr, "Stopping in debugger (%d): %s\n", code, message);
+
+	// Stop
+	kill(getpid(), SIGINT);
+}
@@ -0,0 +1,1692 @@
+//----------------------------------------------------------------------------------------------------------------------
+//	CString-Linux.cpp			©2026 Stevo Brock	All rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+
+#include "CString.h"
+
+#include "CData.h"
+#include "CDictionary.h"
+#include "CLogServices.h"
+
+#include <cwctype>
+#include <locale.h>
+
+/*
+	Strings are stored as UTF-8.  Lengths and character indexes are in Unicode code points.  Strings that are pure ASCII
+		(the overwhelmingly common case) have a length equal to their byte count, which lets index math skip decoding.
+	Character classification and case mapping use the C library wide character functions against the C.UTF-8 locale
+		(falling back to the process locale where that is not installed).  kCompareToOptionsNonliteral and
+		kContainsOptionsNonliteral are not supported and compare literally.
+ */
+
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: Local data
+
+static	CString		sErrorDomain(OSSTR("CString-Linux"));
+static	SError		sCreateFailedError(sErrorDomain, 1, CString(OSSTR("Unable to create")));
+
+static	CDictionary	sLocalizationInfo;
+
+static	const	UTF16Char	sMacRomanHighCharacters[] = {
+								0x00C4, 0x00C5, 0x00C7, 0x00C9, 0x00D1, 0x00D6, 0x00DC, 0x00E1,
+								0x00E0, 0x00E2, 0x00E4, 0x00E3, 0x00E5, 0x00E7, 0x00E9, 0x00E8,
+								0x00EA, 0x00EB, 0x00ED, 0x00EC, 0x00EE, 0x00EF, 0x00F1, 0x00F3,
+								0x00F2, 0x00F4, 0x00F6, 0x00F5, 0x00FA, 0x00F9, 0x00FB, 0x00FC,
+								0x2020, 0x00B0, 0x00A2, 0x00A3, 0x00A7, 0x2022, 0x00B6, 0x00DF,
+								0x00AE, 0x00A9, 0x2122, 0x00B4, 0x00A8, 0x2260, 0x00C6, 0x00D8,
+								0x221E, 0x00B1, 0x2264, 0x2265, 0x00A5, 0x00B5, 0x2202, 0x2211,
+								0x220F, 0x03C0, 0x222B, 0x00AA, 0x00BA, 0x03A9, 0x00E6, 0x00F8,
+								0x00BF, 0x00A1, 0x00AC, 0x221A, 0x0192, 0x2248, 0x2206, 0x00AB,
+								0x00BB, 0x2026, 0x00A0, 0x00C0, 0x00C3, 0x00D5, 0x0152, 0x0153,
+								0x2013, 0x2014, 0x201C, 0x201D, 0x2018, 0x2019, 0x00F7, 0x25CA,
+								0x00FF, 0x0178, 0x2044, 0x20AC, 0x2039, 0x203A, 0xFB01, 0xFB02,
+								0x2021, 0x00B7, 0x201A, 0x201E, 0x2030, 0x00C2, 0x00CA, 0x00C1,
+								0x00CB, 0x00C8, 0x00CD, 0x00CE, 0x00CF, 0x00CC, 0x00D3, 0x00D4,
+								0xF8FF, 0x00D2, 0x00DA, 0x00DB, 0x00D9, 0x0131, 0x02C6, 0x02DC,
+								0x00AF, 0x02D8, 0x02D9, 0x02DA, 0x00B8, 0x02DD, 0x02DB, 0x02C7,
+							};
+
+//----------------------------------------------------------------------------------------------------------------------
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - Local proc declarations
+
+static	bool		sDecodeUTF8(const UInt8*& bytePtr, const UInt8* endBytePtr, UTF32Char& utf32Char);
+static	void		sAppendUTF8(std::string& string, UTF32Char utf32Char);
+static	UInt64		sGetLength(const char* chars, UInt64 byteCount);
+static	UInt64		sGetByteIndex(const char* chars, UInt64 byteCount, UInt64 length, UInt64 charIndex);
+static	bool		sTranscodeToUTF8(const UInt8* bytePtr, UInt64 byteCount, CString::Encoding encoding,
+							std::string& string);
+static	UInt32		sCompose(char* buffer, size_t bufferSize, const char* format, ...);
+static	SInt32		sCompare(const char* chars1, UInt64 byteCount1, const char* chars2, UInt64 byteCount2,
+							bool caseInsensitive, bool numerically);
+static	const char*	sFind(const char* chars, UInt64 byteCount, const char* subChars, UInt64 subByteCount);
+static	bool		sIsCharacterInSet(UTF32Char utf32Char, CString::CharacterSet characterSet);
+static	locale_t	sGetLocale();
+
+//----------------------------------------------------------------------------------------------------------------------
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - CString
+
+// MARK: Lifecycle methods
+
+//----------------------------------------------------------------------------------------------------------------------
+CString::CString() : CHashable()
+//----------------------------------------------------------------------------------------------------------------------
+{
+	init();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CString::CString(const CString& other) : CHashable()
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Copy storage
+	::memcpy(mInlineChars, other.mInlineChars, sizeof(mInlineChars));
+	mByteCount = other.mByteCount;
+	mLength = other.mLength;
+
+	// Check if sharing
+	if (mByteCount > kInlineByteCount)
+		// Add reference
+		SReferenceCount::add(*mSharedChars.mReferenceCount);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CString::CString(CString&& other) : CHashable()
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Take storage
+	::memcpy(mInlineChars, other.mInlineChars, sizeof(mInlineChars));
+	mByteCount = other.mByteCount;
+	mLength = other.mLength;
+
+	// Leave other empty
+	other.init();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CString::CString(OSStringVar(initialString)) : CHashable()
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Setup
+	UInt64	byteCount = ::strlen(initialString);
+
+	init(initialString, byteCount, sGetLength(initialString, byteCount));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CString::CString(const void* ptr, UInt64 byteCount, Encoding encoding) : CHashable()
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Parameter check
+	AssertNotNil(ptr);
+
+	// Check for UTF-8 that can be stored as-is
+	const	UInt8*	bytePtr = (const UInt8*) ptr;
+	if ((ptr == nil) || (byteCount == 0)) {
+		// Empty
+		init();
+
+		return;
+	} else if ((encoding == kEncodingUTF8) || (encoding == kEncodingASCII)) {
+		// Validate
+		const	UInt8*		endBytePtr = bytePtr + byteCount;
+				UInt64		length = 0;
+				UTF32Char	utf32Char;
+		while ((bytePtr < endBytePtr) &&
+				(((encoding == kEncodingUTF8) && sDecodeUTF8(bytePtr, endBytePtr, utf32Char)) ||
+						((encoding == kEncodingASCII) && (*bytePtr++ < 0x80))))
+			// Next
+			length++;
+		if (bytePtr == endBytePtr) {
+			// Valid
+			init((const char*) ptr, byteCount, length);
+
+			return;
+		}
+	}
+
+	// Transcode
+	std::string	string;
+	if (sTranscodeToUTF8((const UInt8*) ptr, byteCount, encoding, string))
+		// Success
+		init(string.c_str(), string.length(), sGetLength(string.c_str(), string.length()));
+	else {
+		// Failed
+		LogError(sCreateFailedError, CString(OSSTR("creating string from bytes")));
+		*this = CString(OSSTR("<Unable to create string - likely bad characters or incorrect encoding>"));
+	}
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CString::CString(const TBuffer<const UInt8>& buffer, Encoding encoding) : CHashable()
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Init
+	init();
+
+	// Finish setting up
+	if (buffer.getByteCount() > 0)
+		// Have content
+		*this = CString(*buffer, buffer.getByteCount(), encoding);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CString::CString(const TBuffer<UTF32Char>& buffer) : CHashable()
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Compose UTF-8
+	std::string	string;
+	for (UInt64 i = 0; i < buffer.getCount(); i++)
+		// Append character
+		sAppendUTF8(string, buffer[i]);
+
+	init(string.c_str(), string.length(), buffer.getCount());
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CString::CString(Float32 value, UInt32 fieldSize, UInt32 digitsAfterDecimalPoint, bool padWithZeros) : CHashable()
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Compose
+	char	buffer[100];
+	UInt32	count =
+					(fieldSize == 0) ?
+							sCompose(buffer, sizeof(buffer), "%0.*f", (int) digitsAfterDecimalPoint, (double) value) :
+							sCompose(buffer, sizeof(buffer), padWithZeros ? "%0*.*f" : "%*.*f", (int) fieldSize,
+									(int) digitsAfterDecimalPoint, (double) value);
+	init(buffer, count, count);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CString::CString(Float64 value, UInt32 fieldSize, UInt32 digitsAfterDecimalPoint, bool padWithZeros) : CHashable()
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Compose
+	char	buffer[100];
+	UInt32	count =
+					(fieldSize == 0) ?
+							sCompose(buffer, sizeof(buffer), "%0.*f", (int) digitsAfterDecimalPoint, value) :
+							sCompose(buffer, sizeof(buffer), padWithZeros ? "%0*.*f" : "%*.*f", (int) fieldSize,
+									(int) digitsAfterDecimalPoint, value);
+	init(buffer, count, count);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CString::CString(SInt8 value, UInt32 fieldSize, bool padWithZeros) : CHashable()
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Compose
+	char	buffer[100];
+	UInt32	count =
+					(fieldSize == 0) ?
+							SNumber::getChars((SInt64) value, buffer) :
+							sCompose(buffer, sizeof(buffer), padWithZeros ? "%.*d" : "%*d", (int) fieldSize,
+									(int) value);
+	init(buffer, count, count);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CString::CString(SInt16 value, UInt32 fieldSize, bool padWithZeros) : CHashable()
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Compose
+	char	buffer[100];
+	UInt32	count =
+					(fieldSize == 0) ?
+							SNumber::getChars((SInt64) value, buffer) :
+							sCompose(buffer, sizeof(buffer), padWithZeros ? "%.*d" : "%*d", (int) fieldSize,
+									(int) value);
+	init(buffer, count, count);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CString::CString(SInt32 value, UInt32 fieldSize, bool padWithZeros) : CHashable()
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Compose
+	char	buffer[100];
+	UInt32	count =
+					(fieldSize == 0) ?
+							SNumber::getChars((SInt64) value, buffer) :
+							sCompose(buffer, sizeof(buffer), padWithZeros ? "%.*d" : "%*d", (int) fieldSize,
+									(int) value);
+	init(buffer, count, count);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CString::CString(SInt64 value, UInt32 fieldSize, bool padWithZeros) : CHashable()
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Compose
+	char	buffer[100];
+	UInt32	count =
+					(fieldSize == 0) ?
+							SNumber::getChars(value, buffer) :
+							sCompose(buffer, sizeof(buffer), padWithZeros ? "%.*lld" : "%*lld", (int) fieldSize,
+									(long long) value);
+	init(buffer, count, count);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CString::CString(UInt8 value, UInt32 fieldSize, bool padWithZeros, bool makeHex) : CHashable()
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Compose
+	char	buffer[100];
+	UInt32	count;
+	if (fieldSize == 0)
+		// No field size
+		count = SNumber::getChars((UInt64) value, buffer);
+	else if (makeHex)
+		// Making hex
+		count =
+				sCompose(buffer, sizeof(buffer), padWithZeros ? "%#.*x" : "%#*x", (int) fieldSize,
+						(unsigned int) value);
+	else
+		// The rest
+		count =
+				sCompose(buffer, sizeof(buffer), padWithZeros ? "%.*u" : "%*u", (int) fieldSize,
+						(unsigned int) value);
+	init(buffer, count, count);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CString::CString(UInt16 value, UInt32 fieldSize, bool padWithZeros, bool makeHex) : CHashable()
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Compose
+	char	buffer[100];
+	UInt32	count;
+	if (fieldSize == 0)
+		// No field size
+		count = SNumber::getChars((UInt64) value, buffer);
+	else if (makeHex)
+		// Making hex
+		count =
+				sCompose(buffer, sizeof(buffer), padWithZeros ? "%#.*x" : "%#*x", (int) fieldSize,
+						(unsigned int) value);
+	else
+		// The rest
+		count =
+				sCompose(buffer, sizeof(buffer), padWithZeros ? "%.*u" : "%*u", (int) fieldSize,
+						(unsigned int) value);
+	init(buffer, count, count);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CString::CString(UInt32 value, UInt32 fieldSize, bool padWithZeros, bool makeHex) : CHashable()
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Compose
+	char	buffer[100];
+	UInt32	count;
+	if (fieldSize == 0)
+		// No field size
+		count = SNumber::getChars((UInt64) value, buffer);
+	else if (makeHex)
+		// Making hex
+		count =
+				sCompose(buffer, sizeof(buffer), padWithZeros ? "%#.*x" : "%#*x", (int) fieldSize,
+						(unsigned int) value);
+	else
+		// The rest
+		count =
+				sCompose(buffer, sizeof(buffer), padWithZeros ? "%.*u" : "%*u", (int) fieldSize,
+						(unsigned int) value);
+	init(buffer, count, count);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CString::CString(UInt64 value, UInt32 fieldSize, bool padWithZeros, bool makeHex) : CHashable()
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Compose
+	char	buffer[100];
+	UInt32	count;
+	if (fieldSize == 0)
+		// No field size
+		count = SNumber::getChars((UInt64) value, buffer);
+	else if (makeHex)
+		// Making hex
+		count =
+				sCompose(buffer, sizeof(buffer), padWithZeros ? "%#.*llx" : "%#*llx", (int) fieldSize,
+						(unsigned long long) value);
+	else
+		// The rest
+		count =
+				sCompose(buffer, sizeof(buffer), padWithZeros ? "%.*llu" : "%*llu", (int) fieldSize,
+						(unsigned long long) value);
+	init(buffer, count, count);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CString::CString(OSType osType, bool isOSType, bool includeQuotes) : CHashable()
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// isOSType only selects this overload
+	(void) isOSType;
+
+	// Setup
+	UInt8	bytes[6] =
+					{'\'', (UInt8) ((osType >> 24) & 0xFF), (UInt8) ((osType >> 16) & 0xFF),
+							(UInt8) ((osType >> 8) & 0xFF), (UInt8) (osType & 0xFF), '\''};
+
+	// Init
+	init();
+
+	// Finish setting up
+	*this = includeQuotes ? CString(bytes, 6, kEncodingMacRoman) : CString(bytes + 1, 4, kEncodingMacRoman);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CString::CString(const void* pointer) : CHashable()
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Compose
+	char	buffer[100];
+	UInt32	count = sCompose(buffer, sizeof(buffer), "%p", pointer);
+	init(buffer, count, count);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CString::CString(const TArray<CString>& components, const CString& separator) : CHashable()
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Setup
+	std::string	string;
+	UInt64		length = 0;
+
+	// Iterate array
+	for (CArray::ItemIndex i = 0; i < components.getCount(); i++) {
+		// Check if need to add separator
+		if (i > 0) {
+			// Add separator
+			string.append(separator.getChars(), separator.mByteCount);
+			length += separator.mLength;
+		}
+
+		// Append this component
+		const	CString&	component = components[i];
+		string.append(component.getChars(), component.mByteCount);
+		length += component.mLength;
+	}
+
+	init(string.c_str(), string.length(), length);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CString::CString(const CString& localizationGroup, const CString& localizationKey, const CString& replacementString,
+		const SValue& replacementValue)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Retrieve from info
+	init();
+	*this = sLocalizationInfo.getString(localizationGroup + CString::mPeriod + localizationKey, localizationKey);
+
+	// Replace value
+	CString	replacement;
+	switch (replacementValue.getType()) {
+		case SValue::kTypeBool:
+			// Bool
+			replacement = replacementValue.getBool() ? CString(OSSTR("true")) : CString(OSSTR("false"));
+			break;
+
+		case SValue::kTypeString:	replacement = replacementValue.getString();				break;
+		case SValue::kTypeFloat32:	replacement = CString(replacementValue.getFloat32());	break;
+		case SValue::kTypeFloat64:	replacement = CString(replacementValue.getFloat64());	break;
+		case SValue::kTypeSInt8:	replacement = CString(replacementValue.getSInt8());		break;
+		case SValue::kTypeSInt16:	replacement = CString(replacementValue.getSInt16());	break;
+		case SValue::kTypeSInt32:	replacement = CString(replacementValue.getSInt32());	break;
+		case SValue::kTypeSInt64:	replacement = CString(replacementValue.getSInt64());	break;
+		case SValue::kTypeUInt8:	replacement = CString(replacementValue.getUInt8());		break;
+		case SValue::kTypeUInt16:	replacement = CString(replacementValue.getUInt16());	break;
+		case SValue::kTypeUInt32:	replacement = CString(replacementValue.getUInt32());	break;
+		case SValue::kTypeUInt64:	replacement = CString(replacementValue.getUInt64());	break;
+
+		case SValue::kTypeEmpty:
+		case SValue::kTypeArrayOfDictionaries:
+		case SValue::kTypeArrayOfStrings:
+		case SValue::kTypeOpaque:
+		case SValue::kTypeData:
+		case SValue::kTypeDictionary:
+			// Unhandled
+			replacement = CString(OSSTR("->UNHANDLED<-"));
+			break;
+	}
+
+	// Replace
+	*this = replacingSubStrings(replacementString, replacement);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CString::CString(const CString& localizationGroup, const CString& localizationKey, const CDictionary& localizationInfo)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Retrieve from info
+	init();
+	*this = sLocalizationInfo.getString(localizationGroup + CString::mPeriod + localizationKey, localizationKey);
+
+	// Replace values
+	for (CDictionary::Iterator iterator = localizationInfo.getIterator(); iterator; iterator++) {
+		// Compose value
+		CString	replacement;
+		switch (iterator.getValue().getType()) {
+			case SValue::kTypeBool:
+				// Bool
+				replacement = iterator.getValue().getBool() ? CString(OSSTR("true")) : CString(OSSTR("false"));
+				break;
+
+			case SValue::kTypeString:	replacement = iterator.getValue().getString();				break;
+			case SValue::kTypeFloat32:	replacement = CString(iterator.getValue().getFloat32());	break;
+			case SValue::kTypeFloat64:	replacement = CString(iterator.getValue().getFloat64());	break;
+			case SValue::kTypeSInt8:	replacement = CString(iterator.getValue().getSInt8());		break;
+			case SValue::kTypeSInt16:	replacement = CString(iterator.getValue().getSInt16());		break;
+			case SValue::kTypeSInt32:	replacement = CString(iterator.getValue().getSInt32());		break;
+			case SValue::kTypeSInt64:	replacement = CString(iterator.getValue().getSInt64());		break;
+			case SValue::kTypeUInt8:	replacement = CString(iterator.getValue().getUInt8());		break;
+			case SValue::kTypeUInt16:	replacement = CString(iterator.getValue().getUInt16());		break;
+			case SValue::kTypeUInt32:	replacement = CString(iterator.getValue().getUInt32());		break;
+			case SValue::kTypeUInt64:	replacement = CString(iterator.getValue().getUInt64());		break;
+
+			case SValue::kTypeEmpty:
+			case SValue::kTypeArrayOfDictionaries:
+			case SValue::kTypeArrayOfStrings:
+			case SValue::kTypeOpaque:
+			case SValue::kTypeData:
+			case SValue::kTypeDictionary:
+				// Unhandled
+				replacement = CString(OSSTR("->UNHANDLED<-"));
+				break;
+		}
+
+		// Replace
+		*this = replacingSubStrings(iterator.getKey(), replacement);
+	}
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CString::CString(const CString& localizationGroup, const CString& localizationKey)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Retrieve from info
+	init();
+	*this = sLocalizationInfo.getString(localizationGroup + CString::mPeriod + localizationKey, localizationKey);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CString::~CString()
+//----------------------------------------------------------------------------------------------------------------------
+{
+	cleanup();
+}
+
+// MARK: CHashable methods
+
+//----------------------------------------------------------------------------------------------------------------------
+void CString::hashInto(CHashable::HashCollector& hashableHashCollector) const
+//----------------------------------------------------------------------------------------------------------------------
+{
+	hashableHashCollector.add((const UInt8*) getChars(), mByteCount);
+}
+
+// MARK: Instance methods
+
+//----------------------------------------------------------------------------------------------------------------------
+OSStringType CString::getOSString() const
+//----------------------------------------------------------------------------------------------------------------------
+{
+	return getChars();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+const CString::C CString::getUTF8String() const
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Check storage
+	if (mByteCount > kInlineByteCount)
+		// Share our buffer
+		return C(mSharedChars.mChars, mSharedChars.mReferenceCount);
+	else {
+		// Copy into the C's inline buffer
+		C	c(mByteCount + 1);
+		::memcpy(*c, mInlineChars, mByteCount + 1);
+
+		return c;
+	}
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CString::Length CString::getLength() const
+//----------------------------------------------------------------------------------------------------------------------
+{
+	return mLength;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+Float32 CString::getFloat32() const
+//----------------------------------------------------------------------------------------------------------------------
+{
+	return ::strtof(getChars(), nil);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+Float64 CString::getFloat64() const
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Parse, leaving what SNumber does not handle (leading whitespace, inf, nan, hex) to strtod
+	const	char*	charPtr = getChars();
+			Float64	value;
+
+	return SNumber::getFloat64(charPtr, charPtr + mByteCount, value) ? value : ::strtod(getChars(), nil);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+TBuffer<char> CString::getUTF8Chars() const
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Copy
+	TBuffer<char>	buffer(mByteCount);
+	::memcpy(*buffer, getChars(), mByteCount);
+
+	return buffer;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+TBuffer<UTF32Char> CString::getUTF32Chars() const
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Setup
+	TBuffer<UTF32Char>	buffer(mLength);
+	const	UInt8*		bytePtr = (const UInt8*) getChars();
+	const	UInt8*		endBytePtr = bytePtr + mByteCount;
+
+	// Decode
+	for (UInt64 i = 0; i < mLength; i++)
+		// Decode character
+		sDecodeUTF8(bytePtr, endBytePtr, buffer[i]);
+
+	return buffer;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+OV<CData> CString::getData(Encoding encoding, bool okToFail) const
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Check for UTF-8 or pure ASCII
+	if ((encoding == kEncodingUTF8) ||
+			((mLength == mByteCount) &&
+					((encoding == kEncodingASCII) || (encoding == kEncodingMacRoman) ||
+							(encoding == kEncodingISOLatin))))
+		// Can use our bytes as-is
+		return OV<CData>(CData(getChars(), mByteCount));
+
+	// Setup
+	TBuffer<UTF32Char>	utf32Chars = getUTF32Chars();
+	CData				data((CData::ByteCount) 0);
+
+	// Check encoding
+	switch (encoding) {
+		case kEncodingASCII:
+		case kEncodingMacRoman:
+		case kEncodingISOLatin: {
+			// Single byte encodings
+			TBuffer<UInt8>	buffer(mLength);
+			for (UInt64 i = 0; i < mLength; i++) {
+				// Check character
+				UTF32Char	utf32Char = utf32Chars[i];
+				if (utf32Char < 0x80)
+					// ASCII
+					buffer[i] = (UInt8) utf32Char;
+				else if ((encoding == kEncodingISOLatin) && (utf32Char < 0x100))
+					// ISO Latin
+					buffer[i] = (UInt8) utf32Char;
+				else if (encoding == kEncodingMacRoman) {
+					// Look up
+					const	UTF16Char*	macRomanHighCharacter =
+												std::find(sMacRomanHighCharacters,
+														sMacRomanHighCharacters + 128, utf32Char);
+					if (macRomanHighCharacter == (sMacRomanHighCharacters + 128))
+						// Not representable
+						break;
+					buffer[i] = (UInt8) (0x80 + (macRomanHighCharacter - sMacRomanHighCharacters));
+				} else
+					// Not representable
+					break;
+
+				// Check if done
+				if (i == (mLength - 1))
+					// Done
+					data = CData(*buffer, mLength);
+			}
+			break;
+		}
+
+		case kEncodingUTF16:
+		case kEncodingUTF16BE:
+		case kEncodingUTF16LE: {
+			// UTF-16
+			bool	isBigEndian = encoding == kEncodingUTF16BE;
+			if (encoding == kEncodingUTF16)
+				// Add BOM
+				data.append((UInt16) EndianU16_NtoL(0xFEFF));
+			for (UInt64 i = 0; i < mLength; i++) {
+				// Compose code units
+				UTF32Char	utf32Char = utf32Chars[i];
+				UTF16Char	utf16Chars[2];
+				UInt32		utf16CharCount;
+				if (utf32Char < 0x10000) {
+					// Single code unit
+					utf16Chars[0] = (UTF16Char) utf32Char;
+					utf16CharCount = 1;
+				} else {
+					// Surrogate pair
+					utf16Chars[0] = (UTF16Char) (0xD800 + ((utf32Char - 0x10000) >> 10));
+					utf16Chars[1] = (UTF16Char) (0xDC00 + ((utf32Char - 0x10000) & 0x3FF));
+					utf16CharCount = 2;
+				}
+
+				// Append
+				for (UInt32 j = 0; j < utf16CharCount; j++)
+					// Append code unit
+					data.append(isBigEndian ? EndianU16_NtoB(utf16Chars[j]) : EndianU16_NtoL(utf16Chars[j]));
+			}
+			break;
+		}
+
+		case kEncodingUTF32BE:
+		case kEncodingUTF32LE:
+			// UTF-32
+			for (UInt64 i = 0; i < mLength; i++)
+				// Append
+				data.append((encoding == kEncodingUTF32BE) ?
+						EndianU32_NtoB(utf32Chars[i]) : EndianU32_NtoL(utf32Chars[i]));
+			break;
+
+		case kEncodingUTF8:
+			// Handled above
+			break;
+	}
+
+	// Check result
+	if ((mLength == 0) || !data.isEmpty())
+		// Success
+		return OV<CData>(data);
+
+	// Failed
+	if (!okToFail)
+		// More efficient encodings bay be tried for which it's ok to fail
+		LogError(sCreateFailedError, CString(OSSTR("getting data")));
+
+	return OV<CData>();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CString CString::getSubString(CharIndex startIndex, OV<Length> length) const
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Check if need to limit length
+	Length	lengthUse =
+					(length.hasValue() && ((startIndex + *length) <= mLength)) ?
+							*length : ((startIndex < mLength) ? mLength - startIndex : 0);
+
+	// Setup
+	const	char*	chars = getChars();
+			UInt64	startByteIndex = sGetByteIndex(chars, mByteCount, mLength, startIndex);
+			UInt64	endByteIndex =
+							(mLength == mByteCount) ?
+									startByteIndex + lengthUse :
+									startByteIndex +
+											sGetByteIndex(chars + startByteIndex, mByteCount - startByteIndex,
+													mLength - startIndex, lengthUse);
+
+	// Check for whole string
+	if ((startByteIndex == 0) && (endByteIndex == mByteCount))
+		// Share
+		return *this;
+
+	// Compose new string
+	CString	string;
+	string.init(chars + startByteIndex, endByteIndex - startByteIndex, lengthUse);
+
+	return string;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CString CString::replacingSubStrings(const CString& subStringToReplace, const CString& replacementString) const
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Setup
+	const	char*	chars = getChars();
+	const	char*	endChars = chars + mByteCount;
+	const	char*	subChars = subStringToReplace.getChars();
+
+	// Check if have anything to replace
+	const	char*	foundChars = sFind(chars, mByteCount, subChars, subStringToReplace.mByteCount);
+	if ((subStringToReplace.mByteCount == 0) || (foundChars == nil))
+		// Nothing to replace
+		return *this;
+
+	// Iterate all substrings
+	std::string	string;
+	UInt64		length = mLength;
+	while (foundChars != nil) {
+		// Append up to found and the replacement
+		string.append(chars, foundChars - chars);
+		string.append(replacementString.getChars(), replacementString.mByteCount);
+		length = length - subStringToReplace.mLength + replacementString.mLength;
+
+		// Find next
+		chars = foundChars + subStringToReplace.mByteCount;
+		foundChars = sFind(chars, endChars - chars, subChars, subStringToReplace.mByteCount);
+	}
+	string.append(chars, endChars - chars);
+
+	// Compose new string
+	CString	result;
+	result.init(string.c_str(), string.length(), length);
+
+	return result;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CString CString::replacingCharacters(CharIndex startIndex, OV<Length> length, const CString& replacementString) const
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Check if need to limit length
+	Length	lengthUse =
+					(length.hasValue() && ((startIndex + *length) <= mLength)) ?
+							*length : ((startIndex < mLength) ? mLength - startIndex : 0);
+
+	// Setup
+	const	char*	chars = getChars();
+			UInt64	startByteIndex = sGetByteIndex(chars, mByteCount, mLength, startIndex);
+			UInt64	endByteIndex = sGetByteIndex(chars, mByteCount, mLength, startIndex + lengthUse);
+
+	// Compose
+	std::string	string(chars, startByteIndex);
+	string.append(replacementString.getChars(), replacementString.mByteCount);
+	string.append(chars + endByteIndex, mByteCount - endByteIndex);
+
+	CString	result;
+	result.init(string.c_str(), string.length(), mLength - lengthUse + replacementString.mLength);
+
+	return result;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+OV<SRange32> CString::findSubString(const CString& subString, CharIndex startIndex, const OV<Length>& length) const
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Get length to check
+	Length	lengthUse =
+					(length.hasValue() && ((startIndex + *length) <= mLength)) ?
+							*length : ((startIndex < mLength) ? mLength - startIndex : 0);
+
+	// Setup
+	const	char*	chars = getChars();
+			UInt64	startByteIndex = sGetByteIndex(chars, mByteCount, mLength, startIndex);
+			UInt64	endByteIndex = sGetByteIndex(chars, mByteCount, mLength, startIndex + lengthUse);
+
+	// Find
+	const	char*	foundChars =
+							sFind(chars + startByteIndex, endByteIndex - startByteIndex, subString.getChars(),
+									subString.mByteCount);
+	if ((subString.mByteCount == 0) || (foundChars == nil))
+		// Not found
+		return OV<SRange32>();
+
+	return OV<SRange32>(
+			SRange32((UInt32) (startIndex + sGetLength(chars + startByteIndex, foundChars - chars - startByteIndex)),
+					(UInt32) subString.mLength));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CString CString::lowercased() const
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Setup
+	const	UInt8*	bytePtr = (const UInt8*) getChars();
+	const	UInt8*	endBytePtr = bytePtr + mByteCount;
+
+	// Transform
+	std::string	string;
+	string.reserve(mByteCount);
+	while (bytePtr < endBytePtr) {
+		// Check character
+		if (*bytePtr < 0x80)
+			// ASCII
+			string += (char) (((*bytePtr >= 'A') && (*bytePtr <= 'Z')) ? *bytePtr++ + ('a' - 'A') : *bytePtr++);
+		else {
+			// Decode
+			UTF32Char	utf32Char;
+			sDecodeUTF8(bytePtr, endBytePtr, utf32Char);
+			sAppendUTF8(string, (UTF32Char) ::towlower_l((wint_t) utf32Char, sGetLocale()));
+		}
+	}
+
+	CString	result;
+	result.init(string.c_str(), string.length(), sGetLength(string.c_str(), string.length()));
+
+	return result;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CString CString::uppercased() const
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Setup
+	const	UInt8*	bytePtr = (const UInt8*) getChars();
+	const	UInt8*	endBytePtr = bytePtr + mByteCount;
+
+	// Transform
+	std::string	string;
+	string.reserve(mByteCount);
+	while (bytePtr < endBytePtr) {
+		// Check character
+		if (*bytePtr < 0x80)
+			// ASCII
+			string += (char) (((*bytePtr >= 'a') && (*bytePtr <= 'z')) ? *bytePtr++ - ('a' - 'A') : *bytePtr++);
+		else {
+			// Decode
+			UTF32Char	utf32Char;
+			sDecodeUTF8(bytePtr, endBytePtr, utf32Char);
+			sAppendUTF8(string, (UTF32Char) ::towupper_l((wint_t) utf32Char, sGetLocale()));
+		}
+	}
+
+	CString	result;
+	result.init(string.c_str(), string.length(), sGetLength(string.c_str(), string.length()));
+
+	return result;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CString CString::removingLeadingAndTrailingWhitespace() const
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Setup
+	const	char*	chars = getChars();
+			UInt64	startByteIndex = 0;
+			UInt64	endByteIndex = mByteCount;
+
+	// Skip leading and trailing whitespace
+	while ((startByteIndex < endByteIndex) && ::strchr(" \t\n\r", chars[startByteIndex]))
+		// Skip
+		startByteIndex++;
+	while ((endByteIndex > startByteIndex) && ::strchr(" \t\n\r", chars[endByteIndex - 1]))
+		// Skip
+		endByteIndex--;
+
+	// Check if changed
+	if ((startByteIndex == 0) && (endByteIndex == mByteCount))
+		// Nothing to remove
+		return *this;
+
+	// Compose new string
+	CString	string;
+	string.init(chars + startByteIndex, endByteIndex - startByteIndex,
+			mLength - (mByteCount - (endByteIndex - startByteIndex)));
+
+	return string;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CString CString::removingLeadingAndTrailingQuotes() const
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Setup
+	const	char*	chars = getChars();
+			UInt64	startByteIndex = ((mByteCount > 0) && (chars[0] == '"')) ? 1 : 0;
+			UInt64	endByteIndex =
+							((mByteCount > startByteIndex) && (chars[mByteCount - 1] == '"')) ?
+									mByteCount - 1 : mByteCount;
+
+	// Check if changed
+	if ((startByteIndex == 0) && (endByteIndex == mByteCount))
+		// Nothing to remove
+		return *this;
+
+	// Compose new string
+	CString	string;
+	string.init(chars + startByteIndex, endByteIndex - startByteIndex,
+			mLength - (mByteCount - (endByteIndex - startByteIndex)));
+
+	return string;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CString CString::getCommonPrefix(const CString& other) const
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Setup
+	const	char*	chars = getChars();
+	const	char*	otherChars = other.getChars();
+			UInt64	byteCount = std::min<UInt64>(mByteCount, other.mByteCount);
+
+	// Find first mismatch
+	UInt64	byteIndex = 0;
+	while ((byteIndex < byteCount) && (chars[byteIndex] == otherChars[byteIndex]))
+		// Next
+		byteIndex++;
+
+	// Back up to a character boundary
+	if (byteIndex < mByteCount)
+		// Check for continuation byte
+		while ((byteIndex > 0) && ((chars[byteIndex] & 0xC0) == 0x80))
+			// Back up
+			byteIndex--;
+
+	// Compose new string
+	CString	string;
+	string.init(chars, byteIndex, sGetLength(chars, byteIndex));
+
+	return string;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+TArray<CString> CString::components(const CString& separator, bool includeEmptyComponents) const
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Setup
+	TNArray<CString>	array;
+	const	char*		chars = getChars();
+	const	char*		endChars = chars + mByteCount;
+	const	char*		separatorChars = separator.getChars();
+
+	// Iterate all substrings
+	const	char*	foundChars =
+							(separator.mByteCount > 0) ?
+									sFind(chars, mByteCount, separatorChars, separator.mByteCount) : nil;
+	while (foundChars != nil) {
+		// Check if adding
+		if (includeEmptyComponents || (foundChars > chars)) {
+			// Add to array
+			CString	string;
+			string.init(chars, foundChars - chars, sGetLength(chars, foundChars - chars));
+			array += string;
+		}
+
+		// Find next
+		chars = foundChars + separator.mByteCount;
+		foundChars = sFind(chars, endChars - chars, separatorChars, separator.mByteCount);
+	}
+
+	// Add last
+	if (includeEmptyComponents || (endChars > chars)) {
+		// Add to array
+		CString	string;
+		string.init(chars, endChars - chars, sGetLength(chars, endChars - chars));
+		array += string;
+	}
+
+	return array;
+}
+
+// MARK: Comparison methods
+
+//----------------------------------------------------------------------------------------------------------------------
+bool CString::compareTo(const CString& other, CompareToOptions compareToOptions) const
+//----------------------------------------------------------------------------------------------------------------------
+{
+	return sCompare(getChars(), mByteCount, other.getChars(), other.mByteCount,
+			compareToOptions & kCompareToOptionsCaseInsensitive, compareToOptions & kCompareToOptionsNumerically) <= 0;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+bool CString::hasPrefix(const CString& other) const
+//----------------------------------------------------------------------------------------------------------------------
+{
+	return (mByteCount >= other.mByteCount) && (::memcmp(getChars(), other.getChars(), other.mByteCount) == 0);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+bool CString::hasSuffix(const CString& other) const
+//----------------------------------------------------------------------------------------------------------------------
+{
+	return (mByteCount >= other.mByteCount) &&
+			(::memcmp(getChars() + mByteCount - other.mByteCount, other.getChars(), other.mByteCount) == 0);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+bool CString::contains(const CString& other, ContainsOptions containsOptions) const
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Check options
+	if (containsOptions & kContainsOptionsCaseInsensitive)
+		// Case insensitive
+		return lowercased().contains(other.lowercased(), kContainsOptionsNone);
+	else
+		// Literal
+		return (other.mByteCount == 0) || (sFind(getChars(), mByteCount, other.getChars(), other.mByteCount) != nil);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+bool CString::equals(const CString& other, ContainsOptions containsOptions) const
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Check options
+	if (containsOptions & kContainsOptionsCaseInsensitive)
+		// Case insensitive
+		return sCompare(getChars(), mByteCount, other.getChars(), other.mByteCount, true, false) == 0;
+	else
+		// Literal.  Shared storage (copies and atoms) compares by pointer.
+		return (mByteCount == other.mByteCount) &&
+				((getChars() == other.getChars()) || (::memcmp(getChars(), other.getChars(), mByteCount) == 0));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+bool CString::containsOnly(CharacterSet characterSet) const
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Setup
+	const	UInt8*	bytePtr = (const UInt8*) getChars();
+	const	UInt8*	endBytePtr = bytePtr + mByteCount;
+
+	// Check
+	while (bytePtr < endBytePtr) {
+		// Check character
+		UTF32Char	utf32Char;
+		sDecodeUTF8(bytePtr, endBytePtr, utf32Char);
+		if (!sIsCharacterInSet(utf32Char, characterSet))
+			// Nope
+			return false;
+	}
+
+	return true;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CString CString::filteredUsing(CharacterSet characterSet) const
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Setup
+	const	UInt8*	bytePtr = (const UInt8*) getChars();
+	const	UInt8*	endBytePtr = bytePtr + mByteCount;
+			UInt64	length = 0;
+
+	// Filter
+	std::string	string;
+	while (bytePtr < endBytePtr) {
+		// Check character
+		UTF32Char	utf32Char;
+		sDecodeUTF8(bytePtr, endBytePtr, utf32Char);
+		if (sIsCharacterInSet(utf32Char, characterSet)) {
+			// Keep
+			sAppendUTF8(string, utf32Char);
+			length++;
+		}
+	}
+
+	CString	result;
+	result.init(string.c_str(), string.length(), length);
+
+	return result;
+}
+
+// MARK: Convenience operators
+
+//----------------------------------------------------------------------------------------------------------------------
+CString& CString::operator=(const CString& other)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Check for same
+	if (this == &other)
+		return *this;
+
+	// Bye bye to us
+	cleanup();
+
+	// Hello to new
+	::memcpy(mInlineChars, other.mInlineChars, sizeof(mInlineChars));
+	mByteCount = other.mByteCount;
+	mLength = other.mLength;
+	if (mByteCount > kInlineByteCount)
+		// Add reference
+		SReferenceCount::add(*mSharedChars.mReferenceCount);
+
+	return *this;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CString& CString::operator=(CString&& other)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Check for same
+	if (this == &other)
+		return *this;
+
+	// Bye bye to us
+	cleanup();
+
+	// Take storage
+	::memcpy(mInlineChars, other.mInlineChars, sizeof(mInlineChars));
+	mByteCount = other.mByteCount;
+	mLength = other.mLength;
+
+	// Leave other empty
+	other.init();
+
+	return *this;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CString& CString::operator+=(const CString& other)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	return *this = *this + other;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CString CString::operator+(const CString& other) const
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Check for empty
+	if (other.mByteCount == 0)
+		// Nothing to add
+		return *this;
+	else if (mByteCount == 0)
+		// Just other
+		return other;
+
+	// Setup
+	UInt64	byteCount = mByteCount + other.mByteCount;
+	CString	string;
+	if (byteCount <= kInlineByteCount) {
+		// Compose inline
+		::memcpy(string.mInlineChars, mInlineChars, mByteCount);
+		::memcpy(string.mInlineChars + mByteCount, other.mInlineChars, other.mByteCount + 1);
+		string.mByteCount = byteCount;
+		string.mLength = mLength + other.mLength;
+	} else {
+		// Compose shared
+		string.mSharedChars.mChars = C::newSharedBuffer(byteCount + 1, string.mSharedChars.mReferenceCount);
+		::memcpy(string.mSharedChars.mChars, getChars(), mByteCount);
+		::memcpy(string.mSharedChars.mChars + mByteCount, other.getChars(), other.mByteCount + 1);
+		string.mByteCount = byteCount;
+		string.mLength = mLength + other.mLength;
+	}
+
+	return string;
+}
+
+// MARK: Class methods
+
+//----------------------------------------------------------------------------------------------------------------------
+CString CString::make(OSStringType format, va_list args)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Try to compose on the stack
+	char	buffer[256];
+	va_list	argsCopy;
+	va_copy(argsCopy, args);
+	int		count = ::vsnprintf(buffer, sizeof(buffer), format, argsCopy);
+	va_end(argsCopy);
+	if (count < 0)
+		// Failed
+		return CString::mEmpty;
+
+	// Check if fit
+	CString	string;
+	if ((size_t) count < sizeof(buffer))
+		// Fit
+		string.init(buffer, count, sGetLength(buffer, count));
+	else {
+		// Compose on the heap
+		TBuffer<char>	heapBuffer(count + 1);
+		::vsnprintf(*heapBuffer, count + 1, format, args);
+		string.init(*heapBuffer, count, sGetLength(*heapBuffer, count));
+	}
+
+	return string;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void CString::setupLocalization(const CData& stringsFileData)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Iterate lines
+	TArray<CString>	lines =
+							CString(stringsFileData, kEncodingUTF8)
+									.replacingSubStrings(CString(OSSTR("\\U00B5")), CString(OSSTR("µ")))
+									.components(CString::mPlatformDefaultNewline);
+	for (TArray<CString>::Iterator iterator = lines.getIterator(); iterator; iterator++) {
+		// Process line
+		TArray<CString>	components = iterator->components(CString(OSSTR(" = ")));
+		if (components.getCount() == 2)
+			// Have a localization line
+			sLocalizationInfo.set(components[0].getSubString(1, components[0].getLength() - 2),
+					components[1].getSubString(1, components[1].getLength() - 3)
+							.replacingSubStrings(CString(OSSTR("\\\"")), CString::mDoubleQuote)
+							.replacingSubStrings(CString(OSSTR("\\n")), CString::mNewline));
+	}
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+bool CString::hasLocalizationFor(const CString& localizationGroup, const CString& localizationKey)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	return sLocalizationInfo.contains(localizationGroup + CString::mPeriod + localizationKey);
+}
+
+// MARK: Internal methods
+
+//----------------------------------------------------------------------------------------------------------------------
+void CString::init()
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Setup empty inline storage
+	mInlineChars[0] = 0;
+	mByteCount = 0;
+	mLength = 0;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void CString::init(const char* chars, UInt64 byteCount, UInt64 length)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Note: assumes no storage is currently held
+
+	// Check byte count
+	if (byteCount <= kInlineByteCount) {
+		// Store inline
+		::memcpy(mInlineChars, chars, byteCount);
+		mInlineChars[byteCount] = 0;
+	} else {
+		// Store shared
+		mSharedChars.mChars = C::newSharedBuffer(byteCount + 1, mSharedChars.mReferenceCount);
+		::memcpy(mSharedChars.mChars, chars, byteCount);
+		mSharedChars.mChars[byteCount] = 0;
+	}
+
+	// Store
+	mByteCount = byteCount;
+	mLength = length;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void CString::cleanup()
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Check if sharing
+	if (mByteCount > kInlineByteCount)
+		// Release
+		C::releaseSharedBuffer(mSharedChars.mReferenceCount);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - Local proc definitions
+
+//----------------------------------------------------------------------------------------------------------------------
+bool sDecodeUTF8(const UInt8*& bytePtr, const UInt8* endBytePtr, UTF32Char& utf32Char)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Check lead byte
+	UInt8	byte = *bytePtr++;
+	UInt32	continuationByteCount;
+	if (byte < 0x80) {
+		// ASCII
+		utf32Char = byte;
+
+		return true;
+	} else if ((byte & 0xE0) == 0xC0) {
+		// 2 byte sequence
+		utf32Char = byte & 0x1F;
+		continuationByteCount = 1;
+	} else if ((byte & 0xF0) == 0xE0) {
+		// 3 byte sequence
+		utf32Char = byte & 0x0F;
+		continuationByteCount = 2;
+	} else if ((byte & 0xF8) == 0xF0) {
+		// 4 byte sequence
+		utf32Char = byte & 0x07;
+		continuationByteCount = 3;
+	} else {
+		// Invalid lead byte
+		utf32Char = 0xFFFD;
+
+		return false;
+	}
+
+	// Check continuation bytes
+	if ((endBytePtr - bytePtr) < (SInt64) continuationByteCount) {
+		// Truncated
+		utf32Char = 0xFFFD;
+
+		return false;
+	}
+	for (UInt32 i = 0; i < continuationByteCount; i++) {
+		// Check byte
+		if ((bytePtr[i] & 0xC0) != 0x80) {
+			// Invalid
+			utf32Char = 0xFFFD;
+
+			return false;
+		}
+		utf32Char = (utf32Char << 6) | (bytePtr[i] & 0x3F);
+	}
+	bytePtr += continuationByteCount;
+
+	// Reject overlong encodings, surrogates, and out of range values
+	static	const	UTF32Char	sMinimumValues[] = {0, 0x80, 0x800, 0x10000};
+	if ((utf32Char < sMinimumValues[continuationByteCount]) || ((utf32Char >= 0xD800) && (utf32Char <= 0xDFFF)) ||
+			(utf32Char > 0x10FFFF)) {
+		// Invalid
+		utf32Char = 0xFFFD;
+
+		return false;
+	}
+
+	return true;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void sAppendUTF8(std::string& string, UTF32Char utf32Char)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Check value
+	if (utf32Char < 0x80)
+		// 1 byte
+		string += (char) utf32Char;
+	else if (utf32Char < 0x800) {
+		// 2 bytes
+		string += (char) (0xC0 | (utf32Char >> 6));
+		string += (char) (0x80 | (utf32Char & 0x3F));
+	} else if ((utf32Char < 0x10000) || (utf32Char > 0x10FFFF)) {
+		// 3 bytes
+		if ((utf32Char > 0x10FFFF) || ((utf32Char >= 0xD800) && (utf32Char <= 0xDFFF)))
+			// Replacement character
+			utf32Char = 0xFFFD;
+		string += (char) (0xE0 | (utf32Char >> 12));
+		string += (char) (0x80 | ((utf32Char >> 6) & 0x3F));
+		string += (char) (0x80 | (utf32Char & 0x3F));
+	} else {
+		// 4 bytes
+		string += (char) (0xF0 | (utf32Char >> 18));
+		string += (char) (0x80 | ((utf32Char >> 12) & 0x3F));
+		string += (char) (0x80 | ((utf32Char >> 6) & 0x3F));
+		string += (char) (0x80 | (utf32Char & 0x3F));
+	}
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+UInt64 sGetLength(const char* chars, UInt64 byteCount)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Count all bytes that are not continuation bytes
+	UInt64	length = 0;
+	for (UInt64 i = 0; i < byteCount; i++)
+		// Check byte
+		length += ((chars[i] & 0xC0) != 0x80) ? 1 : 0;
+
+	return length;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+UInt64 sGetByteIndex(const char* chars, UInt64 byteCount, UInt64 length, UInt64 charIndex)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Check for ASCII
+	if (length == byteCount)
+		// Character index is the byte index
+		return std::min<UInt64>(charIndex, byteCount);
+
+	// Walk characters
+	UInt64	byteIndex = 0;
+	for (; (charIndex > 0) && (byteIndex < byteCount); charIndex--)
+		// Skip this character
+		for (byteIndex++; (byteIndex < byteCount) && ((chars[byteIndex] & 0xC0) == 0x80); byteIndex++) ;
+
+	return byteIndex;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+bool sTranscodeToUTF8(const UInt8* bytePtr, UInt64 byteCount, CString::Encoding encoding, std::string& string)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Setup
+	const	UInt8*	endBytePtr = bytePtr + byteCount;
+	string.reserve(byteCount);
+
+	// Check for UTF16 encoding
+	if (encoding == CString::kEncodingUTF16) {
+		// Determine byte order
+		if (byteCount < 2)
+			return false;
+
+		// Check first 2 bytes
+		if ((bytePtr[0] == 0xFE) && (bytePtr[1] == 0xFF)) {
+			// Big-endian
+			bytePtr += 2;
+			encoding = CString::kEncodingUTF16BE;
+		} else if ((bytePtr[0] == 0xFF) && (bytePtr[1] == 0xFE)) {
+			// Little-endian
+			bytePtr += 2;
+			encoding = CString::kEncodingUTF16LE;
+		} else if (bytePtr[0] == 0x00)
+			// Assume Big-endian
+			encoding = CString::kEncodingUTF16BE;
+		else if (bytePtr[1] == 0x00)
+			// Assume Little-endian
+			encoding = CString::kEncodingUTF16LE;
+		else
+			// Unknown
+			return false;
+	}
+
+	// Check encoding
+	switch (encoding) {
+		case CString::kEncodingASCII:
+		case CString::kEncodingISOLatin:
+			// Values map directly to Unicode
+			while (bytePtr < endBytePtr)
+				// Append
+				sAppendUTF8(string, *bytePtr++);
+			break;
+
+		case CString::kEncodingMacRoman:
+			// Map high characters
+			while (bytePtr < endBytePtr) {
+				// Append
+				UInt8	byte = *bytePtr++;
+				sAppendUTF8(string, (byte < 0x80) ? byte : sMacRomanHighCharacters[byte - 0x80]);
+			}
+			break;
+
+		case CString::kEncodingUTF8:
+			// Replace invalid sequences
+			while (bytePtr < endBytePtr) {
+				// Append
+				UTF32Char	utf32Char;
+				sDecodeUTF8(bytePtr, endBytePtr, utf32Char);
+				sAppendUTF8(string, utf32Char);
+			}
+			break;
+
+		case CString::kEncodingUTF16:
+		case CString::kEncodingUTF16BE:
+		case CString::kEncodingUTF16LE:
+			// UTF-16
+			while ((endBytePtr - bytePtr) >= 2) {
+				// Get code unit
+				UTF32Char	utf32Char =
+									(encoding == CString::kEncodingUTF16BE) ?
+											(bytePtr[0] << 8) | bytePtr[1] : (bytePtr[1] << 8) | bytePtr[0];
+				bytePtr += 2;
+
+				// Check for surrogate pair
+				if ((utf32Char >= 0xD800) && (utf32Char <= 0xDBFF) && ((endBytePtr - bytePtr) >= 2)) {
+					// Get low surrogate
+					UTF32Char	lowSurrogate =
+										(encoding == CString::kEncodingUTF16BE) ?
+												(bytePtr[0] << 8) | bytePtr[1] : (bytePtr[1] << 8) | bytePtr[0];
+					if ((lowSurrogate >= 0xDC00) && (lowSurrogate <= 0xDFFF)) {
+						// Combine
+						utf32Char = 0x10000 + ((utf32Char - 0xD800) << 10) + (lowSurrogate - 0xDC00);
+						bytePtr += 2;
+					}
+				}
+
+				// Append
+				sAppendUTF8(string, utf32Char);
+			}
+			break;
+
+		case CString::kEncodingUTF32BE:
+		case CString::kEncodingUTF32LE:
+			// UTF-32
+			while ((endBytePtr - bytePtr) >= 4) {
+				// Append
+				sAppendUTF8(string,
+						(encoding == CString::kEncodingUTF32BE) ?
+								((UTF32Char) bytePtr[0] << 24) | (bytePtr[1] << 16) | (bytePtr[2] << 8) | bytePtr[3] :
+								((UTF32Char) bytePtr[3] << 24) | (bytePtr[2] << 16) | (bytePtr[1] << 8) | bytePtr[0]);
+				bytePtr += 4;
+			}
+			break;
+	}
+
+	return true;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+UInt32 sCompose(char* buffer, size_t bufferSize, const char* format, ...)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Compose
+	va_list	args;
+	va_start(args, format);
+	int		count = ::vsnprintf(buffer, bufferSize, format, args);
+	va_end(args);
+
+	return (count > 0) ? std::min<UInt32>((UInt32) count, (UInt32) bufferSize - 1) : 0;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+SInt32 sCompare(const char* chars1, UInt64 byteCount1, const char* chars2, UInt64 byteCount2, bool caseInsensitive,
+		bool numerically)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Setup
+	const	UInt8*	bytePtr1 = (const UInt8*) chars1;
+	const	UInt8*	endBytePtr1 = bytePtr1 + byteCount1;
+	const	UInt8*	bytePtr2 = (const UInt8*) chars2;
+	const	UInt8*	endBytePtr2 = bytePtr2 + byteCount2;
+
+	// Compare
+	while ((bytePtr1 < endBytePtr1) && (bytePtr2 < endBytePtr2)) {
+		// Check for digit runs
+		if (numerically && ::isdigit(*bytePtr1) && ::isdigit(*bytePtr2)) {
+			// Skip leading zeros
+			while ((bytePtr1 < endBytePtr1) && (*bytePtr1 == '0')) bytePtr1++;
+			while ((bytePtr2 < endBytePtr2) && (*bytePtr2 == '0')) bytePtr2++;
+
+			// Find run ends
+			const	UInt8*	digitsEndBytePtr1 = bytePtr1;
+			const	UInt8*	digitsEndBytePtr2 = bytePtr2;
+			while ((digitsEndBytePtr1 < endBytePtr1) && ::isdigit(*digitsEndBytePtr1)) digitsEndBytePtr1++;
+			while ((digitsEndBytePtr2 < endBytePtr2) && ::isdigit(*digitsEndBytePtr2)) digitsEndBytePtr2++;
+
+			// Longer run is larger, otherwise compare digits
+			SInt64		digitCount1 = digitsEndBytePtr1 - bytePtr1;
+			SInt64		digitCount2 = digitsEndBytePtr2 - bytePtr2;
+			if (digitCount1 != digitCount2)
+				return (digitCount1 < digitCount2) ? -1 : 1;
+
+			int	result = ::memcmp(bytePtr1, bytePtr2, digitCount1);
+			if (result != 0)
+				return (result < 0) ? -1 : 1;
+
+			// Continue after the runs
+			bytePtr1 = digitsEndBytePtr1;
+			bytePtr2 = digitsEndBytePtr2;
+
+			continue;
+		}
+
+		// Get characters
+		UTF32Char	utf32Char1, utf32Char2;
+		sDecodeUTF8(bytePtr1, endBytePtr1, utf32Char1);
+		sDecodeUTF8(bytePtr2, endBytePtr2, utf32Char2);
+		if (caseInsensitive) {
+			// Fold case
+			utf32Char1 = (UTF32Char) ::towlower_l((wint_t) utf32Char1, sGetLocale());
+			utf32Char2 = (UTF32Char) ::towlower_l((wint_t) utf32Char2, sGetLocale());
+		}
+
+		// Compare
+		if (utf32Char1 != utf32Char2)
+			return (utf32Char1 < utf32Char2) ? -1 : 1;
+	}
+
+	return (bytePtr1 < endBytePtr1) ? 1 : ((bytePtr2 < endBytePtr2) ? -1 : 0);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+const char* sFind(const char* chars, UInt64 byteCount, const char* subChars, UInt64 subByteCount)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	return (subByteCount > 0) ? (const char*) ::memmem(chars, byteCount, subChars, subByteCount) : nil;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+bool sIsCharacterInSet(UTF32Char utf32Char, CString::CharacterSet characterSet)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Check character set
+	switch (characterSet) {
+		case CString::kCharacterSetControl:
+			// Control
+			return ::iswcntrl_l((wint_t) utf32Char, sGetLocale());
+
+		case CString::kCharacterSetWhitespace:
+			// Whitespace
+			return (utf32Char == ' ') || (utf32Char == '\t') || (::iswblank_l((wint_t) utf32Char, sGetLocale()) != 0);
+
+		case CString::kCharacterSetWhitespaceAndNewline:
+			// Whitespace and newline
+			return (utf32Char == 0x85) || (::iswspace_l((wint_t) utf32Char, sGetLocale()) != 0);
+
+		case CString::kCharacterSetDecimalDigit:
+			// Decimal digit
+			return (utf32Char >= '0') && (utf32Char <= '9');
+
+		case CString::kCharacterSetFloatingPoint:
+			// Floating point
+			return ((utf32Char >= '0') && (utf32Char <= '9')) || (utf32Char == '.');
+
+		case CString::kCharacterSetLetter:
+			// Letter
+			return ::iswalpha_l((wint_t) utf32Char, sGetLocale());
+
+		case CString::kCharacterSetLowercaseLetter:
+			// Lowercase letter
+			return ::iswlower_l((wint_t) utf32Char, sGetLocale());
+
+		case CString::kCharacterSetUppercaseLetter:
+			// Uppercase letter
+			return ::iswupper_l((wint_t) utf32Char, sGetLocale());
+
+		case CString::kCharacterSetAlphaNumeric:
+			// Alpha numeric
+			return ::iswalnum_l((wint_t) utf32Char, sGetLocale());
+
+		case CString::kCharacterSetPunctuation:
+			// Puncuation
+			return ::iswpunct_l((wint_t) utf32Char, sGetLocale());
+	}
+
+	return false;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+locale_t sGetLocale()
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Setup - fall back to the process locale if C.UTF-8 is not installed
+	static	locale_t	sLocale = ::newlocale(LC_CTYPE_MASK, "C.UTF-8", (locale_t) 0);
+	static	locale_t	sFallbackLocale = (sLocale == (locale_t) 0) ? ::duplocale(LC_GLOBAL_LOCALE) : (locale_t) 0;
+
+	return (sLocale != (locale_t) 0) ? sLocale : sFallbackLocale;
+}
@@ -0,0 +1,91 @@
+//----------------------------------------------------------------------------------------------------------------------
+//	PlatformDefinitions.h	©2026 Stevo Brock	All rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <byteswap.h>
+#include <endian.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef __cplusplus
+	#include <algorithm>
+	#include <atomic>
+	#include <string>
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------
+// Defines
+#define TARGET_OS_LINUX 1
+#if __BYTE_ORDER == __BIG_ENDIAN
+	#define TARGET_RT_BIG_ENDIAN 1
+#else
+	#define TARGET_RT_LITTLE_ENDIAN 1
+#endif
+
+#define	nil	NULL
+
+#define	MAKE_OSTYPE(a,b,c,d)	((a << 24) | (b << 16) | (c << 8) | d)
+
+#define	DEPRECATED	__attribute__((deprecated))
+#define force_inline __attribute__((always_inline))
+#define _Nullable
+
+#define Endian16_Swap(value)	bswap_16(value)
+#define Endian32_Swap(value)	bswap_32(value)
+#define Endian64_Swap(value)	bswap_64(value)
+
+#define EndianS16_BtoN(value)	((SInt16) be16toh(value))
+#define EndianS16_NtoB(value)	((SInt16) htobe16(value))
+#define EndianU16_BtoN(value)	((UInt16) be16toh(value))
+#define EndianU16_NtoB(value)	((UInt16) htobe16(value))
+#define EndianS32_BtoN(value)	((SInt32) be32toh(value))
+#define EndianS32_NtoB(value)	((SInt32) htobe32(value))
+#define EndianU32_BtoN(value)	((UInt32) be32toh(value))
+#define EndianU32_NtoB(value)	((UInt32) htobe32(value))
+#define EndianS64_BtoN(value)	((SInt64) be64toh(value))
+#define EndianS64_NtoB(value)	((SInt64) htobe64(value))
+#define EndianU64_BtoN(value)	((UInt64) be64toh(value))
+#define EndianU64_NtoB(value)	((UInt64) htobe64(value))
+
+#define EndianS16_LtoN(value)	((SInt16) le16toh(value))
+#define EndianS16_NtoL(value)	((SInt16) htole16(value))
+#define EndianU16_LtoN(value)	((UInt16) le16toh(value))
+#define EndianU16_NtoL(value)	((UInt16) htole16(value))
+#define EndianS32_LtoN(value)	((SInt32) le32toh(value))
+#define EndianS32_NtoL(value)	((SInt32) htole32(value))
+#define EndianU32_LtoN(value)	((UInt32) le32toh(value))
+#define EndianU32_NtoL(value)	((UInt32) htole32(value))
+#define EndianS64_LtoN(value)	((SInt64) le64toh(value))
+#define EndianS64_NtoL(value)	((SInt64) htole64(value))
+#define EndianU64_LtoN(value)	((UInt64) le64toh(value))
+#define EndianU64_NtoL(value)	((UInt64) htole64(value))
+
+//----------------------------------------------------------------------------------------------------------------------
+// Types
+typedef float		Float32;
+typedef double		Float64;
+typedef int8_t		SInt8;
+typedef int16_t		SInt16;
+typedef int32_t		SInt32;
+typedef long long	SInt64;
+typedef uint8_t		UInt8;
+typedef uint16_t	UInt16;
+typedef	uint32_t	UInt32;
+typedef unsigned long long	UInt64;
+
+typedef	UInt32		OSType;
+typedef	UInt32		ItemCount;
+
+typedef	UInt16		UTF16Char;
+typedef	UInt32		UTF32Char;
+
+//----------------------------------------------------------------------------------------------------------------------
+// Lifecycle helpers
+#define Delete(x)		{ delete x; x = nil; }
+#define DeleteArray(x)	{ delete [] x; x = nil; }
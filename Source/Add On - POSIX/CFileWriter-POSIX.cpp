@@ -8,6 +8,9 @@
 #include "CReferenceCountable.h"
 #include "SError-POSIX.h"
 
+#include <climits>
+#include <sys/uio.h>
+
 //----------------------------------------------------------------------------------------------------------------------
 // MARK: Macros
 
@@ -76,6 +79,63 @@ class CFileWriter::Internals : public TReferenceCountableAutoDelete<Internals> {
 								// Not open
 								return OV<SError>(CFile::mNotOpenError);
 						}
+		OV<SError>	write(const CData::Builder& dataBuilder)
+						{
+							// Check open mode
+							UInt32	segmentCount = dataBuilder.getSegmentCount();
+							if (mFILE != nil) {
+								// Write each segment to FILE as it is already buffered
+								for (UInt32 i = 0; i < segmentCount; i++) {
+									// Write segment
+									const	CData&	segment = dataBuilder.getSegment(i);
+									OV<SError>		error = write(*segment.getUInt8Buffer(), segment.getByteCount());
+									ReturnErrorIfError(error);
+								}
+
+								return OV<SError>();
+							} else if (mFD != -1) {
+								// Gather write to file, IOV_MAX segments at a time
+								struct	iovec	iovecs[IOV_MAX];
+										UInt32	segmentIndex = 0;
+								while (segmentIndex < segmentCount) {
+									// Collect segments
+									int	iovecCount = 0;
+									for (; (segmentIndex < segmentCount) && (iovecCount < IOV_MAX);
+											segmentIndex++, iovecCount++) {
+										// Add segment
+										const	CData&	segment = dataBuilder.getSegment(segmentIndex);
+										iovecs[iovecCount].iov_base = (void*) *segment.getUInt8Buffer();
+										iovecs[iovecCount].iov_len = (size_t) segment.getByteCount();
+									}
+
+									// Write, picking up after any partial write
+									struct	iovec*	iovecPtr = iovecs;
+									while (iovecCount > 0) {
+										// Write
+										ssize_t	bytes = ::writev(mFD, iovecPtr, iovecCount);
+										if (bytes == -1)
+											return SErrorFromPOSIXerror(errno);
+
+										// Skip what was written
+										while ((iovecCount > 0) && ((size_t) bytes >= iovecPtr->iov_len)) {
+											// Skip segment
+											bytes -= iovecPtr->iov_len;
+											iovecPtr++;
+											iovecCount--;
+										}
+										if (iovecCount > 0) {
+											// Skip partial segment
+											iovecPtr->iov_base = (UInt8*) iovecPtr->iov_base + bytes;
+											iovecPtr->iov_len -= bytes;
+										}
+									}
+								}
+
+								return OV<SError>();
+							} else
+								// Not open
+								return OV<SError>(CFile::mNotOpenError);
+						}
 		OV<SError>	close()
 						{
 							if (mFILE != nil) {
@@ -244,6 +304,19 @@ OV<SError> CFileWriter::write(const void* buffer, UInt64 byteCount) const
 		CFileWriterReportErrorAndReturnError(*error, CString(OSSTR("writing")));
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+OV<SError> CFileWriter::write(const CData::Builder& dataBuilder) const
+//----------------------------------------------------------------------------------------------------------------------
+{
+	OV<SError>	error = mInternals->write(dataBuilder);
+	if (!error.hasValue())
+		// Success
+		return OV<SError>();
+	else
+		// Error
+		CFileWriterReportErrorAndReturnError(*error, CString(OSSTR("writing")));
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 UInt64 CFileWriter::getPosition() const
 //----------------------------------------------------------------------------------------------------------------------
@@ -5,10 +5,12 @@
 #include "CThread.h"
 
 #include "CLogServices.h"
+#include "ConcurrencyPrimitives.h"
 #include "CppToolboxAssert.h"
 #include "SError-POSIX.h"
 
 #include <pthread.h>
+#include <unistd.h>
 
 //----------------------------------------------------------------------------------------------------------------------
 // MARK: CThread::Internals
@@ -19,15 +21,24 @@ class CThread::Internals {
 								const CString& name) :
 							mIsRunning(true), mThreadProc(threadProc), mThreadProcUserData(userData), mThreadName(name),
 									mThread(thread),
-									mPThread(nil)
+									mPThread()
 							{}
 
 		static	void*	threadProc(Internals* internals)
 							{
 								// Check if have name
-								if (!internals->mThreadName.isEmpty())
+								if (!internals->mThreadName.isEmpty()) {
 									// Set name
+#if defined(TARGET_OS_LINUX)
+									// Linux names the thread explicitly and limits names to 15 bytes
+									char	name[16];
+									::strncpy(name, *internals->mThreadName.getUTF8String(), sizeof(name) - 1);
+									name[sizeof(name) - 1] = 0;
+									::pthread_setname_np(::pthread_self(), name);
+#else
 									::pthread_setname_np(*internals->mThreadName.getUTF8String());
+#endif
+								}
 
 								// Call proc
 								internals->mThreadProc(internals->mThread, internals->mThreadProcUserData);
@@ -35,6 +46,9 @@ class CThread::Internals {
 								// Not running
 								internals->mIsRunning = false;
 
+								// Wake anyone waiting
+								internals->mFinishedSemaphore.signal();
+
 								return nil;
 							}
 
@@ -43,6 +57,7 @@ class CThread::Internals {
 		void*				mThreadProcUserData;
 		CString				mThreadName;
 		CThread&			mThread;
+		CSemaphore			mFinishedSemaphore;
 
 		pthread_t			mPThread;
 };
@@ -127,6 +142,16 @@ bool CThread::isRunning() const
 	return mInternals->mIsRunning;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+void CThread::waitUntilFinished() const
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Wait for the signal sent as the thread's last action, even if no longer running, so the thread is done with
+	//	its internals.  Then pass the signal on to anyone else waiting.
+	mInternals->mFinishedSemaphore.waitFor();
+	mInternals->mFinishedSemaphore.signal();
+}
+
 // MARK: Class methods
 
 //----------------------------------------------------------------------------------------------------------------------
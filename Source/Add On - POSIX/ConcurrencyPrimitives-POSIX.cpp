@@ -132,7 +132,7 @@ void CReadPreferringLock::unlockForWriting() const
 
 class CSemaphore::Internals {
 	public:
-		Internals()
+		Internals() : mIsSignaled(false)
 			{
 				::pthread_cond_init(&mCond, nil);
 				::pthread_mutex_init(&mMutex, nil);
@@ -145,6 +145,7 @@ class CSemaphore::Internals {
 
 		pthread_cond_t	mCond;
 		pthread_mutex_t	mMutex;
+		bool			mIsSignaled;
 };
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -173,12 +174,22 @@ CSemaphore::~CSemaphore()
 void CSemaphore::signal() const
 //----------------------------------------------------------------------------------------------------------------------
 {
+	// Latch and signal.  A signal with no waiter is kept so a subsequent waitFor() returns immediately.
+	::pthread_mutex_lock(&mInternals->mMutex);
+	mInternals->mIsSignaled = true;
 	::pthread_cond_signal(&mInternals->mCond);
+	::pthread_mutex_unlock(&mInternals->mMutex);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 void CSemaphore::waitFor() const
 //----------------------------------------------------------------------------------------------------------------------
 {
-	::pthread_cond_wait(&mInternals->mCond, &mInternals->mMutex);
+	// Wait until signaled, then consume the signal
+	::pthread_mutex_lock(&mInternals->mMutex);
+	while (!mInternals->mIsSignaled)
+		// Wait
+		::pthread_cond_wait(&mInternals->mCond, &mInternals->mMutex);
+	mInternals->mIsSignaled = false;
+	::pthread_mutex_unlock(&mInternals->mMutex);
 }
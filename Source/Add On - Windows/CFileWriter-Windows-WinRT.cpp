@@ -185,6 +185,20 @@ OV<SError> CFileWriter::write(const void* buffer, UInt64 byteCount) const
 	}
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+OV<SError> CFileWriter::write(const CData::Builder& dataBuilder) const
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Write each segment
+	for (UInt32 i = 0; i < dataBuilder.getSegmentCount(); i++) {
+		// Write segment
+		OV<SError>	error = write(dataBuilder.getSegment(i));
+		ReturnErrorIfError(error);
+	}
+
+	return OV<SError>();
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 UInt64 CFileWriter::getPos() const
 //----------------------------------------------------------------------------------------------------------------------
@@ -44,6 +44,11 @@ CString::CString(const CString& other) : CHashable()
 	mString = other.mString;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+CString::CString(CString&& other) : CHashable(), mString(std::move(other.mString))
+//----------------------------------------------------------------------------------------------------------------------
+{}
+
 //----------------------------------------------------------------------------------------------------------------------
 CString::CString(OSStringVar(initialString)) : CHashable()
 //----------------------------------------------------------------------------------------------------------------------
@@ -603,6 +608,15 @@ CString::~CString()
 //----------------------------------------------------------------------------------------------------------------------
 {}
 
+// MARK: CHashable methods
+
+//----------------------------------------------------------------------------------------------------------------------
+void CString::hashInto(CHashable::HashCollector& hashableHashCollector) const
+//----------------------------------------------------------------------------------------------------------------------
+{
+	hashableHashCollector.add((const UInt8*) mString.c_str(), mString.length() * sizeof(TCHAR));
+}
+
 // MARK: Instance methods
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -1062,6 +1076,16 @@ CString& CString::operator=(const CString& other)
 	return *this;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+CString& CString::operator=(CString&& other)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Move
+	mString = std::move(other.mString);
+
+	return *this;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 CString& CString::operator+=(const CString& other)
 //----------------------------------------------------------------------------------------------------------------------
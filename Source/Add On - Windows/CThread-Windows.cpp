@@ -5,6 +5,7 @@
 #include "CThread.h"
 
 #include "CLogServices.h"
+#include "ConcurrencyPrimitives.h"
 #include "CppToolboxAssert.h"
 
 #undef Delete
@@ -34,6 +35,9 @@ class CThread::Internals {
 								// Not running
 								internals.mIsRunning = false;
 
+								// Wake anyone waiting
+								internals.mFinishedSemaphore.signal();
+
 								return 0;
 							}
 
@@ -42,6 +46,7 @@ class CThread::Internals {
 		void*				mThreadProcUserData;
 		CString				mThreadName;
 		CThread&			mThread;
+		CSemaphore			mFinishedSemaphore;
 
 		Ref					mThreadRef;
 		HANDLE				mThreadHandle;
@@ -111,6 +116,16 @@ void CThread::start()
 	::SetThreadDescription(mInternals->mThreadHandle, mInternals->mThreadName.getOSString());
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+void CThread::waitUntilFinished() const
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Wait for the signal sent as the thread's last action, even if no longer running, so the thread is done with
+	//	its internals.  Then pass the signal on to anyone else waiting.
+	mInternals->mFinishedSemaphore.waitFor();
+	mInternals->mFinishedSemaphore.signal();
+}
+
 // MARK: Class methods
 
 //----------------------------------------------------------------------------------------------------------------------
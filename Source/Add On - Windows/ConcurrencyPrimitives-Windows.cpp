@@ -178,13 +178,8 @@ CSemaphore::~CSemaphore()
 void CSemaphore::signal() const
 //----------------------------------------------------------------------------------------------------------------------
 {
-	// Check if waiting
-	if (!::TryEnterCriticalSection(&mInternals->mCriticalSection))
-		// Waiting, set event
-		::SetEvent(mInternals->mHandle);
-	else
-		// Not waiting
-		::LeaveCriticalSection(&mInternals->mCriticalSection);
+	// Set event.  The auto-reset event stays set if no one is waiting so a subsequent waitFor() returns immediately.
+	::SetEvent(mInternals->mHandle);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -4,15 +4,18 @@
 
 #include "CArray.h"
 
+#include "CCoreServices.h"
+#include "CParallel.h"
 #include "CppToolboxAssert.h"
 #include "CReferenceCountable.h"
+#include "CSlabAllocator.h"
 
 //----------------------------------------------------------------------------------------------------------------------
 // MARK: CArray::Internals
 
-class CArray::Internals : public TCopyOnWriteReferenceCountable<Internals> {
+class CArray::Internals : public TCopyOnWriteReferenceCountable<Internals>, public CSlabAllocatable {
 	public:
-		class IteratorInfo : public CArray::IteratorInfo {
+		class IteratorInfo : public CArray::IteratorInfo, public CSlabAllocatable {
 			public:
 						IteratorInfo(const Internals& internals, UInt32 initialReference) :
 							mInternals(internals),
@@ -44,6 +47,13 @@ class CArray::Internals : public TCopyOnWriteReferenceCountable<Internals> {
 	public:
 		struct SortInfo {
 			public:
+						SortInfo(CompareProc compareProc, void* userData) :
+							mCompareProc(compareProc), mUserData(userData)
+							{}
+
+				bool	operator()(ItemRef itemRef1, ItemRef itemRef2) const
+							{ return mCompareProc(itemRef1, itemRef2, mUserData); }
+
 				CompareProc	mCompareProc;
 				void*		mUserData;
 		};
@@ -169,15 +179,6 @@ class CArray::Internals : public TCopyOnWriteReferenceCountable<Internals> {
 										mReference++;
 									}
 
-		static	int				sort(void* info, const void* itemRef1, const void* itemRef2)
-									{
-										SortInfo*	sortInfo = (SortInfo*) info;
-
-										return sortInfo->mCompareProc(*((ItemRef*) itemRef1), *((ItemRef*) itemRef2),
-														sortInfo->mUserData) ?
-												-1 : 1;
-									}
-
 	private:
 				void			removeAllInternal()
 									{
@@ -200,6 +201,135 @@ class CArray::Internals : public TCopyOnWriteReferenceCountable<Internals> {
 		UInt32		mReference;
 };
 
+//----------------------------------------------------------------------------------------------------------------------
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - CArrayConcurrentSort
+//	Sorts equal runs of the item refs concurrently, then merges pairs of runs concurrently until one run remains.  The
+//		calling thread claims tasks alongside the work items it queues, so the sort completes even when every thread of
+//		CWorkItemQueue::main() is busy.
+
+class CArrayConcurrentSort {
+	// Procs
+	public:
+		typedef	bool	(*CompareProc)(CArray::ItemRef itemRef1, CArray::ItemRef itemRef2, void* userData);
+
+	private:
+		typedef	void	(*TaskProc)(CArrayConcurrentSort& concurrentSort, UInt32 taskIndex);
+
+	// TaskInfo
+	private:
+		struct TaskInfo {
+					// Lifecycle methods
+					TaskInfo(CArrayConcurrentSort& concurrentSort, TaskProc taskProc) :
+						mConcurrentSort(concurrentSort), mTaskProc(taskProc)
+						{}
+
+					// Class methods
+			static	void	perform(const SRange64& range, TaskInfo* taskInfo)
+								{
+									// Perform tasks
+									for (UInt64 i = range.getStart(); i < range.getStart() + range.getLength(); i++)
+										// Perform
+										taskInfo->mTaskProc(taskInfo->mConcurrentSort, (UInt32) i);
+								}
+
+			// Properties
+			CArrayConcurrentSort&	mConcurrentSort;
+			TaskProc				mTaskProc;
+		};
+
+	// Methods
+	public:
+						CArrayConcurrentSort(CArray::ItemRef* itemRefs, CArray::ItemCount count,
+								CompareProc compareProc, void* userData, bool isStable, UInt32 runCount) :
+							mItemRefs(itemRefs), mCount(count),
+									mScratchItemRefs((CArray::ItemRef*) ::malloc(count * sizeof(CArray::ItemRef))),
+									mCompareProc(compareProc), mUserData(userData), mIsStable(isStable),
+									mRunItemCount((count + runCount - 1) / runCount)
+							{}
+						~CArrayConcurrentSort()
+							{ ::free(mScratchItemRefs); }
+
+				void	perform()
+							{
+								// Sort runs
+								performTasks(sortRun, (mCount + mRunItemCount - 1) / mRunItemCount);
+
+								// Merge pairs of runs until only one remains
+								for (; mRunItemCount < mCount; mRunItemCount *= 2)
+									// Merge
+									performTasks(mergeRuns, (mCount + mRunItemCount * 2 - 1) / (mRunItemCount * 2));
+							}
+
+	private:
+				void	performTasks(TaskProc taskProc, UInt32 taskCount)
+							{
+								// Perform one task per index
+								TaskInfo	taskInfo(*this, taskProc);
+								CParallel::parallelFor(SRange64(0, taskCount), 1,
+										(CParallel::ForProc) TaskInfo::perform, &taskInfo);
+							}
+
+		static	void	sortRun(CArrayConcurrentSort& concurrentSort, UInt32 taskIndex)
+							{
+								// Setup
+								CArray::ItemIndex	start = taskIndex * concurrentSort.mRunItemCount;
+								CArray::ItemCount	count =
+															std::min<CArray::ItemCount>(concurrentSort.mRunItemCount,
+																	concurrentSort.mCount - start);
+								Comparator			comparator(concurrentSort);
+
+								// Sort
+								if (concurrentSort.mIsStable)
+									// Stable
+									TSort<CArray::ItemRef>::mergeSort(concurrentSort.mItemRefs + start, count,
+											concurrentSort.mScratchItemRefs + start, comparator);
+								else
+									// Fastest
+									TSort<CArray::ItemRef>::sort(concurrentSort.mItemRefs + start, count, comparator);
+							}
+		static	void	mergeRuns(CArrayConcurrentSort& concurrentSort, UInt32 taskIndex)
+							{
+								// Setup
+								CArray::ItemIndex	start = taskIndex * concurrentSort.mRunItemCount * 2;
+								CArray::ItemCount	leftCount = concurrentSort.mRunItemCount;
+								CArray::ItemCount	count =
+															std::min<CArray::ItemCount>(leftCount * 2,
+																	concurrentSort.mCount - start);
+
+								// Check if have a right run
+								if (count > leftCount)
+									// Merge
+									TSort<CArray::ItemRef>::merge(concurrentSort.mItemRefs + start, leftCount, count,
+											concurrentSort.mScratchItemRefs + start, Comparator(concurrentSort));
+							}
+
+	// Comparator
+	private:
+		struct Comparator {
+					Comparator(const CArrayConcurrentSort& concurrentSort) : mConcurrentSort(concurrentSort) {}
+
+			bool	operator()(CArray::ItemRef itemRef1, CArray::ItemRef itemRef2) const
+						{ return mConcurrentSort.mCompareProc(itemRef1, itemRef2, mConcurrentSort.mUserData); }
+
+			const	CArrayConcurrentSort&	mConcurrentSort;
+		};
+
+	// Properties
+	public:
+		static	const	CArray::ItemCount	kMinimumCount = 64 * 1024;
+		static	const	CArray::ItemCount	kMinimumRunItemCount = 16 * 1024;
+
+	private:
+						CArray::ItemRef*	mItemRefs;
+						CArray::ItemCount	mCount;
+						CArray::ItemRef*	mScratchItemRefs;
+						CompareProc			mCompareProc;
+						void*				mUserData;
+						bool				mIsStable;
+						CArray::ItemCount	mRunItemCount;
+};
+
 //----------------------------------------------------------------------------------------------------------------------
 //----------------------------------------------------------------------------------------------------------------------
 // MARK: - CArray
@@ -222,12 +352,22 @@ CArray::CArray(const CArray& other)
 	mInternals = other.mInternals->addReference();
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+CArray::CArray(CArray&& other)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Take other's reference.  Other can only be destroyed or assigned to after this.
+	mInternals = other.mInternals;
+	other.mInternals = nil;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 CArray::~CArray()
 //----------------------------------------------------------------------------------------------------------------------
 {
 	// Remove reference
-	mInternals->removeReference();
+	if (mInternals != nil)
+		mInternals->removeReference();
 }
 
 // MARK: Instance methods
@@ -489,45 +629,62 @@ CArray& CArray::apply(ApplyProc applyProc, void* userData)
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-CArray& CArray::sort(CompareProc compareProc, void* userData)
+CArray& CArray::sort(CompareProc compareProc, void* userData, SortOptions sortOptions)
 //----------------------------------------------------------------------------------------------------------------------
 {
 	// Prepare for write
 	Internals::prepareForWrite(&mInternals);
 
+	// Setup
+	ItemCount	count = mInternals->mCount;
+	UInt32		runCount = 1;
+	if ((sortOptions & kSortOptionsConcurrent) && (count >= CArrayConcurrentSort::kMinimumCount))
+		// Use a power of 2 runs, up to one per core
+		while (((runCount * 2) <= CCoreServices::getTotalProcessorCoresCount()) &&
+				((count / (runCount * 2)) >= CArrayConcurrentSort::kMinimumRunItemCount))
+			runCount *= 2;
+
 	// Sort
-#if defined(TARGET_OS_IOS) || defined(TARGET_OS_MACOS) || defined(TARGET_OS_TVOS) || defined(TARGET_OS_WATCHOS)
-	// BSD platforms
-	Internals::SortInfo	sortInfo = {compareProc, userData};
-	qsort_r(mInternals->mItemRefs, mInternals->mCount, sizeof(ItemRef), &sortInfo, Internals::sort);
-#elif defined(TARGET_OS_LINUX)
-	// GLibc platforms
-	qsort_r(mInternals->mItemRefs, mInternals->mCount, sizeof(ItemRef), Internals::sort, userData);
-#elif defined(TARGET_OS_WINDOWS)
-	// Windows platforms
-	Internals::SortInfo	sortInfo = {compareProc, userData};
-	qsort_s((void*) mInternals->mItemRefs, mInternals->mCount, sizeof(ItemRef), Internals::sort, &sortInfo);
-#else
-	// Unknown platform
-	AssertFailUnimplemented();
-#endif
+	if (runCount > 1)
+		// Concurrent
+		CArrayConcurrentSort(mInternals->mItemRefs, count, compareProc, userData,
+				(sortOptions & kSortOptionsStable) != 0, runCount).perform();
+	else if (sortOptions & kSortOptionsStable)
+		// Stable
+		TSort<ItemRef>::stableSort(mInternals->mItemRefs, count, Internals::SortInfo(compareProc, userData));
+	else
+		// Fastest
+		TSort<ItemRef>::sort(mInternals->mItemRefs, count, Internals::SortInfo(compareProc, userData));
 
 	return *this;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-CArray CArray::sorted(CompareProc compareProc, void* userData) const
+CArray CArray::sorted(CompareProc compareProc, void* userData, SortOptions sortOptions) const
 //----------------------------------------------------------------------------------------------------------------------
 {
 	// Setup
 	CArray	array = *this;
 
 	// Sort
-	array.sort(compareProc, userData);
+	array.sort(compareProc, userData, sortOptions);
 
 	return array;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+CArray& CArray::reorder(ReorderProc reorderProc, void* userData)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Prepare for write
+	Internals::prepareForWrite(&mInternals);
+
+	// Call proc
+	reorderProc(mInternals->mItemRefs, mInternals->mCount, userData);
+
+	return *this;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 CArray CArray::filtered(IsMatchProc isMatchProc, void* userData) const
 //----------------------------------------------------------------------------------------------------------------------
@@ -555,10 +712,21 @@ CArray& CArray::operator=(const CArray& other)
 		return *this;
 		
 	// Remove reference to ourselves
-	mInternals->removeReference();
+	if (mInternals != nil)
+		mInternals->removeReference();
 
 	// Add reference to other
 	mInternals = other.mInternals->addReference();
 
 	return *this;
 }
+
+//----------------------------------------------------------------------------------------------------------------------
+CArray& CArray::operator=(CArray&& other)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Swap
+	std::swap(mInternals, other.mInternals);
+
+	return *this;
+}
@@ -6,7 +6,9 @@
 
 #include "CEquatable.h"
 #include "CIterator.h"
+#include "CReferenceCountable.h"
 #include "SNumber.h"
+#include "TSort.h"
 #include "TWrappers.h"
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -19,6 +21,14 @@ class CArray : public CEquatable {
 		typedef			UInt32	ItemCount;
 		typedef	const	void*	ItemRef;
 
+	// SortOptions
+	public:
+		enum SortOptions {
+			kSortOptionsNone		= 0,
+			kSortOptionsStable		= 1 << 0,	// Equal items keep their relative order
+			kSortOptionsConcurrent	= 1 << 1,	// sort(CompareProc) splits large arrays across CWorkItemQueue::main()
+		};
+
 	// IteratorInfo
 	protected:
 		class IteratorInfo {
@@ -40,6 +50,7 @@ class CArray : public CEquatable {
 		typedef	ItemRef	(*CopyProc)(ItemRef itemRef);
 		typedef	void	(*DisposeProc)(ItemRef itemRef);
 		typedef bool	(*IsMatchProc)(ItemRef itemRef, void* userData);
+		typedef	void	(*ReorderProc)(ItemRef* itemRefs, ItemCount count, void* userData);
 
 	// Classes
 	private:
@@ -63,6 +74,7 @@ class CArray : public CEquatable {
 								CArray(ItemCount initialCapacity = 0, CopyProc copyProc = nil,
 										DisposeProc disposeProc = nil);
 								CArray(const CArray& other);
+								CArray(CArray&& other);
 		virtual					~CArray();
 
 								// Instance methods
@@ -95,12 +107,16 @@ class CArray : public CEquatable {
 
 				CArray&			apply(ApplyProc applyProc, void* userData = nil);
 
-				CArray&			sort(CompareProc compareProc, void* userData = nil);
-				CArray			sorted(CompareProc compareProc, void* userData = nil) const;
+				CArray&			sort(CompareProc compareProc, void* userData = nil,
+										SortOptions sortOptions = kSortOptionsNone);
+				CArray			sorted(CompareProc compareProc, void* userData = nil,
+										SortOptions sortOptions = kSortOptionsNone) const;
+				CArray&			reorder(ReorderProc reorderProc, void* userData);
 
 				CArray			filtered(IsMatchProc isMatchProc, void* userData = nil) const;
 
 				CArray&			operator=(const CArray& other);
+				CArray&			operator=(CArray&& other);
 				CArray&			operator+=(const CArray& other)
 									{ return addFrom(other); }
 
@@ -344,6 +360,7 @@ template <typename T> class TArray : public CArray {
 	public:
 								// Lifecycle methods
 								TArray(const TArray<T>& other) : CArray(other) {}
+								TArray(TArray<T>&& other) : CArray(std::move(other)) {}
 
 								// CArray methods
 		bool					contains(const T& item) const
@@ -419,11 +436,22 @@ template <typename T> class TArray : public CArray {
 										return itemIndexes;
 									}
 
-		TArray<T>				apply(ApplyProc applyProc, void* userData = nil)
-									{ CArray::apply((CArray::ApplyProc) applyProc, userData); return *this; }
+		TArray<T>&				apply(ApplyProc applyProc, void* userData = nil)
+									{
+										// Iterate all items
+										for (CArray::ItemIndex i = 0; i < getCount(); i++)
+											// Call proc
+											applyProc(*((T*) getItemAt(i)), userData);
+
+										return *this;
+									}
 
 		T&						operator[](ItemIndex index) const
 									{ return *((T*) getItemAt(index)); }
+		TArray<T>&				operator=(const TArray<T>& other)
+									{ CArray::operator=(other); return *this; }
+		TArray<T>&				operator=(TArray<T>&& other)
+									{ CArray::operator=(std::move(other)); return *this; }
 		TArray<T>				operator+(const TArray<T>& other) const
 									{ TArray<T> array(*this); array += other; return array; }
 		bool					operator==(const TArray<T>& other) const
@@ -544,8 +572,20 @@ template <typename T> class TMArray : public TArray<T> {
 		TMArray<T>&	removeAll()
 						{ CArray::removeAll(); return *this; }
 
-		TMArray<T>&	sort(CompareProc compareProc, void* userData = nil)
-						{ CArray::sort((CArray::CompareProc) compareProc, userData); return *this; }
+		TMArray<T>&	sort(CompareProc compareProc, void* userData = nil,
+							CArray::SortOptions sortOptions = CArray::kSortOptionsNone)
+						{ CArray::sort((CArray::CompareProc) compareProc, userData, sortOptions); return *this; }
+					template <typename C>
+		TMArray<T>&	sortUsing(const C& compare, CArray::SortOptions sortOptions = CArray::kSortOptionsNone)
+						{
+							// Setup
+							SortUsingInfo<C>	sortUsingInfo(compare, sortOptions);
+
+							// Reorder
+							CArray::reorder((CArray::ReorderProc) SortUsingInfo<C>::reorder, &sortUsingInfo);
+
+							return *this;
+						}
 
 					// Instance methods
 		T			popFirst()
@@ -622,6 +662,35 @@ template <typename T> class TMArray : public TArray<T> {
 					TMArray(const T& item, CArray::CopyProc copyProc, CArray::DisposeProc disposeProc) :
 						TArray<T>(copyProc, disposeProc)
 						{ add(item); }
+
+	// SortUsingInfo
+	private:
+		template <typename C> struct SortUsingInfo {
+						// Lifecycle methods
+						SortUsingInfo(const C& compare, CArray::SortOptions sortOptions) :
+							mCompare(compare), mSortOptions(sortOptions)
+							{}
+
+						// Instance methods
+				bool	operator()(CArray::ItemRef itemRef1, CArray::ItemRef itemRef2) const
+							{ return mCompare(*((const T*) itemRef1), *((const T*) itemRef2)); }
+
+						// Class methods
+		static	void	reorder(CArray::ItemRef* itemRefs, CArray::ItemCount count, SortUsingInfo<C>* sortUsingInfo)
+							{
+								// Sort
+								if (sortUsingInfo->mSortOptions & CArray::kSortOptionsStable)
+									// Stable
+									TSort<CArray::ItemRef>::stableSort(itemRefs, count, *sortUsingInfo);
+								else
+									// Fastest
+									TSort<CArray::ItemRef>::sort(itemRefs, count, *sortUsingInfo);
+							}
+
+			// Properties
+			const	C&					mCompare;
+					CArray::SortOptions	mSortOptions;
+		};
 };
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -671,6 +740,11 @@ template <typename T> class TNArray : public TMArray<T> {
 										}
 
 									// CArray methods
+				TNArray<T>&			add(const T& item)
+										{ TMArray<T>::add(item); return *this; }
+				TNArray<T>&			add(T&& item)
+										{ CArray::attach(new T(std::move(item))); return *this; }
+
 				TNArray<T>			filtered(IsMatchProc isMatchProc, void* userData = nil) const
 										{
 											// Setup
@@ -703,17 +777,29 @@ template <typename T> class TNArray : public TMArray<T> {
 				OV<T>				popFirst(IsMatchProc isMatchProc, void* userData = nil)
 										{ return TMArray<T>::popFirst(isMatchProc, userData); }
 
-				TNArray<T>			sorted(typename TMArray<T>::CompareProc compareProc, void* userData = nil) const
+				TNArray<T>			sorted(typename TMArray<T>::CompareProc compareProc, void* userData = nil,
+											CArray::SortOptions sortOptions = CArray::kSortOptionsNone) const
 										{
 											// Make a copy
 											TNArray<T>	array(*this);
 
 											// Sort
-											array.sort(compareProc, userData);
+											array.sort(compareProc, userData, sortOptions);
 
 											return array;
 										}
 
+				template <typename... A>
+				TNArray<T>&			emplace(A&&... args)
+										{ CArray::attach(new T(std::forward<A>(args)...)); return *this; }
+
+				TNArray<T>&			operator+=(const T& item)
+										{ return add(item); }
+				TNArray<T>&			operator+=(T&& item)
+										{ return add(std::move(item)); }
+				TNArray<T>&			operator+=(const TArray<T>& other)
+										{ TMArray<T>::operator+=(other); return *this; }
+
 									// Class methods
 		static	TArray<TArray<T> >	asChunksFrom(const TArray<T>& other, ItemCount chunkSize)
 										{
@@ -750,3 +836,508 @@ template <typename T> class TNArray : public TMArray<T> {
 		static	void				dispose(CArray::ItemRef itemRef)
 										{ T* t = (T*) itemRef; Delete(t); }
 };
+
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - TVArray (Value TArray)
+//	TVArrays hold their items by value in a single contiguous buffer instead of as individually allocated items, so
+//		building, iterating and sorting large tables of small structs touches one run of memory.  Items are moved
+//		when the buffer grows.  Convert to a TArray via getTArray() where a TArray is needed across an API boundary.
+
+template <typename T> class TVArray {
+	// Procs
+	public:
+		typedef	void	(*ApplyProc)(T& item, void* userData);
+		typedef	bool	(*CompareProc)(const T& item1, const T& item2, void* userData);
+		typedef	bool	(*IsMatchProc)(const T& item, void* userData);
+
+	// Internals
+	private:
+		class Internals : public TCopyOnWriteReferenceCountable<Internals> {
+			public:
+						Internals(CArray::ItemCount capacity) :
+							TCopyOnWriteReferenceCountable<Internals>(),
+									mItems((capacity > 0) ? (T*) ::malloc(capacity * sizeof(T)) : nil), mCount(0),
+									mCapacity(capacity)
+							{}
+						Internals(const Internals& other) :
+							TCopyOnWriteReferenceCountable<Internals>(),
+									mItems((other.mCount > 0) ? (T*) ::malloc(other.mCount * sizeof(T)) : nil),
+									mCount(other.mCount), mCapacity(other.mCount)
+							{
+								// Copy items
+								for (CArray::ItemIndex i = 0; i < mCount; i++)
+									// Copy
+									new (mItems + i) T(other.mItems[i]);
+							}
+						~Internals()
+							{ removeAll(); ::free(mItems); }
+
+				void	reserve(CArray::ItemCount capacity)
+							{
+								// Check if need more room
+								if (capacity <= mCapacity)
+									// Have enough
+									return;
+
+								// Move items to new buffer
+								T*	items = (T*) ::malloc(capacity * sizeof(T));
+								moveItems(items);
+
+								// Update
+								::free(mItems);
+								mItems = items;
+								mCapacity = capacity;
+							}
+						template <typename U> void	add(U&& item)
+							{
+								// Check if have room
+								if (mCount < mCapacity)
+									// Construct in place
+									new (mItems + mCount) T(std::forward<U>(item));
+								else {
+									// Construct in new buffer first as item may be referencing one of ours
+									CArray::ItemCount	capacity = (mCapacity > 0) ? mCapacity * 2 : 8;
+									T*					items = (T*) ::malloc(capacity * sizeof(T));
+									new (items + mCount) T(std::forward<U>(item));
+									moveItems(items);
+
+									// Update
+									::free(mItems);
+									mItems = items;
+									mCapacity = capacity;
+								}
+
+								// Update count
+								mCount++;
+							}
+				void	insertAtIndex(T&& item, CArray::ItemIndex itemIndex)
+							{
+								// Check if appending
+								if (itemIndex >= mCount) {
+									// Append
+									add(std::move(item));
+
+									return;
+								}
+
+								// Make room
+								reserve((mCount < mCapacity) ? mCapacity : mCapacity * 2);
+
+								// Shift following items up
+								new (mItems + mCount) T(std::move(mItems[mCount - 1]));
+								for (CArray::ItemIndex i = mCount - 1; i > itemIndex; i--)
+									// Move
+									mItems[i] = std::move(mItems[i - 1]);
+
+								// Store
+								mItems[itemIndex] = std::move(item);
+								mCount++;
+							}
+				void	removeAtIndex(CArray::ItemIndex itemIndex)
+							{
+								// Shift following items down
+								for (CArray::ItemIndex i = itemIndex + 1; i < mCount; i++)
+									// Move
+									mItems[i - 1] = std::move(mItems[i]);
+
+								// Destroy last
+								mItems[--mCount].~T();
+							}
+				void	removeAll()
+							{
+								// Destroy items
+								for (CArray::ItemIndex i = 0; i < mCount; i++)
+									// Destroy
+									mItems[i].~T();
+								mCount = 0;
+							}
+
+			private:
+				void	moveItems(T* items)
+							{
+								// Move items
+								for (CArray::ItemIndex i = 0; i < mCount; i++) {
+									// Move and destroy
+									new (items + i) T(std::move(mItems[i]));
+									mItems[i].~T();
+								}
+							}
+
+			public:
+				T*					mItems;
+				CArray::ItemCount	mCount;
+				CArray::ItemCount	mCapacity;
+		};
+
+	// SortCompare
+	private:
+		struct SortCompare {
+					// Lifecycle methods
+					SortCompare(CompareProc compareProc, void* userData) :
+						mCompareProc(compareProc), mUserData(userData)
+						{}
+
+					// Instance methods
+			bool	operator()(const T& item1, const T& item2) const
+						{ return mCompareProc(item1, item2, mUserData); }
+
+			// Properties
+			private:
+				CompareProc	mCompareProc;
+				void*		mUserData;
+		};
+
+	// Iterator
+	public:
+		class Iterator : public CIterator {
+			// Methods
+			public:
+							// Lifecycle methods
+							Iterator(const Internals& internals) :
+								CIterator(), mInternals(((Internals&) internals).addReference()), mIndex(0)
+								{}
+							Iterator(const Iterator& other) :
+								CIterator(other), mInternals(other.mInternals->addReference()), mIndex(other.mIndex)
+								{}
+							~Iterator()
+								{ mInternals->removeReference(); }
+
+							// CIterator methods
+				bool		isValid() const
+								{ return mIndex < mInternals->mCount; }
+				UInt32		getIndex() const
+								{ return mIndex; }
+				void		advance()
+								{ mIndex++; }
+
+							// Instance methods
+				const	T&	getItem() const
+								{ return mInternals->mItems[mIndex]; }
+
+				const	T&	operator*() const
+								{ return mInternals->mItems[mIndex]; }
+				const	T*	operator->() const
+								{ return mInternals->mItems + mIndex; }
+
+			// Properties
+			private:
+				Internals*			mInternals;
+				CArray::ItemIndex	mIndex;
+		};
+
+	// Methods
+	public:
+									// Lifecycle methods
+									TVArray(CArray::ItemCount initialCapacity = 0) :
+										mInternals(new Internals(initialCapacity))
+										{}
+									TVArray(const T& item, CArray::ItemCount itemCount = 1) :
+										mInternals(new Internals(itemCount))
+										{
+											// Loop requested times
+											for (CArray::ItemIndex i = 0; i < itemCount; i++)
+												// Add
+												mInternals->add(item);
+										}
+									TVArray(const TArray<T>& array) : mInternals(new Internals(array.getCount()))
+										{
+											// Iterate all items
+											for (typename TArray<T>::Iterator iterator = array.getIterator(); iterator;
+													iterator++)
+												// Add
+												mInternals->add(*iterator);
+										}
+									TVArray(const TVArray<T>& other) : mInternals(other.mInternals->addReference()) {}
+									TVArray(TVArray<T>&& other) : mInternals(other.mInternals)
+										{ other.mInternals = new Internals(0); }
+		virtual						~TVArray()
+										{ mInternals->removeReference(); }
+
+									// Instance methods
+				CArray::ItemCount	getCount() const
+										{ return mInternals->mCount; }
+				CArray::ItemCount	getCapacity() const
+										{ return mInternals->mCapacity; }
+				bool				isEmpty() const
+										{ return mInternals->mCount == 0; }
+
+				bool				contains(const T& item) const
+										{ return getIndexOf(item).hasValue(); }
+				const	T&			getAt(CArray::ItemIndex itemIndex) const
+										{ return mInternals->mItems[itemIndex]; }
+				const	T&			getFirst() const
+										{ return mInternals->mItems[0]; }
+				const	T&			getLast() const
+										{ return mInternals->mItems[mInternals->mCount - 1]; }
+				OV<CArray::ItemIndex>	getIndexOf(const T& item) const
+										{
+											// Iterate all
+											for (CArray::ItemIndex i = 0; i < mInternals->mCount; i++) {
+												// Check if same
+												if (item == mInternals->mItems[i])
+													// Match
+													return OV<CArray::ItemIndex>(i);
+											}
+
+											return OV<CArray::ItemIndex>();
+										}
+				OR<const T>			getFirst(IsMatchProc isMatchProc, void* userData = nil) const
+										{
+											// Iterate all items
+											for (CArray::ItemIndex i = 0; i < mInternals->mCount; i++) {
+												// Call proc
+												if (isMatchProc(mInternals->mItems[i], userData))
+													// Proc indicates to return this item
+													return OR<const T>(mInternals->mItems[i]);
+											}
+
+											return OR<const T>();
+										}
+				OV<CArray::ItemIndex>	getIndexWhere(IsMatchProc isMatchProc, void* userData = nil) const
+										{
+											// Iterate all items
+											for (CArray::ItemIndex i = 0; i < mInternals->mCount; i++) {
+												// Call proc
+												if (isMatchProc(mInternals->mItems[i], userData))
+													// Match
+													return OV<CArray::ItemIndex>(i);
+											}
+
+											return OV<CArray::ItemIndex>();
+										}
+
+				TVArray<T>&			reserve(CArray::ItemCount capacity)
+										{
+											// Reserve
+											Internals::prepareForWrite(&mInternals);
+											mInternals->reserve(capacity);
+
+											return *this;
+										}
+				TVArray<T>&			add(const T& item)
+										{
+											// Add
+											Internals::prepareForWrite(&mInternals);
+											mInternals->add(item);
+
+											return *this;
+										}
+				TVArray<T>&			add(T&& item)
+										{
+											// Add
+											Internals::prepareForWrite(&mInternals);
+											mInternals->add(std::move(item));
+
+											return *this;
+										}
+				TVArray<T>&			addFrom(const TVArray<T>& other)
+										{
+											// Setup
+											TVArray<T>	array(other);
+
+											// Add all items
+											Internals::prepareForWrite(&mInternals);
+											mInternals->reserve(mInternals->mCount + array.getCount());
+											for (CArray::ItemIndex i = 0; i < array.getCount(); i++)
+												// Add
+												mInternals->add(array.getAt(i));
+
+											return *this;
+										}
+				TVArray<T>&			insertAtIndex(T item, CArray::ItemIndex itemIndex)
+										{
+											// Insert
+											Internals::prepareForWrite(&mInternals);
+											mInternals->insertAtIndex(std::move(item), itemIndex);
+
+											return *this;
+										}
+				TVArray<T>&			remove(const T& item)
+										{
+											// Check if found
+											OV<CArray::ItemIndex>	itemIndex = getIndexOf(item);
+											if (itemIndex.hasValue())
+												// Remove
+												removeAtIndex(*itemIndex);
+
+											return *this;
+										}
+				TVArray<T>&			remove(IsMatchProc isMatchProc, void* userData = nil)
+										{
+											// Setup
+											Internals::prepareForWrite(&mInternals);
+
+											// Compact matching items out
+											CArray::ItemIndex	keepCount = 0;
+											for (CArray::ItemIndex i = 0; i < mInternals->mCount; i++) {
+												// Check if keeping
+												if (!isMatchProc(mInternals->mItems[i], userData)) {
+													// Keep
+													if (keepCount != i)
+														// Move down
+														mInternals->mItems[keepCount] = std::move(mInternals->mItems[i]);
+													keepCount++;
+												}
+											}
+
+											// Destroy the rest
+											while (mInternals->mCount > keepCount)
+												// Destroy
+												mInternals->mItems[--mInternals->mCount].~T();
+
+											return *this;
+										}
+				TVArray<T>&			removeAtIndex(CArray::ItemIndex itemIndex)
+										{
+											// Remove
+											Internals::prepareForWrite(&mInternals);
+											mInternals->removeAtIndex(itemIndex);
+
+											return *this;
+										}
+				TVArray<T>&			removeAll()
+										{
+											// Start fresh
+											mInternals->removeReference();
+											mInternals = new Internals(0);
+
+											return *this;
+										}
+				T					popFirst()
+										{
+											// Get first item
+											T	item = getFirst();
+
+											// Remove
+											removeAtIndex(0);
+
+											return item;
+										}
+
+				TVArray<T>&			apply(ApplyProc applyProc, void* userData = nil)
+										{
+											// Setup
+											Internals::prepareForWrite(&mInternals);
+
+											// Iterate all items
+											for (CArray::ItemIndex i = 0; i < mInternals->mCount; i++)
+												// Call proc
+												applyProc(mInternals->mItems[i], userData);
+
+											return *this;
+										}
+				TVArray<T>&			sort(CompareProc compareProc, void* userData = nil,
+											CArray::SortOptions sortOptions = CArray::kSortOptionsNone)
+										{ return sortUsing(SortCompare(compareProc, userData), sortOptions); }
+										template <typename C>
+				TVArray<T>&			sortUsing(const C& compare,
+											CArray::SortOptions sortOptions = CArray::kSortOptionsNone)
+										{
+											// Setup
+											Internals::prepareForWrite(&mInternals);
+
+											// Sort
+											if (sortOptions & CArray::kSortOptionsStable)
+												// Stable
+												TSort<T>::stableSort(mInternals->mItems, mInternals->mCount, compare);
+											else
+												// Fastest
+												TSort<T>::sort(mInternals->mItems, mInternals->mCount, compare);
+
+											return *this;
+										}
+				TVArray<T>			sorted(CompareProc compareProc, void* userData = nil,
+											CArray::SortOptions sortOptions = CArray::kSortOptionsNone) const
+										{
+											// Make a copy
+											TVArray<T>	array(*this);
+
+											// Sort
+											array.sort(compareProc, userData, sortOptions);
+
+											return array;
+										}
+				TVArray<T>			filtered(IsMatchProc isMatchProc, void* userData = nil) const
+										{
+											// Setup
+											TVArray<T>	array;
+
+											// Iterate all items
+											for (CArray::ItemIndex i = 0; i < mInternals->mCount; i++) {
+												// Check if match
+												const	T&	item = mInternals->mItems[i];
+												if (isMatchProc(item, userData))
+													// Match
+													array.mInternals->add(item);
+											}
+
+											return array;
+										}
+
+				TNArray<T>			getTArray() const
+										{
+											// Setup
+											TNArray<T>	array;
+
+											// Iterate all items
+											for (CArray::ItemIndex i = 0; i < mInternals->mCount; i++)
+												// Add
+												array += mInternals->mItems[i];
+
+											return array;
+										}
+
+				Iterator			getIterator() const
+										{ return Iterator(*mInternals); }
+
+				const	T&			operator[](CArray::ItemIndex itemIndex) const
+										{ return mInternals->mItems[itemIndex]; }
+				TVArray<T>&			operator=(const TVArray<T>& other)
+										{
+											// Check for same
+											if (this == &other)
+												return *this;
+
+											// Update
+											mInternals->removeReference();
+											mInternals = other.mInternals->addReference();
+
+											return *this;
+										}
+				TVArray<T>&			operator=(TVArray<T>&& other)
+										{
+											// Swap
+											std::swap(mInternals, other.mInternals);
+
+											return *this;
+										}
+				TVArray<T>&			operator+=(const T& item)
+										{ return add(item); }
+				TVArray<T>&			operator+=(T&& item)
+										{ return add(std::move(item)); }
+				TVArray<T>&			operator+=(const TVArray<T>& other)
+										{ return addFrom(other); }
+				bool				operator==(const TVArray<T>& other) const
+										{
+											// Check count
+											if (mInternals->mCount != other.mInternals->mCount)
+												// Nope
+												return false;
+
+											// Iterate all items
+											for (CArray::ItemIndex i = 0; i < mInternals->mCount; i++) {
+												// Check if equal
+												if (!(mInternals->mItems[i] == other.mInternals->mItems[i]))
+													// Nope
+													return false;
+											}
+
+											return true;
+										}
+				bool				operator!=(const TVArray<T>& other) const
+										{ return !(*this == other); }
+
+	// Properties
+	private:
+		Internals*	mInternals;
+};
@@ -8,60 +8,115 @@
 #include "CReferenceCountable.h"
 
 //----------------------------------------------------------------------------------------------------------------------
-// MARK: CBits::Internals
+// MARK: Local proc declarations
+
+static	UInt32	sCountSet(UInt64 value);
+static	UInt64	sMaskFrom(UInt32 bitIndex);
+
+//----------------------------------------------------------------------------------------------------------------------
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - CBits::Internals
+//	Bits are stored 64 to a word, with bit i in word i / 64 at bit i % 64.  Bits at and after mUsed are always clear
+//		so counts and searches can work a whole word at a time.
 
 class CBits::Internals : public TCopyOnWriteReferenceCountable<Internals> {
 	public:
 				Internals(UInt32 count, bool initialValue) :
-					TCopyOnWriteReferenceCountable(), mUsed(count)
+					TCopyOnWriteReferenceCountable(), mWordCount((count + 63) / 64), mUsed(count)
 					{
 						// Setup
-						UInt32	bytes = (count + 7) / 8;
-						mAvailable = bytes * 8;
-						mStorage = (UInt8*) ::calloc(bytes, 1);
+						mWords = (UInt64*) ::calloc(std::max<UInt32>(mWordCount, 1), sizeof(UInt64));
 
 						// Check initial value
 						if (initialValue)
 							// Set all bits
-							::memset(mStorage, 0xFF, mUsed / 8);
+							set(0, count, true);
 					}
 				Internals(UInt32 count, const CData& data) :
-					TCopyOnWriteReferenceCountable(), mUsed(count)
+					TCopyOnWriteReferenceCountable(), mWordCount((UInt32) ((data.getByteCount() + 7) / 8)),
+							mUsed(count)
 					{
 						// Setup
-						mAvailable = (UInt32) data.getByteCount() * 8;
-						mStorage = (UInt8*) ::malloc(mAvailable);
-						data.copyBytes(mStorage);
+						mWordCount = std::max<UInt32>(mWordCount, (count + 63) / 64);
+						mWords = (UInt64*) ::calloc(std::max<UInt32>(mWordCount, 1), sizeof(UInt64));
+						data.copyBytes(mWords);
+
+						// Storage is little endian
+						for (UInt32 i = 0; i < mWordCount; i++)
+							// Convert
+							mWords[i] = EndianU64_LtoN(mWords[i]);
+						clearUnused();
+					}
+				Internals(const Internals& other) :
+					TCopyOnWriteReferenceCountable(), mWordCount(other.mWordCount), mUsed(other.mUsed)
+					{
+						// Copy
+						mWords = (UInt64*) ::malloc(std::max<UInt32>(mWordCount, 1) * sizeof(UInt64));
+						::memcpy(mWords, other.mWords, mWordCount * sizeof(UInt64));
 					}
 				~Internals()
 					{
-						free(mStorage);
+						free(mWords);
 					}
 
-		void	set(UInt32 index, bool value)
+		void	setCount(UInt32 count)
 					{
 						// Update storage if necessary
-						if (index >= mAvailable) {
-							// Resize
-							UInt32	bytes = (index + 8) / 8;
-							mAvailable = bytes * 8;
-							mStorage = (UInt8*) ::realloc(mStorage, bytes);
+						UInt32	wordCount = (count + 63) / 64;
+						if (wordCount > mWordCount) {
+							// Grow by at least half again so setting bits one after another stays linear
+							wordCount = std::max<UInt32>(wordCount, mWordCount + mWordCount / 2);
+							mWords = (UInt64*) ::realloc(mWords, wordCount * sizeof(UInt64));
+							::memset(mWords + mWordCount, 0, (wordCount - mWordCount) * sizeof(UInt64));
+							mWordCount = wordCount;
 						}
 
-						// Setup
-						UInt32	byteIndex = index / 8;
-						UInt32	bitIndex = index % 8;
-
-						if (value)
-							// Set
-							mStorage[byteIndex] |= 1 << bitIndex;
-						else
-							// Clear
-							mStorage[byteIndex] &= ~(1 << bitIndex);
+						// Update
+						mUsed = count;
+						clearUnused();
+					}
+		void	set(UInt32 index, UInt32 count, bool value)
+					{
+						// Update count if necessary
+						if ((index + count) > mUsed)
+							// Grow
+							setCount(index + count);
+
+						// Iterate words
+						while (count > 0) {
+							// Setup mask for the bits in this word
+							UInt32	wordIndex = index / 64;
+							UInt32	bitIndex = index % 64;
+							UInt32	bitCount = std::min<UInt32>(64 - bitIndex, count);
+							UInt64	mask = (bitCount == 64) ? ~0ULL : (((1ULL << bitCount) - 1) << bitIndex);
+
+							// Update
+							if (value)
+								// Set
+								mWords[wordIndex] |= mask;
+							else
+								// Clear
+								mWords[wordIndex] &= ~mask;
+
+							// Next
+							index += bitCount;
+							count -= bitCount;
+						}
+					}
+		void	clearUnused()
+					{
+						// Clear bits at and after mUsed in the last used word and all words after
+						UInt32	usedWordCount = (mUsed + 63) / 64;
+						if ((mUsed % 64) != 0)
+							// Clear partial word
+							mWords[usedWordCount - 1] &= ~sMaskFrom(mUsed % 64);
+						if (usedWordCount < mWordCount)
+							// Clear whole words
+							::memset(mWords + usedWordCount, 0, (mWordCount - usedWordCount) * sizeof(UInt64));
 					}
 
-		UInt8*	mStorage;
-		UInt32	mAvailable;
+		UInt64*	mWords;
+		UInt32	mWordCount;
 		UInt32	mUsed;
 };
 
@@ -114,10 +169,12 @@ UInt32 CBits::getCount() const
 bool CBits::get(UInt32 index) const
 //----------------------------------------------------------------------------------------------------------------------
 {
-	UInt32	byteIndex = index / 8;
-	UInt32	bitIndex = index % 8;
+	// Check index
+	if (index >= mInternals->mUsed)
+		// Past the end
+		return false;
 
-	return mInternals->mStorage[byteIndex] & (1 << bitIndex);
+	return (mInternals->mWords[index / 64] & (1ULL << (index % 64))) != 0;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -125,7 +182,103 @@ CBits& CBits::set(UInt32 index, bool value)
 //----------------------------------------------------------------------------------------------------------------------
 {
 	// Set
-	mInternals->set(index, value);
+	Internals::prepareForWrite(&mInternals);
+	mInternals->set(index, 1, value);
+
+	return *this;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CBits& CBits::set(UInt32 index, UInt32 count, bool value)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Check count
+	if (count == 0)
+		return *this;
+
+	// Set
+	Internals::prepareForWrite(&mInternals);
+	mInternals->set(index, count, value);
+
+	return *this;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+UInt32 CBits::getSetCount() const
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Count across used words
+	UInt32	count = 0;
+	for (UInt32 i = 0, wordCount = (mInternals->mUsed + 63) / 64; i < wordCount; i++)
+		// Count
+		count += sCountSet(mInternals->mWords[i]);
+
+	return count;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+OV<UInt32> CBits::getNextSet(UInt32 index) const
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Check index
+	if (index >= mInternals->mUsed)
+		// Past the end
+		return OV<UInt32>();
+
+	// Check first word, ignoring bits before index, then whole words
+	UInt32	wordIndex = index / 64;
+	UInt32	wordCount = (mInternals->mUsed + 63) / 64;
+	UInt64	word = mInternals->mWords[wordIndex] & sMaskFrom(index % 64);
+	while (word == 0) {
+		// Next word
+		if (++wordIndex == wordCount)
+			// No more set bits
+			return OV<UInt32>();
+		word = mInternals->mWords[wordIndex];
+	}
+
+	return OV<UInt32>(wordIndex * 64 + countTrailingZeros(word));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+OV<UInt32> CBits::getNextClear(UInt32 index) const
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Check index
+	if (index >= mInternals->mUsed)
+		// Past the end
+		return OV<UInt32>();
+
+	// Check first word, ignoring bits before index, then whole words
+	UInt32	wordIndex = index / 64;
+	UInt32	wordCount = (mInternals->mUsed + 63) / 64;
+	UInt64	word = ~mInternals->mWords[wordIndex] & sMaskFrom(index % 64);
+	while (word == 0) {
+		// Next word
+		if (++wordIndex == wordCount)
+			// No more clear bits
+			return OV<UInt32>();
+		word = ~mInternals->mWords[wordIndex];
+	}
+
+	// Unused bits in the last word are clear in storage, so check the bit found is used
+	UInt32	foundIndex = wordIndex * 64 + countTrailingZeros(word);
+
+	return (foundIndex < mInternals->mUsed) ? OV<UInt32>(foundIndex) : OV<UInt32>();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CBits& CBits::invert()
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Prepare to write
+	Internals::prepareForWrite(&mInternals);
+
+	// Invert used words
+	for (UInt32 i = 0, wordCount = (mInternals->mUsed + 63) / 64; i < wordCount; i++)
+		// Invert
+		mInternals->mWords[i] = ~mInternals->mWords[i];
+	mInternals->clearUnused();
 
 	return *this;
 }
@@ -134,10 +287,16 @@ CBits& CBits::set(UInt32 index, bool value)
 CDictionary CBits::getStorageInfo() const
 //----------------------------------------------------------------------------------------------------------------------
 {
+	// Setup
+	UInt32			wordCount = (mInternals->mUsed + 63) / 64;
+	TBuffer<UInt64>	words(wordCount);
+	for (UInt32 i = 0; i < wordCount; i++)
+		// Storage is little endian
+		words[i] = EndianU64_NtoL(mInternals->mWords[i]);
+
 	// Compose Storage info
 	CDictionary	storageInfo;
-	storageInfo.set(CString(OSSTR("data")),
-			CData(mInternals->mStorage, mInternals->mAvailable / 8, false).getBase64String());
+	storageInfo.set(CString(OSSTR("data")), CData(*words, wordCount * sizeof(UInt64), false).getBase64String());
 	storageInfo.set(CString(OSSTR("used")), mInternals->mUsed);
 
 	return storageInfo;
@@ -153,3 +312,86 @@ CBits& CBits::operator=(const CBits& other)
 
 	return *this;
 }
+
+//----------------------------------------------------------------------------------------------------------------------
+CBits& CBits::operator&=(const CBits& other)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Prepare to write
+	Internals::prepareForWrite(&mInternals);
+
+	// Combine words in both, and clear words only here
+	UInt32	wordCount = (mInternals->mUsed + 63) / 64;
+	UInt32	otherWordCount = std::min<UInt32>((other.mInternals->mUsed + 63) / 64, wordCount);
+	for (UInt32 i = 0; i < otherWordCount; i++)
+		// And
+		mInternals->mWords[i] &= other.mInternals->mWords[i];
+	if (otherWordCount < wordCount)
+		// Clear
+		::memset(mInternals->mWords + otherWordCount, 0, (wordCount - otherWordCount) * sizeof(UInt64));
+
+	return *this;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CBits& CBits::operator|=(const CBits& other)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Prepare to write
+	Internals::prepareForWrite(&mInternals);
+	if (other.mInternals->mUsed > mInternals->mUsed)
+		// Grow
+		mInternals->setCount(other.mInternals->mUsed);
+
+	// Combine words in other
+	for (UInt32 i = 0, wordCount = (other.mInternals->mUsed + 63) / 64; i < wordCount; i++)
+		// Or
+		mInternals->mWords[i] |= other.mInternals->mWords[i];
+
+	return *this;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CBits& CBits::operator^=(const CBits& other)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Prepare to write
+	Internals::prepareForWrite(&mInternals);
+	if (other.mInternals->mUsed > mInternals->mUsed)
+		// Grow
+		mInternals->setCount(other.mInternals->mUsed);
+
+	// Combine words in other
+	for (UInt32 i = 0, wordCount = (other.mInternals->mUsed + 63) / 64; i < wordCount; i++)
+		// Exclusive or
+		mInternals->mWords[i] ^= other.mInternals->mWords[i];
+
+	return *this;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - Local proc definitions
+
+//----------------------------------------------------------------------------------------------------------------------
+UInt32 sCountSet(UInt64 value)
+//----------------------------------------------------------------------------------------------------------------------
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+	// Count in parallel
+	value = value - ((value >> 1) & 0x5555555555555555ULL);
+	value = (value & 0x3333333333333333ULL) + ((value >> 2) & 0x3333333333333333ULL);
+	value = (value + (value >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+
+	return (UInt32) ((value * 0x0101010101010101ULL) >> 56);
+#else
+	return (UInt32) __builtin_popcountll(value);
+#endif
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+UInt64 sMaskFrom(UInt32 bitIndex)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	return ~0ULL << bitIndex;
+}
@@ -4,7 +4,11 @@
 
 #pragma once
 
-#include "PlatformDefinitions.h"
+#include "TWrappers.h"
+
+#if defined(_MSC_VER) && !defined(__clang__)
+	#include <intrin.h>
+#endif
 
 //----------------------------------------------------------------------------------------------------------------------
 // MARK: CBits
@@ -18,24 +22,55 @@ class CBits {
 
 	// Methods
 	public:
-					// Lifecycle methods
-					CBits(UInt32 count = 8, bool initialValue = false);
-					CBits(const CDictionary& storageInfo);
-					CBits(const CBits& other);
-					~CBits();
-
-					// Instance methods
-		UInt32		getCount() const;
-		bool		get(UInt32 index) const;
-		CBits&		set(UInt32 index, bool value = true);
-		CBits&		clear(UInt32 index)
-						{ return set(index, false); }
-
-		CDictionary	getStorageInfo() const;
-
-		CBits&		operator=(const CBits& other);
-		bool		operator[](UInt32 index)
-						{ return get(index); }
+							// Lifecycle methods
+							CBits(UInt32 count = 8, bool initialValue = false);
+							CBits(const CDictionary& storageInfo);
+							CBits(const CBits& other);
+							~CBits();
+
+							// Instance methods
+				UInt32		getCount() const;
+				bool		get(UInt32 index) const;
+				CBits&		set(UInt32 index, bool value = true);
+				CBits&		clear(UInt32 index)
+								{ return set(index, false); }
+				CBits&		set(UInt32 index, UInt32 count, bool value);
+				CBits&		clear(UInt32 index, UInt32 count)
+								{ return set(index, count, false); }
+
+				UInt32		getSetCount() const;
+				OV<UInt32>	getNextSet(UInt32 index = 0) const;
+				OV<UInt32>	getNextClear(UInt32 index = 0) const;
+
+				CBits&		invert();
+
+				CDictionary	getStorageInfo() const;
+
+				CBits&		operator=(const CBits& other);
+				bool		operator[](UInt32 index)
+								{ return get(index); }
+							// Bits past the end of the shorter one are treated as clear.  The count becomes the larger
+							//	count, except for &= which keeps this count.
+				CBits&		operator&=(const CBits& other);
+				CBits&		operator|=(const CBits& other);
+				CBits&		operator^=(const CBits& other);
+
+							// Class methods
+							// Index of the lowest set bit.  value must not be 0.
+		static	UInt32		countTrailingZeros(UInt64 value)
+								{
+#if defined(_MSC_VER) && !defined(__clang__)
+									// Scan each half
+									unsigned	long	index;
+									if (_BitScanForward(&index, (unsigned long) value))
+										return (UInt32) index;
+									_BitScanForward(&index, (unsigned long) (value >> 32));
+
+									return (UInt32) index + 32;
+#else
+									return (UInt32) __builtin_ctzll(value);
+#endif
+								}
 
 	// Properties
 	private:
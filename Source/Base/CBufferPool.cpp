@@ -0,0 +1,197 @@
+//----------------------------------------------------------------------------------------------------------------------
+//	CBufferPool.cpp			©2026 Stevo Brock	All rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+
+#include "CBufferPool.h"
+
+#include "ConcurrencyPrimitives.h"
+#include "CppToolboxAssert.h"
+
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: Local data
+
+// Size classes are powers of two from 256 bytes to 16 MiB.  Each buffer is preceded by a header the size of the
+//	alignment that records its size class, so deallocate() needs only the pointer.
+static	const	UInt32	kSizeClassMinimumShift = 8;
+static	const	UInt32	kSizeClassCount = 17;
+static	const	UInt32	kSizeClassNone = ~((UInt32) 0);
+
+struct SHeader {
+	UInt32		mSizeClassIndex;
+	SHeader*	mNext;
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - Local procs
+
+//----------------------------------------------------------------------------------------------------------------------
+static SHeader* sNewBlock(size_t byteCount)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Allocate
+#if defined(TARGET_OS_WINDOWS)
+	SHeader*	header = (SHeader*) ::_aligned_malloc(CBufferPool::kAlignment + byteCount, CBufferPool::kAlignment);
+#else
+	void*		ptr = nil;
+	SHeader*	header =
+						(::posix_memalign(&ptr, CBufferPool::kAlignment, CBufferPool::kAlignment + byteCount) == 0) ?
+								(SHeader*) ptr : nil;
+#endif
+	AssertNotNil(header);
+
+	return header;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+static void sDeleteBlock(SHeader* header)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Free
+#if defined(TARGET_OS_WINDOWS)
+	::_aligned_free(header);
+#else
+	::free(header);
+#endif
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+static UInt32 sSizeClassIndex(size_t byteCount)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Find the smallest size class that fits
+	for (UInt32 i = 0; i < kSizeClassCount; i++) {
+		// Check size class
+		if (byteCount <= ((size_t) 1 << (kSizeClassMinimumShift + i)))
+			// Found
+			return i;
+	}
+
+	return kSizeClassNone;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - CBufferPoolDepot
+
+class CBufferPoolDepot {
+	public:
+							CBufferPoolDepot()
+								{
+									// Setup
+									for (UInt32 i = 0; i < kSizeClassCount; i++) {
+										// Setup
+										mFreeHeaders[i] = nil;
+										mFreeHeaderCounts[i] = 0;
+									}
+								}
+
+				SHeader*	take(UInt32 sizeClassIndex)
+								{
+									// Lock
+									mLocks[sizeClassIndex].lock();
+
+									// Detach first free header
+									SHeader*	header = mFreeHeaders[sizeClassIndex];
+									if (header != nil) {
+										// Update
+										mFreeHeaders[sizeClassIndex] = header->mNext;
+										mFreeHeaderCounts[sizeClassIndex]--;
+									}
+
+									// Unlock
+									mLocks[sizeClassIndex].unlock();
+
+									return header;
+								}
+				bool		put(SHeader* header)
+								{
+									// Setup
+									UInt32	sizeClassIndex = header->mSizeClassIndex;
+									UInt32	maximumHeaderCount =
+													(UInt32) std::max<size_t>(
+															CBufferPool::kMaximumPooledByteCount >>
+																	(kSizeClassMinimumShift + sizeClassIndex),
+															1);
+
+									// Lock
+									mLocks[sizeClassIndex].lock();
+
+									// Attach if there is room
+									bool	attached = mFreeHeaderCounts[sizeClassIndex] < maximumHeaderCount;
+									if (attached) {
+										// Update
+										header->mNext = mFreeHeaders[sizeClassIndex];
+										mFreeHeaders[sizeClassIndex] = header;
+										mFreeHeaderCounts[sizeClassIndex]++;
+									}
+
+									// Unlock
+									mLocks[sizeClassIndex].unlock();
+
+									return attached;
+								}
+
+		static	CBufferPoolDepot&	shared()
+										{
+											// Created on first use so buffers allocated by other static
+											//	initializers are served
+											static	CBufferPoolDepot*	sBufferPoolDepot = new CBufferPoolDepot();
+
+											return *sBufferPoolDepot;
+										}
+
+	private:
+		CLock		mLocks[kSizeClassCount];
+		SHeader*	mFreeHeaders[kSizeClassCount];
+		UInt32		mFreeHeaderCounts[kSizeClassCount];
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - CBufferPool
+
+// MARK: Class methods
+
+//----------------------------------------------------------------------------------------------------------------------
+void* CBufferPool::allocate(size_t byteCount)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Setup
+	UInt32	sizeClassIndex = sSizeClassIndex(byteCount);
+
+	// Check size class
+	SHeader*	header;
+	if (sizeClassIndex != kSizeClassNone) {
+		// Reuse a free buffer if available
+		header = CBufferPoolDepot::shared().take(sizeClassIndex);
+		if (header == nil) {
+			// Allocate the full size class so it can be reused for any request in this size class
+			header = sNewBlock((size_t) 1 << (kSizeClassMinimumShift + sizeClassIndex));
+			header->mSizeClassIndex = sizeClassIndex;
+		}
+	} else {
+		// Too large to pool
+		header = sNewBlock(byteCount);
+		header->mSizeClassIndex = kSizeClassNone;
+	}
+
+	return (UInt8*) header + kAlignment;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void CBufferPool::deallocate(void* ptr)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Check for nil
+	if (ptr == nil)
+		return;
+
+	// Setup
+	SHeader*	header = (SHeader*) ((UInt8*) ptr - kAlignment);
+
+	// Return to pool if possible
+	if ((header->mSizeClassIndex == kSizeClassNone) || !CBufferPoolDepot::shared().put(header))
+		// Free
+		sDeleteBlock(header);
+}
@@ -0,0 +1,28 @@
+//----------------------------------------------------------------------------------------------------------------------
+//	CBufferPool.h			©2026 Stevo Brock	All rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include "PlatformDefinitions.h"
+
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: CBufferPool
+//	CBufferPool serves large, 64-byte aligned buffers whose contents are not initialized.  Requests are rounded up to
+//		a power of two size class, and freed buffers are kept on a locked per-size-class list for reuse so a steady
+//		stream of same-sized buffers (media packets, audio frames) stops allocating after the first few.  Each size
+//		class keeps at most kMaximumPooledByteCount bytes of free buffers; requests larger than the largest size class
+//		are not pooled.
+
+class CBufferPool {
+	// Methods
+	public:
+								// Class methods
+		static	void*			allocate(size_t byteCount);
+		static	void			deallocate(void* ptr);
+
+	// Properties
+	public:
+		static	const	size_t	kAlignment = 64;
+		static	const	size_t	kMaximumPooledByteCount = 32 * 1024 * 1024;
+};
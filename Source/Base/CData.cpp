@@ -4,33 +4,679 @@
 
 #include "CData.h"
 
+#include "CArray.h"
+#include "CBits.h"
 #include "CppToolboxAssert.h"
 #include "CReferenceCountable.h"
+#include "CSlabAllocator.h"
 #include "CString.h"
 #include "TBuffer.h"
 
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+	#define CDataUseSSSE3
+	#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+		#define CDataUseSSE2
+	#endif
+
+	#include <tmmintrin.h>
+
+	#if defined(_MSC_VER) && !defined(__clang__)
+		#include <intrin.h>
+
+		#define CDataTargetSSSE3
+	#else
+		#define CDataTargetSSSE3	__attribute__((target("ssse3")))
+	#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+	#define CDataUseNEON
+
+	#include <arm_neon.h>
+#endif
+
 //----------------------------------------------------------------------------------------------------------------------
 // MARK: Local data
 
 const	CData	CData::mEmpty(0);
 const	CData	CData::mZeroByte("", 1, false);
 
+//----------------------------------------------------------------------------------------------------------------------
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - Codec procs
+//	Base64 and hex conversion run 16 (SSSE3) or 64 (NEON) characters at a time where the CPU supports it.  SSSE3 is
+//		checked for at runtime; NEON is always present on arm64.  Whatever is left over, and any base64 block holding
+//		characters outside the standard alphabet, goes through the scalar tables so the results are identical.
+
+// From http://web.mit.edu/freebsd/head/contrib/wpa/src/utils/base64.c
+static	const	char	sBase64Table[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+// From https://stackoverflow.com/questions/180947/base64-decode-snippet-in-c/13935718
+static	const	UInt8	sBase64Map[256] =
+								{
+									0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+									0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+									0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  62, 63, 62, 62, 63,
+									52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 0,  0,  0,  0,  0,  0,
+									0,  0,  1,  2,  3,  4,  5,  6,  7,  8,  9,  10, 11, 12, 13, 14,
+									15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 0,  0,  0,  0,  63,
+									0,  26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,
+									41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51,
+								};
+static	const	char	sHexTableLowercase[] =
+								{'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'};
+static	const	char	sHexTableUppercase[] =
+								{'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F'};
+
+static	const	UInt32	kBase64LineLength = 72;
+
+#if defined(CDataUseSSSE3)
+//----------------------------------------------------------------------------------------------------------------------
+static bool sQueryHaveSSSE3()
+//----------------------------------------------------------------------------------------------------------------------
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+	// Query CPU
+	int	info[4];
+	__cpuid(info, 1);
+
+	return (info[2] & (1 << 9)) != 0;
+#else
+	return __builtin_cpu_supports("ssse3");
+#endif
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+static bool sHaveSSSE3()
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Check once
+	static	bool	sHave = sQueryHaveSSSE3();
+
+	return sHave;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CDataTargetSSSE3 static UInt64 sEncodeBase64GroupsSSSE3(const UInt8* bytePtr, UInt64 groupCount, char* charPtr)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Setup
+	const	__m128i	shuffle = _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1);
+	const	__m128i	shiftLUT =
+							_mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+									'0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+
+	// Encode 4 groups at a time.  Each pass reads 16 bytes, so stop while there are still 2 groups beyond the 4.
+	UInt64	encodedGroupCount = 0;
+	for (; (groupCount - encodedGroupCount) >= 6; encodedGroupCount += 4, bytePtr += 12, charPtr += 16) {
+		// Split 12 bytes into 16 6-bit indexes
+		__m128i	bytes = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*) bytePtr), shuffle);
+		__m128i	indexes =
+						_mm_or_si128(
+								_mm_mulhi_epu16(_mm_and_si128(bytes, _mm_set1_epi32(0x0fc0fc00)),
+										_mm_set1_epi32(0x04000040)),
+								_mm_mullo_epi16(_mm_and_si128(bytes, _mm_set1_epi32(0x003f03f0)),
+										_mm_set1_epi32(0x01000010)));
+
+		// Translate indexes to characters
+		__m128i	reduced = _mm_subs_epu8(indexes, _mm_set1_epi8(51));
+		reduced =
+				_mm_or_si128(reduced,
+						_mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), indexes), _mm_set1_epi8(13)));
+		_mm_storeu_si128((__m128i*) charPtr, _mm_add_epi8(_mm_shuffle_epi8(shiftLUT, reduced), indexes));
+	}
+
+	return encodedGroupCount;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CDataTargetSSSE3 static UInt64 sDecodeBase64QuadsSSSE3(const char* charPtr, UInt64 quadCount, UInt8* bytePtr)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Setup
+	const	__m128i	lutLo =
+							_mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A,
+									0x1B, 0x1B, 0x1B, 0x1A);
+	const	__m128i	lutHi =
+							_mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10,
+									0x10, 0x10, 0x10, 0x10);
+	const	__m128i	lutRoll = _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+	const	__m128i	nibbleMask = _mm_set1_epi8(0x0f);
+	const	__m128i	slash = _mm_set1_epi8('/');
+	const	__m128i	shuffle = _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+
+	// Decode 4 quads at a time.  Each pass writes 16 bytes, so stop while there are still 2 quads beyond the 4.
+	UInt64	decodedQuadCount = 0;
+	for (; (quadCount - decodedQuadCount) >= 6; decodedQuadCount += 4, charPtr += 16, bytePtr += 12) {
+		// Classify characters
+		__m128i	chars = _mm_loadu_si128((const __m128i*) charPtr);
+		__m128i	hiNibbles = _mm_and_si128(_mm_srli_epi32(chars, 4), nibbleMask);
+		__m128i	loNibbles = _mm_and_si128(chars, nibbleMask);
+		if (_mm_movemask_epi8(
+				_mm_cmpgt_epi8(
+						_mm_and_si128(_mm_shuffle_epi8(lutLo, loNibbles), _mm_shuffle_epi8(lutHi, hiNibbles)),
+						_mm_setzero_si128())) != 0)
+			// Not all standard alphabet
+			break;
+
+		// Translate characters to 6-bit values
+		__m128i	roll = _mm_shuffle_epi8(lutRoll, _mm_add_epi8(_mm_cmpeq_epi8(chars, slash), hiNibbles));
+		__m128i	values = _mm_add_epi8(chars, roll);
+
+		// Pack 16 6-bit values into 12 bytes
+		__m128i	packed =
+						_mm_madd_epi16(_mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140)),
+								_mm_set1_epi32(0x00011000));
+		_mm_storeu_si128((__m128i*) bytePtr, _mm_shuffle_epi8(packed, shuffle));
+	}
+
+	return decodedQuadCount;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CDataTargetSSSE3 static UInt64 sEncodeHexSSSE3(const UInt8* bytePtr, UInt64 byteCount, char* charPtr,
+		const char* table)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Setup
+	const	__m128i	tableVector = _mm_loadu_si128((const __m128i*) table);
+	const	__m128i	nibbleMask = _mm_set1_epi8(0x0f);
+
+	// Encode 16 bytes at a time
+	UInt64	encodedByteCount = 0;
+	for (; (byteCount - encodedByteCount) >= 16; encodedByteCount += 16, bytePtr += 16, charPtr += 32) {
+		// Split into nibbles and translate
+		__m128i	bytes = _mm_loadu_si128((const __m128i*) bytePtr);
+		__m128i	hiChars = _mm_shuffle_epi8(tableVector, _mm_and_si128(_mm_srli_epi16(bytes, 4), nibbleMask));
+		__m128i	loChars = _mm_shuffle_epi8(tableVector, _mm_and_si128(bytes, nibbleMask));
+
+		// Interleave
+		_mm_storeu_si128((__m128i*) charPtr, _mm_unpacklo_epi8(hiChars, loChars));
+		_mm_storeu_si128((__m128i*) (charPtr + 16), _mm_unpackhi_epi8(hiChars, loChars));
+	}
+
+	return encodedByteCount;
+}
+#endif
+
+#if defined(CDataUseNEON)
+//----------------------------------------------------------------------------------------------------------------------
+static UInt64 sEncodeBase64GroupsNEON(const UInt8* bytePtr, UInt64 groupCount, char* charPtr)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Setup
+	uint8x16x4_t	table = vld1q_u8_x4((const uint8_t*) sBase64Table);
+	uint8x16_t		mask = vdupq_n_u8(0x3f);
+
+	// Encode 16 groups at a time
+	UInt64	encodedGroupCount = 0;
+	for (; (groupCount - encodedGroupCount) >= 16; encodedGroupCount += 16, bytePtr += 48, charPtr += 64) {
+		// Split 48 bytes into 64 6-bit indexes
+		uint8x16x3_t	bytes = vld3q_u8(bytePtr);
+		uint8x16x4_t	indexes;
+		indexes.val[0] = vshrq_n_u8(bytes.val[0], 2);
+		indexes.val[1] = vandq_u8(vorrq_u8(vshlq_n_u8(bytes.val[0], 4), vshrq_n_u8(bytes.val[1], 4)), mask);
+		indexes.val[2] = vandq_u8(vorrq_u8(vshlq_n_u8(bytes.val[1], 2), vshrq_n_u8(bytes.val[2], 6)), mask);
+		indexes.val[3] = vandq_u8(bytes.val[2], mask);
+
+		// Translate indexes to characters
+		uint8x16x4_t	chars;
+		chars.val[0] = vqtbl4q_u8(table, indexes.val[0]);
+		chars.val[1] = vqtbl4q_u8(table, indexes.val[1]);
+		chars.val[2] = vqtbl4q_u8(table, indexes.val[2]);
+		chars.val[3] = vqtbl4q_u8(table, indexes.val[3]);
+		vst4q_u8((uint8_t*) charPtr, chars);
+	}
+
+	return encodedGroupCount;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+static UInt64 sDecodeBase64QuadsNEON(const char* charPtr, UInt64 quadCount, UInt8* bytePtr)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Setup.  The map covers the standard alphabet, with 0xFF marking everything else.
+	static	const	UInt8	sStandardMap[128] =
+									{
+										0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+										0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+										0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+										0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+										0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+										0xFF, 0xFF, 0xFF, 0x3E, 0xFF, 0xFF, 0xFF, 0x3F,
+										0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B,
+										0x3C, 0x3D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+										0xFF, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+										0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+										0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
+										0x17, 0x18, 0x19, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+										0xFF, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20,
+										0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+										0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30,
+										0x31, 0x32, 0x33, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+									};
+
+	uint8x16x4_t	tableLo = vld1q_u8_x4(sStandardMap);
+	uint8x16x4_t	tableHi = vld1q_u8_x4(sStandardMap + 64);
+	uint8x16_t		offset = vdupq_n_u8(64);
+	uint8x16_t		highBit = vdupq_n_u8(0x80);
+
+	// Decode 16 quads at a time
+	UInt64	decodedQuadCount = 0;
+	for (; (quadCount - decodedQuadCount) >= 16; decodedQuadCount += 16, charPtr += 64, bytePtr += 48) {
+		// Translate characters to 6-bit values
+		uint8x16x4_t	chars = vld4q_u8((const uint8_t*) charPtr);
+		uint8x16x4_t	values;
+		uint8x16_t		invalid = vdupq_n_u8(0);
+		for (int i = 0; i < 4; i++) {
+			// Look up in both halves of the table
+			values.val[i] =
+					vqtbx4q_u8(vqtbl4q_u8(tableLo, chars.val[i]), tableHi, vsubq_u8(chars.val[i], offset));
+			invalid = vorrq_u8(invalid, vorrq_u8(values.val[i], vandq_u8(chars.val[i], highBit)));
+		}
+		if (vmaxvq_u8(invalid) > 63)
+			// Not all standard alphabet
+			break;
+
+		// Pack 64 6-bit values into 48 bytes
+		uint8x16x3_t	bytes;
+		bytes.val[0] = vorrq_u8(vshlq_n_u8(values.val[0], 2), vshrq_n_u8(values.val[1], 4));
+		bytes.val[1] = vorrq_u8(vshlq_n_u8(values.val[1], 4), vshrq_n_u8(values.val[2], 2));
+		bytes.val[2] = vorrq_u8(vshlq_n_u8(values.val[2], 6), values.val[3]);
+		vst3q_u8(bytePtr, bytes);
+	}
+
+	return decodedQuadCount;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+static UInt64 sEncodeHexNEON(const UInt8* bytePtr, UInt64 byteCount, char* charPtr, const char* table)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Setup
+	uint8x16_t	tableVector = vld1q_u8((const uint8_t*) table);
+	uint8x16_t	nibbleMask = vdupq_n_u8(0x0f);
+
+	// Encode 16 bytes at a time
+	UInt64	encodedByteCount = 0;
+	for (; (byteCount - encodedByteCount) >= 16; encodedByteCount += 16, bytePtr += 16, charPtr += 32) {
+		// Split into nibbles, translate, and interleave
+		uint8x16_t		bytes = vld1q_u8(bytePtr);
+		uint8x16x2_t	chars;
+		chars.val[0] = vqtbl1q_u8(tableVector, vshrq_n_u8(bytes, 4));
+		chars.val[1] = vqtbl1q_u8(tableVector, vandq_u8(bytes, nibbleMask));
+		vst2q_u8((uint8_t*) charPtr, chars);
+	}
+
+	return encodedByteCount;
+}
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------
+static void sEncodeBase64Groups(const UInt8* bytePtr, UInt64 groupCount, char* charPtr)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Encode what we can with SIMD
+	UInt64	encodedGroupCount = 0;
+#if defined(CDataUseSSSE3)
+	if (sHaveSSSE3())
+		encodedGroupCount = sEncodeBase64GroupsSSSE3(bytePtr, groupCount, charPtr);
+#elif defined(CDataUseNEON)
+	encodedGroupCount = sEncodeBase64GroupsNEON(bytePtr, groupCount, charPtr);
+#endif
+	bytePtr += encodedGroupCount * 3;
+	charPtr += encodedGroupCount * 4;
+
+	// Encode the rest 3 bytes to 4 characters at a time
+	for (; encodedGroupCount < groupCount; encodedGroupCount++, bytePtr += 3) {
+		// Convert
+		*charPtr++ = sBase64Table[bytePtr[0] >> 2];
+		*charPtr++ = sBase64Table[((bytePtr[0] & 0x03) << 4) | (bytePtr[1] >> 4)];
+		*charPtr++ = sBase64Table[((bytePtr[1] & 0x0f) << 2) | (bytePtr[2] >> 6)];
+		*charPtr++ = sBase64Table[bytePtr[2] & 0x3f];
+	}
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+static char* sEncodeBase64Lines(const UInt8* bytePtr, UInt64 groupCount, char* charPtr, bool prettyPrint,
+		UInt32& currentLineLength)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Encode, a line at a time if pretty printing
+	while (groupCount > 0) {
+		// Encode
+		UInt64	count =
+						prettyPrint ?
+								std::min<UInt64>(groupCount, (kBase64LineLength - currentLineLength) / 4) : groupCount;
+		sEncodeBase64Groups(bytePtr, count, charPtr);
+
+		// Update
+		bytePtr += count * 3;
+		charPtr += count * 4;
+		groupCount -= count;
+		if (prettyPrint) {
+			// Check for end of line
+			currentLineLength += (UInt32) count * 4;
+			if (currentLineLength == kBase64LineLength) {
+				// Add newline
+				*charPtr++ = '\n';
+				currentLineLength = 0;
+			}
+		}
+	}
+
+	return charPtr;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+static char* sEncodeBase64Final(const UInt8* bytePtr, UInt64 byteCount, char* charPtr, bool prettyPrint,
+		UInt32& currentLineLength)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Check for last 1 or 2 bytes
+	if (byteCount > 0) {
+		// Convert last 1 or 2 bytes
+		*charPtr++ = sBase64Table[bytePtr[0] >> 2];
+		if (byteCount == 1) {
+			// Convert last 1 byte
+			*charPtr++ = sBase64Table[(bytePtr[0] & 0x03) << 4];
+			*charPtr++ = '=';
+			*charPtr++ = '=';
+		} else {
+			// Convert last 2 bytes
+			*charPtr++ = sBase64Table[((bytePtr[0] & 0x03) << 4) | (bytePtr[1] >> 4)];
+			*charPtr++ = sBase64Table[(bytePtr[1] & 0x0f) << 2];
+			*charPtr++ = '=';
+		}
+
+		// Update
+		currentLineLength += 4;
+	}
+
+	if (prettyPrint && (currentLineLength > 0)) {
+		// Add newline
+		*charPtr++ = '\n';
+		currentLineLength = 0;
+	}
+
+	return charPtr;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+static void sDecodeBase64Quads(const char* charPtr, UInt64 quadCount, UInt8* bytePtr)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Decode
+	while (quadCount > 0) {
+		// Decode what we can with SIMD
+		UInt64	count = 0;
+#if defined(CDataUseSSSE3)
+		if (sHaveSSSE3())
+			count = sDecodeBase64QuadsSSSE3(charPtr, quadCount, bytePtr);
+#elif defined(CDataUseNEON)
+		count = sDecodeBase64QuadsNEON(charPtr, quadCount, bytePtr);
+#endif
+		charPtr += count * 4;
+		bytePtr += count * 3;
+		quadCount -= count;
+
+		// Decode the next block (or everything if no SIMD) 4 characters to 3 bytes at a time.  The scalar table
+		//	maps the URL-safe and invalid characters the SIMD pass skips over.
+#if defined(CDataUseSSSE3) || defined(CDataUseNEON)
+		count = std::min<UInt64>(quadCount, 16);
+#else
+		count = quadCount;
+#endif
+		for (UInt64 i = 0; i < count; i++, charPtr += 4) {
+			// Convert
+			UInt32	bytes =
+							(sBase64Map[(UInt8) charPtr[0]] << 18) | (sBase64Map[(UInt8) charPtr[1]] << 12) |
+									(sBase64Map[(UInt8) charPtr[2]] << 6) | sBase64Map[(UInt8) charPtr[3]];
+			*bytePtr++ = (UInt8) (bytes >> 16);
+			*bytePtr++ = bytes >> 8 & 0xFF;
+			*bytePtr++ = bytes & 0xFF;
+		}
+		quadCount -= count;
+	}
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+static void sEncodeHex(const UInt8* bytePtr, UInt64 byteCount, char* charPtr, bool uppercase)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Setup
+	const	char*	table = uppercase ? sHexTableUppercase : sHexTableLowercase;
+
+	// Encode what we can with SIMD
+	UInt64	encodedByteCount = 0;
+#if defined(CDataUseSSSE3)
+	if (sHaveSSSE3())
+		encodedByteCount = sEncodeHexSSSE3(bytePtr, byteCount, charPtr, table);
+#elif defined(CDataUseNEON)
+	encodedByteCount = sEncodeHexNEON(bytePtr, byteCount, charPtr, table);
+#endif
+	bytePtr += encodedByteCount;
+	charPtr += encodedByteCount * 2;
+
+	// Encode the rest
+	for (; encodedByteCount < byteCount; encodedByteCount++, bytePtr++) {
+		// Store
+		*charPtr++ = table[(*bytePtr & 0xF0) >> 4];
+		*charPtr++ = table[*bytePtr & 0x0F];
+	}
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - Search procs
+//	Sub data searches compare the first and last byte of the sub data at 16 positions at a time (SSE2 or NEON) and
+//		only compare the full sub data where both match.  Long sub data uses Boyer-Moore-Horspool instead so the scan
+//		can skip ahead by up to the sub data length.  Multiple sub datas are found in one pass by scanning for any of
+//		their first bytes and then checking each sub data starting with that byte.
+
+static	const	UInt64	kHorspoolMinimumByteCount = 64;
+static	const	UInt32	kFirstOfMaximumCount = 4;
+
+//----------------------------------------------------------------------------------------------------------------------
+static OV<UInt64> sFindBytesFirstLast(const UInt8* bytePtr, UInt64 byteCount, const UInt8* subBytePtr,
+		UInt64 subByteCount)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Setup
+	UInt64	lastOffset = subByteCount - 1;
+	UInt64	positionCount = byteCount - lastOffset;
+	UInt64	position = 0;
+
+#if defined(CDataUseSSE2)
+	// Check 16 positions at a time
+	__m128i	first = _mm_set1_epi8((char) subBytePtr[0]);
+	__m128i	last = _mm_set1_epi8((char) subBytePtr[lastOffset]);
+	for (; (position + 16) <= positionCount; position += 16) {
+		// Find positions where both the first and last bytes match
+		UInt32	mask =
+						(UInt32) _mm_movemask_epi8(
+								_mm_and_si128(
+										_mm_cmpeq_epi8(first, _mm_loadu_si128((const __m128i*) (bytePtr + position))),
+										_mm_cmpeq_epi8(last,
+												_mm_loadu_si128((const __m128i*) (bytePtr + position + lastOffset)))));
+		while (mask != 0) {
+			// Check the bytes between
+			UInt64	candidate = position + CBits::countTrailingZeros(mask);
+			if (::memcmp(bytePtr + candidate + 1, subBytePtr + 1, (size_t) (subByteCount - 2)) == 0)
+				// Found
+				return OV<UInt64>(candidate);
+
+			// Next
+			mask &= mask - 1;
+		}
+	}
+#elif defined(CDataUseNEON)
+	// Check 16 positions at a time
+	uint8x16_t	first = vdupq_n_u8(subBytePtr[0]);
+	uint8x16_t	last = vdupq_n_u8(subBytePtr[lastOffset]);
+	for (; (position + 16) <= positionCount; position += 16) {
+		// Find positions where both the first and last bytes match, as a nibble per position
+		uint8x16_t	matches =
+							vandq_u8(vceqq_u8(first, vld1q_u8(bytePtr + position)),
+									vceqq_u8(last, vld1q_u8(bytePtr + position + lastOffset)));
+		UInt64		mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(matches), 4)), 0);
+		while (mask != 0) {
+			// Check the bytes between
+			UInt32	bitIndex = CBits::countTrailingZeros(mask);
+			UInt64	candidate = position + bitIndex / 4;
+			if (::memcmp(bytePtr + candidate + 1, subBytePtr + 1, (size_t) (subByteCount - 2)) == 0)
+				// Found
+				return OV<UInt64>(candidate);
+
+			// Next
+			mask &= ~(0xFULL << (bitIndex & ~3));
+		}
+	}
+#endif
+
+	// Check remaining positions
+	while (position < positionCount) {
+		// Look for first byte
+		const	UInt8*	ptr =
+								(const UInt8*) ::memchr(bytePtr + position, subBytePtr[0],
+										(size_t) (positionCount - position));
+		if (ptr == nil)
+			// First byte not present in remaining positions
+			return OV<UInt64>();
+
+		// Check if data matches at this position
+		position = ptr - bytePtr;
+		if (::memcmp(ptr, subBytePtr, (size_t) subByteCount) == 0)
+			// Found
+			return OV<UInt64>(position);
+
+		// Start with next byte
+		position++;
+	}
+
+	return OV<UInt64>();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+static OV<UInt64> sFindBytesHorspool(const UInt8* bytePtr, UInt64 byteCount, const UInt8* subBytePtr,
+		UInt64 subByteCount)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Setup skips by the byte under the last position
+	UInt64	lastOffset = subByteCount - 1;
+	UInt64	skips[256];
+	for (UInt32 i = 0; i < 256; i++)
+		skips[i] = subByteCount;
+	for (UInt64 i = 0; i < lastOffset; i++)
+		skips[subBytePtr[i]] = lastOffset - i;
+
+	// Search
+	for (UInt64 position = 0; (position + subByteCount) <= byteCount;
+			position += skips[bytePtr[position + lastOffset]]) {
+		// Check last byte, then the rest
+		if ((bytePtr[position + lastOffset] == subBytePtr[lastOffset]) &&
+				(::memcmp(bytePtr + position, subBytePtr, (size_t) lastOffset) == 0))
+			// Found
+			return OV<UInt64>(position);
+	}
+
+	return OV<UInt64>();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+static OV<UInt64> sFindBytes(const UInt8* bytePtr, UInt64 byteCount, const UInt8* subBytePtr, UInt64 subByteCount)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Check sizes
+	if (subByteCount > byteCount)
+		// Cannot fit
+		return OV<UInt64>();
+	else if (subByteCount == 1) {
+		// Single byte
+		const	UInt8*	ptr = (const UInt8*) ::memchr(bytePtr, subBytePtr[0], (size_t) byteCount);
+
+		return (ptr != nil) ? OV<UInt64>(ptr - bytePtr) : OV<UInt64>();
+	} else if (subByteCount < kHorspoolMinimumByteCount)
+		// Short
+		return sFindBytesFirstLast(bytePtr, byteCount, subBytePtr, subByteCount);
+	else
+		// Long
+		return sFindBytesHorspool(bytePtr, byteCount, subBytePtr, subByteCount);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+static OV<UInt64> sFindFirstOf(const UInt8* bytePtr, UInt64 byteCount, const UInt8* values, UInt32 valueCount)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Setup
+	UInt64	position = 0;
+
+#if defined(CDataUseSSE2)
+	// Check 16 bytes at a time
+	__m128i	valueVectors[kFirstOfMaximumCount];
+	for (UInt32 i = 0; i < valueCount; i++)
+		valueVectors[i] = _mm_set1_epi8((char) values[i]);
+	for (; (position + 16) <= byteCount; position += 16) {
+		// Compare against each value
+		__m128i	bytes = _mm_loadu_si128((const __m128i*) (bytePtr + position));
+		__m128i	matches = _mm_cmpeq_epi8(bytes, valueVectors[0]);
+		for (UInt32 i = 1; i < valueCount; i++)
+			matches = _mm_or_si128(matches, _mm_cmpeq_epi8(bytes, valueVectors[i]));
+
+		// Check for any
+		UInt32	mask = (UInt32) _mm_movemask_epi8(matches);
+		if (mask != 0)
+			// Found
+			return OV<UInt64>(position + CBits::countTrailingZeros(mask));
+	}
+#elif defined(CDataUseNEON)
+	// Check 16 bytes at a time
+	uint8x16_t	valueVectors[kFirstOfMaximumCount];
+	for (UInt32 i = 0; i < valueCount; i++)
+		valueVectors[i] = vdupq_n_u8(values[i]);
+	for (; (position + 16) <= byteCount; position += 16) {
+		// Compare against each value
+		uint8x16_t	bytes = vld1q_u8(bytePtr + position);
+		uint8x16_t	matches = vceqq_u8(bytes, valueVectors[0]);
+		for (UInt32 i = 1; i < valueCount; i++)
+			matches = vorrq_u8(matches, vceqq_u8(bytes, valueVectors[i]));
+
+		// Check for any, as a nibble per byte
+		UInt64	mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(matches), 4)), 0);
+		if (mask != 0)
+			// Found
+			return OV<UInt64>(position + CBits::countTrailingZeros(mask) / 4);
+	}
+#endif
+
+	// Check remaining bytes
+	for (; position < byteCount; position++) {
+		// Compare against each value
+		for (UInt32 i = 0; i < valueCount; i++) {
+			// Check value
+			if (bytePtr[position] == values[i])
+				// Found
+				return OV<UInt64>(position);
+		}
+	}
+
+	return OV<UInt64>();
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 //----------------------------------------------------------------------------------------------------------------------
 // MARK: - CData::Internals
 
-class CData::Internals : public TCopyOnWriteReferenceCountable<Internals> {
+class CData::Internals : public TCopyOnWriteReferenceCountable<Internals>, public CSlabAllocatable {
 	public:
 				Internals(CData::ByteCount preallocatedByteCount) :
 					TCopyOnWriteReferenceCountable(),
 							mOwnsBuffer(true), mBuffer(::calloc(1, (size_t) preallocatedByteCount)),
 							mBufferAllocatedByteCount(preallocatedByteCount),
-							mBufferUsedByteCount(0)
+							mBufferUsedByteCount(0), mParentInternals(nil)
 					{}
 				Internals(const void* initialBuffer, CData::ByteCount byteCount, bool copySourceData) :
 					TCopyOnWriteReferenceCountable(),
 							mOwnsBuffer(copySourceData), mBufferAllocatedByteCount(byteCount),
-							mBufferUsedByteCount(byteCount)
+							mBufferUsedByteCount(byteCount), mParentInternals(nil)
 					{
 						// Check if copying source data
 						if (copySourceData) {
@@ -41,11 +687,20 @@ class CData::Internals : public TCopyOnWriteReferenceCountable<Internals> {
 							// Reference existing buffer
 							mBuffer = (void*) initialBuffer;
 					}
+				Internals(Internals& parentInternals, CData::ByteIndex byteIndex, CData::ByteCount byteCount) :
+					TCopyOnWriteReferenceCountable(),
+							mOwnsBuffer(false), mBuffer((UInt8*) parentInternals.mBuffer + byteIndex),
+							mBufferAllocatedByteCount(byteCount), mBufferUsedByteCount(byteCount),
+							mParentInternals(
+									(parentInternals.mParentInternals != nil) ?
+											parentInternals.mParentInternals->addReference() :
+											parentInternals.addReference())
+					{}
 				Internals(const Internals& other) :
 					TCopyOnWriteReferenceCountable(), mOwnsBuffer(true),
 							mBuffer(::malloc((size_t) other.mBufferAllocatedByteCount)),
 							mBufferAllocatedByteCount(other.mBufferAllocatedByteCount),
-							mBufferUsedByteCount(other.mBufferUsedByteCount)
+							mBufferUsedByteCount(other.mBufferUsedByteCount), mParentInternals(nil)
 					{
 						// Copy data
 						::memcpy(mBuffer, other.mBuffer, (size_t) mBufferUsedByteCount);
@@ -56,6 +711,9 @@ class CData::Internals : public TCopyOnWriteReferenceCountable<Internals> {
 						if (mOwnsBuffer)
 							// Free!
 							::free(mBuffer);
+						if (mParentInternals != nil)
+							// Release parent
+							mParentInternals->removeReference();
 					}
 
 		void	reallocate(CData::ByteCount byteCount)
@@ -77,18 +735,128 @@ class CData::Internals : public TCopyOnWriteReferenceCountable<Internals> {
 							}
 						} else {
 							// Alloc new buffer
+							if (byteCount < mBufferUsedByteCount)
+								// Keep all existing bytes
+								byteCount = mBufferUsedByteCount;
+
 							void*	buffer = ::malloc((size_t) byteCount);
 							::memcpy(buffer, mBuffer, mBufferUsedByteCount);
 							mOwnsBuffer = true;
 							mBuffer = buffer;
 							mBufferAllocatedByteCount = byteCount;
+
+							// No longer need parent
+							if (mParentInternals != nil) {
+								// Release parent
+								mParentInternals->removeReference();
+								mParentInternals = nil;
+							}
 						}
 					}
+		void	detachFromParent()
+					{
+						// Check if have parent
+						if (mParentInternals != nil)
+							// Copy bytes out of the parent
+							reallocate(mBufferUsedByteCount);
+					}
 
 		bool				mOwnsBuffer;
 		void*				mBuffer;
 		CData::ByteCount	mBufferAllocatedByteCount;
 		CData::ByteCount	mBufferUsedByteCount;
+		Internals*			mParentInternals;
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - CData::Base64Encoder::Internals
+
+class CData::Base64Encoder::Internals {
+	public:
+				Internals(CharactersProc charactersProc, void* userData, bool prettyPrint) :
+					mCharactersProc(charactersProc), mUserData(userData), mPrettyPrint(prettyPrint),
+							mPendingByteCount(0), mCurrentLineLength(0), mCharacterCount(0)
+					{}
+
+		void	addGroups(const UInt8* bytePtr, UInt64 groupCount)
+					{
+						// Encode in chunks that fit in the character buffer
+						while (groupCount > 0) {
+							// Check space, allowing for a newline per line when pretty printing
+							UInt64	availableGroupCount = (kCharacterBufferCount - mCharacterCount) / 4;
+							if (mPrettyPrint)
+								// Leave room for newlines
+								availableGroupCount -=
+										std::min<UInt64>(availableGroupCount,
+												availableGroupCount / (kBase64LineLength / 4) + 1);
+							if (availableGroupCount == 0) {
+								// Flush
+								flush();
+								continue;
+							}
+
+							// Encode
+							UInt64	count = std::min<UInt64>(groupCount, availableGroupCount);
+							char*	charPtr =
+											sEncodeBase64Lines(bytePtr, count, mCharacters + mCharacterCount,
+													mPrettyPrint, mCurrentLineLength);
+							mCharacterCount = (UInt32) (charPtr - mCharacters);
+
+							// Update
+							bytePtr += count * 3;
+							groupCount -= count;
+						}
+					}
+		void	flush()
+					{
+						// Check if have characters
+						if (mCharacterCount > 0) {
+							// Call proc
+							mCharactersProc(mCharacters, mCharacterCount, mUserData);
+							mCharacterCount = 0;
+						}
+					}
+
+		static	const	UInt32	kCharacterBufferCount = 4096;
+
+		CharactersProc	mCharactersProc;
+		void*			mUserData;
+		bool			mPrettyPrint;
+
+		UInt8			mPendingBytes[3];
+		UInt32			mPendingByteCount;
+		UInt32			mCurrentLineLength;
+
+		char			mCharacters[kCharacterBufferCount];
+		UInt32			mCharacterCount;
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - CData::Builder::Internals
+
+class CData::Builder::Internals {
+	public:
+		Internals(CData::ByteCount segmentByteCount) :
+			mSegmentByteCount(segmentByteCount), mByteCount(0), mCurrentSegment(segmentByteCount)
+			{}
+
+		void	completeCurrentSegment()
+					{
+						// Check if have anything
+						if (mCurrentSegment.isEmpty())
+							return;
+
+						// Add to completed segments and start a new one
+						mCompletedSegments += mCurrentSegment;
+						mCurrentSegment = CData(mSegmentByteCount);
+					}
+
+		CData::ByteCount	mSegmentByteCount;
+		CData::ByteCount	mByteCount;
+		TNArray<CData>		mCompletedSegments;
+		CData				mCurrentSegment;
 };
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -133,12 +901,22 @@ CData::CData(const CData& other)
 	mInternals = other.mInternals->addReference();
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+CData::CData(CData&& other)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Take other's reference.  Other can only be destroyed or assigned to after this.
+	mInternals = other.mInternals;
+	other.mInternals = nil;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 CData::~CData()
 //----------------------------------------------------------------------------------------------------------------------
 {
 	// Remove reference
-	mInternals->removeReference();
+	if (mInternals != nil)
+		mInternals->removeReference();
 }
 
 // MARK: Instance methods
@@ -187,9 +965,6 @@ bool CData::compareBytes(const void* buffer, ByteCount byteCount, ByteIndex star
 CString CData::getBase64String(bool prettyPrint) const
 //----------------------------------------------------------------------------------------------------------------------
 {
-	// From http://web.mit.edu/freebsd/head/contrib/wpa/src/utils/base64.c
-	static	const	char*	sTable = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
-
 	// Setup
 	ByteCount		dataByteCount = mInternals->mBufferUsedByteCount;
 	CString::Length	stringLength = (CString::Length) (dataByteCount + 2) / 3 * 4;	// 3 byte blocks to 4 characters
@@ -202,52 +977,13 @@ CString CData::getBase64String(bool prettyPrint) const
 
 	// Convert
 	const	UInt8*			bytePtr = (UInt8*) mInternals->mBuffer;
-	const	UInt8*			endBytePtr = bytePtr + mInternals->mBufferUsedByteCount;
-
 			TBuffer<char>	stringBuffer(stringLength);
-			char*			stringPtr = *stringBuffer;
-
-			CString::Length	currentLineLength = 0;
-	while ((endBytePtr - bytePtr) >= 3) {
-		// Convert the next 3 bytes to 4 characters
-		*stringPtr++ = sTable[bytePtr[0] >> 2];
-		*stringPtr++ = sTable[((bytePtr[0] & 0x03) << 4) | (bytePtr[1] >> 4)];
-		*stringPtr++ = sTable[((bytePtr[1] & 0x0f) << 2) | (bytePtr[2] >> 6)];
-		*stringPtr++ = sTable[bytePtr[2] & 0x3f];
-
-		// Update
-		bytePtr += 3;
-		currentLineLength += 4;
-		if (prettyPrint && (currentLineLength >= 72)) {
-			// Add newline
-			*stringPtr++ = '\n';
-			currentLineLength = 0;
-		}
-	}
-
-	if ((endBytePtr - bytePtr) > 0) {
-		// Convert last 1 or 2 bytes
-		*stringPtr++ = sTable[bytePtr[0] >> 2];
-		if (endBytePtr - bytePtr == 1) {
-			// Convert last 1 byte
-			*stringPtr++ = sTable[(bytePtr[0] & 0x03) << 4];
-			*stringPtr++ = '=';
-			*stringPtr++ = '=';
-		} else {
-			// Convert last 2 bytes
-			*stringPtr++ = sTable[((bytePtr[0] & 0x03) << 4) |
-			(bytePtr[1] >> 4)];
-			*stringPtr++ = sTable[(bytePtr[1] & 0x0f) << 2];
-			*stringPtr++ = '=';
-		}
-
-		// Update
-		currentLineLength += 4;
-	}
-
-	if (prettyPrint && (currentLineLength > 0))
-		// Add newline
-		*stringPtr++ = '\n';
+			UInt32			currentLineLength = 0;
+			char*			stringPtr =
+									sEncodeBase64Lines(bytePtr, dataByteCount / 3, *stringBuffer, prettyPrint,
+											currentLineLength);
+	sEncodeBase64Final(bytePtr + dataByteCount / 3 * 3, dataByteCount % 3, stringPtr, prettyPrint,
+			currentLineLength);
 
 	return CString((const void*) *stringBuffer, stringLength, CString::kEncodingASCII);
 }
@@ -256,25 +992,22 @@ CString CData::getBase64String(bool prettyPrint) const
 CString CData::getHexString(bool uppercase) const
 //----------------------------------------------------------------------------------------------------------------------
 {
-	// Statics
-	static	const	char	sTableLowercase[] =
-									{'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'};
-	static	const	char	sTableUppercase[] =
-									{'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F'};
-
 	// Setup
-			TBuffer<char>	buffer(mInternals->mBufferUsedByteCount * 2);
-	const	UInt8*			bytePtr = (const UInt8*) mInternals->mBuffer;
-	const	char*			table = uppercase ? sTableUppercase : sTableLowercase;
-	for (ByteIndex i = 0; i <  mInternals->mBufferUsedByteCount; i++, bytePtr++) {
-		// Store
-		buffer[i * 2] = table[(*bytePtr & 0xF0) >> 4];
-		buffer[i * 2 + 1] = table[*bytePtr & 0x0F];
-	}
+	TBuffer<char>	buffer(mInternals->mBufferUsedByteCount * 2);
+
+	// Convert
+	sEncodeHex((const UInt8*) mInternals->mBuffer, mInternals->mBufferUsedByteCount, *buffer, uppercase);
 
 	return CString((const void*) *buffer, mInternals->mBufferUsedByteCount* 2, CString::kEncodingASCII);
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+void CData::hashInto(CHashable::HashCollector& hashableHashCollector) const
+//----------------------------------------------------------------------------------------------------------------------
+{
+	hashableHashCollector.add((const UInt8*) mInternals->mBuffer, mInternals->mBufferUsedByteCount);
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 TBuffer<const SInt8> CData::getSInt8Buffer(ByteIndex byteIndex, ByteCount byteCount) const
 //----------------------------------------------------------------------------------------------------------------------
@@ -326,7 +1059,12 @@ CData CData::subData(ByteIndex byteIndex, ByteCount byteCount) const
 	if ((byteIndex + byteCount) > mInternals->mBufferUsedByteCount)
 		return mEmpty;
 
-	return CData((UInt8*) mInternals->mBuffer + byteIndex, byteCount);
+	// Check if all
+	if ((byteIndex == 0) && (byteCount == mInternals->mBufferUsedByteCount))
+		// All
+		return CData(*this);
+
+	return CData(*new Internals(*mInternals, byteIndex, byteCount));
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -338,9 +1076,7 @@ CData CData::subData(ByteIndex byteIndex) const
 	if (byteIndex >= mInternals->mBufferUsedByteCount)
 		return mEmpty;
 
-	return (byteIndex == 0) ?
-			CData(*this) :
-			CData((UInt8*) mInternals->mBuffer + byteIndex, mInternals->mBufferUsedByteCount - byteIndex);
+	return subData(byteIndex, mInternals->mBufferUsedByteCount - byteIndex);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -356,8 +1092,8 @@ OV<SRange64> CData::findSubData(const CData& subData, ByteIndex startIndex, cons
 	if (startIndex >= mInternals->mBufferUsedByteCount)
 		return OV<SRange64>();
 
-	AssertFailIf(byteCount.hasValue() && ((startIndex + *byteCount) >= mInternals->mBufferUsedByteCount));
-	if (byteCount.hasValue() && ((startIndex + *byteCount) >= mInternals->mBufferUsedByteCount))
+	AssertFailIf(byteCount.hasValue() && ((startIndex + *byteCount) > mInternals->mBufferUsedByteCount));
+	if (byteCount.hasValue() && ((startIndex + *byteCount) > mInternals->mBufferUsedByteCount))
 		return OV<SRange64>();
 
 	// Setup
@@ -365,29 +1101,101 @@ OV<SRange64> CData::findSubData(const CData& subData, ByteIndex startIndex, cons
 	ByteIndex	searchEndIndex = byteCount.hasValue() ? (startIndex + *byteCount) : mInternals->mBufferUsedByteCount;
 
 	// Search
-	while ((startIndex + subByteCount) <= searchEndIndex) {
-		// Look for first byte within the window where the full sub-data can still fit
-		const	void*	ptr =
-								::memchr((const char*) mInternals->mBuffer + startIndex,
-										*((const char*) subData.mInternals->mBuffer),
-										searchEndIndex - startIndex - subByteCount + 1);
-		if (ptr == nil)
-			// First byte not present in remaining window
-			return OV<SRange64>();
+	OV<UInt64>	offset =
+						sFindBytes((const UInt8*) mInternals->mBuffer + startIndex, searchEndIndex - startIndex,
+								(const UInt8*) subData.mInternals->mBuffer, subByteCount);
 
-		// Advance to the located first byte
-		startIndex = (ByteIndex) ((const char*) ptr - (const char*) mInternals->mBuffer);
+	return offset.hasValue() ? OV<SRange64>(SRange64(startIndex + *offset, subByteCount)) : OV<SRange64>();
+}
 
-		// Check if data matches at this position
-		if (::memcmp(ptr, subData.mInternals->mBuffer, subByteCount) == 0)
-			// Found
-			return OV<SRange64>(SRange64(startIndex, subByteCount));
+//----------------------------------------------------------------------------------------------------------------------
+OV<CData::SubDataMatch> CData::findSubData(const TArray<CData>& subDatas, ByteIndex startIndex,
+		const OV<ByteCount>& byteCount) const
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Parameter check
+	AssertFailIf(subDatas.isEmpty());
+	if (subDatas.isEmpty())
+		return OV<SubDataMatch>();
+
+	AssertFailIf(startIndex >= mInternals->mBufferUsedByteCount);
+	if (startIndex >= mInternals->mBufferUsedByteCount)
+		return OV<SubDataMatch>();
+
+	AssertFailIf(byteCount.hasValue() && ((startIndex + *byteCount) > mInternals->mBufferUsedByteCount));
+	if (byteCount.hasValue() && ((startIndex + *byteCount) > mInternals->mBufferUsedByteCount))
+		return OV<SubDataMatch>();
+
+	// Setup
+	const	UInt8*		bytePtr = (const UInt8*) mInternals->mBuffer;
+			ByteIndex	searchEndIndex =
+								byteCount.hasValue() ? (startIndex + *byteCount) : mInternals->mBufferUsedByteCount;
+			ByteCount	minimumSubByteCount = ~((ByteCount) 0);
+			bool		isFirstByte[256] = {false};
+			UInt8		firstBytes[kFirstOfMaximumCount];
+			UInt32		firstByteCount = 0;
+	for (TArray<CData>::Iterator iterator = subDatas.getIterator(); iterator; iterator++) {
+		// Check sub data
+		const	CData&	subData = *iterator;
+		AssertFailIf(subData.mInternals->mBufferUsedByteCount == 0);
+		if (subData.mInternals->mBufferUsedByteCount == 0)
+			continue;
+
+		// Note byte count and first byte
+		UInt8	firstByte = *((const UInt8*) subData.mInternals->mBuffer);
+		minimumSubByteCount = std::min<ByteCount>(minimumSubByteCount, subData.mInternals->mBufferUsedByteCount);
+		if (!isFirstByte[firstByte]) {
+			// New first byte
+			isFirstByte[firstByte] = true;
+			if (firstByteCount < kFirstOfMaximumCount)
+				firstBytes[firstByteCount] = firstByte;
+			firstByteCount++;
+		}
+	}
+	if ((firstByteCount == 0) || ((startIndex + minimumSubByteCount) > searchEndIndex))
+		// Nothing can match
+		return OV<SubDataMatch>();
+
+	// Search candidate positions in order so the first match found is the earliest
+	ByteIndex	candidateEndIndex = searchEndIndex - minimumSubByteCount + 1;
+	while (startIndex < candidateEndIndex) {
+		// Find next position starting with any first byte
+		if (firstByteCount <= kFirstOfMaximumCount) {
+			// Few first bytes
+			OV<UInt64>	offset =
+								sFindFirstOf(bytePtr + startIndex, candidateEndIndex - startIndex, firstBytes,
+										firstByteCount);
+			if (!offset.hasValue())
+				// No more candidates
+				return OV<SubDataMatch>();
+			startIndex += *offset;
+		} else {
+			// Many first bytes
+			while ((startIndex < candidateEndIndex) && !isFirstByte[bytePtr[startIndex]])
+				// Next
+				startIndex++;
+			if (startIndex == candidateEndIndex)
+				// No more candidates
+				return OV<SubDataMatch>();
+		}
+
+		// Check each sub data at this position
+		UInt32	subDataIndex = 0;
+		for (TArray<CData>::Iterator iterator = subDatas.getIterator(); iterator; iterator++, subDataIndex++) {
+			// Check if sub data matches at this position
+			const	CData&		subData = *iterator;
+					ByteCount	subByteCount = subData.mInternals->mBufferUsedByteCount;
+			if ((subByteCount > 0) && ((startIndex + subByteCount) <= searchEndIndex) &&
+					(::memcmp(bytePtr + startIndex, subData.mInternals->mBuffer, (size_t) subByteCount) == 0))
+				// Found
+				return OV<SubDataMatch>(SubDataMatch(subDataIndex, SRange64(startIndex, subByteCount)));
+		}
 
 		// Start with next byte
 		startIndex++;
 	}
 
-	return OV<SRange64>();
+	return OV<SubDataMatch>();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -491,6 +1299,7 @@ CData& CData::replace(ByteIndex startByteIndex, ByteCount byteCount, const void*
 
 	// Prepare for write
 	Internals::prepareForWrite(&mInternals);
+	mInternals->detachFromParent();
 
 	// Check what is happening
 	if (byteCount == bufferByteCount)
@@ -542,7 +1351,8 @@ CData& CData::operator=(const CData& other)
 		return *this;
 
 	// Remove reference to ourselves
-	mInternals->removeReference();
+	if (mInternals != nil)
+		mInternals->removeReference();
 
 	// Add reference to other
 	mInternals = other.mInternals->addReference();
@@ -550,6 +1360,16 @@ CData& CData::operator=(const CData& other)
 	return *this;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+CData& CData::operator=(CData&& other)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Swap
+	std::swap(mInternals, other.mInternals);
+
+	return *this;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 bool CData::operator==(const CData& other) const
 //----------------------------------------------------------------------------------------------------------------------
@@ -584,19 +1404,6 @@ CData& CData::operator+=(const CData& other)
 CData CData::fromBase64String(const CString& base64String)
 //----------------------------------------------------------------------------------------------------------------------
 {
-	// From https://stackoverflow.com/questions/180947/base64-decode-snippet-in-c/13935718
-	static	const	UInt8	sMap[256] =
-									{
-										0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-										0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-										0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  62, 63, 62, 62, 63,
-										52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 0,  0,  0,  0,  0,  0,
-										0,  0,  1,  2,  3,  4,  5,  6,  7,  8,  9,  10, 11, 12, 13, 14,
-										15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 0,  0,  0,  0,  63,
-										0,  26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,
-										41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51,
-									};
-
 	// Setup
 	CString::Length	stringLength = base64String.getLength();
 	if (stringLength == 0)
@@ -615,26 +1422,228 @@ CData CData::fromBase64String(const CString& base64String)
 
 	// Convert
 	UInt8*	dataPtr = *data.getMutableBuffer(dataByteCount);
-	for (UInt32 i = 0; i < last; i += 4) {
-		// Convert these 4 characters to 3 bytes
-		UInt32	bytes =
-						(sMap[stringPtr[i]] << 18) | (sMap[stringPtr[i + 1]] << 12) | (sMap[stringPtr[i + 2]] << 6) |
-								sMap[stringPtr[i + 3]];
-		*dataPtr++ = (UInt8) (bytes >> 16);
-		*dataPtr++ = bytes >> 8 & 0xFF;
-		*dataPtr++ = bytes & 0xFF;
-	}
+	sDecodeBase64Quads(stringPtr, last / 4, dataPtr);
+	dataPtr += last / 4 * 3;
 
 	if (pad1) {
 		// Have extra bytes
-		UInt32	bytes = (sMap[stringPtr[last]] << 18) | (sMap[stringPtr[last + 1]] << 12);
+		UInt32	bytes =
+						(sBase64Map[(UInt8) stringPtr[last]] << 18) | (sBase64Map[(UInt8) stringPtr[last + 1]] << 12);
 		*dataPtr++ = (UInt8) (bytes >> 16);
 		if (pad2) {
 			// One more byte
-			bytes |= sMap[stringPtr[last + 2]] << 6;
+			bytes |= sBase64Map[(UInt8) stringPtr[last + 2]] << 6;
 			*dataPtr++ = bytes >> 8 & 0xFF;
 		}
 	}
 
 	return data;
 }
+
+//----------------------------------------------------------------------------------------------------------------------
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - CData::Base64Encoder
+
+// MARK: Lifecycle methods
+
+//----------------------------------------------------------------------------------------------------------------------
+CData::Base64Encoder::Base64Encoder(CharactersProc charactersProc, void* userData, bool prettyPrint)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Setup
+	mInternals = new Internals(charactersProc, userData, prettyPrint);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CData::Base64Encoder::~Base64Encoder()
+//----------------------------------------------------------------------------------------------------------------------
+{
+	Delete(mInternals);
+}
+
+// MARK: Instance methods
+
+//----------------------------------------------------------------------------------------------------------------------
+void CData::Base64Encoder::add(const void* buffer, ByteCount bufferByteCount)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Punt if no actual data to add
+	if (bufferByteCount == 0)
+		return;
+
+	// Parameter check
+	AssertNotNil(buffer);
+	if (buffer == nil)
+		return;
+
+	// Check for pending bytes
+	const	UInt8*	bytePtr = (const UInt8*) buffer;
+	if (mInternals->mPendingByteCount > 0) {
+		// Complete the pending group
+		while ((mInternals->mPendingByteCount < 3) && (bufferByteCount > 0)) {
+			// Take byte
+			mInternals->mPendingBytes[mInternals->mPendingByteCount++] = *bytePtr++;
+			bufferByteCount--;
+		}
+		if (mInternals->mPendingByteCount < 3)
+			// Still not complete
+			return;
+
+		// Encode
+		mInternals->addGroups(mInternals->mPendingBytes, 1);
+		mInternals->mPendingByteCount = 0;
+	}
+
+	// Encode all complete groups
+	mInternals->addGroups(bytePtr, bufferByteCount / 3);
+
+	// Hold on to any remaining bytes
+	bytePtr += bufferByteCount / 3 * 3;
+	mInternals->mPendingByteCount = (UInt32) (bufferByteCount % 3);
+	::memcpy(mInternals->mPendingBytes, bytePtr, mInternals->mPendingByteCount);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void CData::Base64Encoder::finish()
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Ensure room for the last group and newline
+	if ((Internals::kCharacterBufferCount - mInternals->mCharacterCount) < 5)
+		// Flush
+		mInternals->flush();
+
+	// Encode last group
+	char*	charPtr =
+					sEncodeBase64Final(mInternals->mPendingBytes, mInternals->mPendingByteCount,
+							mInternals->mCharacters + mInternals->mCharacterCount, mInternals->mPrettyPrint,
+							mInternals->mCurrentLineLength);
+	mInternals->mCharacterCount = (UInt32) (charPtr - mInternals->mCharacters);
+	mInternals->mPendingByteCount = 0;
+
+	// Flush
+	mInternals->flush();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - CData::Builder
+
+// MARK: Lifecycle methods
+
+//----------------------------------------------------------------------------------------------------------------------
+CData::Builder::Builder(ByteCount segmentByteCount)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Setup
+	mInternals = new Internals(segmentByteCount);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CData::Builder::~Builder()
+//----------------------------------------------------------------------------------------------------------------------
+{
+	Delete(mInternals);
+}
+
+// MARK: Instance methods
+
+//----------------------------------------------------------------------------------------------------------------------
+CData::ByteCount CData::Builder::getByteCount() const
+//----------------------------------------------------------------------------------------------------------------------
+{
+	return mInternals->mByteCount;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CData::Builder& CData::Builder::append(const void* buffer, ByteCount bufferByteCount)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Punt if no actual data to append
+	if (bufferByteCount == 0)
+		return *this;
+
+	// Parameter check
+	AssertNotNil(buffer);
+	if (buffer == nil)
+		return *this;
+
+	// Fill segments
+	const	UInt8*	bytePtr = (const UInt8*) buffer;
+	while (bufferByteCount > 0) {
+		// Check if current segment is full
+		ByteCount	segmentUsedByteCount = mInternals->mCurrentSegment.getByteCount();
+		if (segmentUsedByteCount == mInternals->mSegmentByteCount) {
+			// Start a new segment
+			mInternals->completeCurrentSegment();
+			segmentUsedByteCount = 0;
+		}
+
+		// Copy what fits
+		ByteCount	byteCount =
+							std::min<ByteCount>(mInternals->mSegmentByteCount - segmentUsedByteCount,
+									bufferByteCount);
+		mInternals->mCurrentSegment.append(bytePtr, byteCount);
+
+		// Update
+		bytePtr += byteCount;
+		bufferByteCount -= byteCount;
+		mInternals->mByteCount += byteCount;
+	}
+
+	return *this;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CData::Builder& CData::Builder::append(const CData& data)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Check size
+	ByteCount	byteCount = data.getByteCount();
+	if (byteCount < (mInternals->mSegmentByteCount / 4))
+		// Copy
+		return append(data.mInternals->mBuffer, byteCount);
+
+	// Chain by reference
+	mInternals->completeCurrentSegment();
+	mInternals->mCompletedSegments += data;
+	mInternals->mByteCount += byteCount;
+
+	return *this;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+UInt32 CData::Builder::getSegmentCount() const
+//----------------------------------------------------------------------------------------------------------------------
+{
+	return mInternals->mCompletedSegments.getCount() + (mInternals->mCurrentSegment.isEmpty() ? 0 : 1);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+const CData& CData::Builder::getSegment(UInt32 index) const
+//----------------------------------------------------------------------------------------------------------------------
+{
+	return (index < mInternals->mCompletedSegments.getCount()) ?
+			mInternals->mCompletedSegments[index] : mInternals->mCurrentSegment;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CData CData::Builder::getData() const
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Check if have a single chained segment
+	if ((mInternals->mCompletedSegments.getCount() == 1) && mInternals->mCurrentSegment.isEmpty())
+		// Use as-is
+		return mInternals->mCompletedSegments[0];
+
+	// Flatten
+	CData	data(mInternals->mByteCount);
+	UInt8*	bytePtr = *data.getMutableBuffer(mInternals->mByteCount);
+	for (TArray<CData>::Iterator iterator = mInternals->mCompletedSegments.getIterator(); iterator; iterator++) {
+		// Copy segment
+		iterator->copyBytes(bytePtr);
+		bytePtr += iterator->getByteCount();
+	}
+	mInternals->mCurrentSegment.copyBytes(bytePtr);
+
+	return data;
+}
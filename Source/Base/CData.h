@@ -12,6 +12,7 @@
 // MARK: CData
 
 class CString;
+template <typename T> class TArray;
 
 class CData {
 	// Types
@@ -19,7 +20,33 @@ class CData {
 		typedef	UInt64	ByteCount;
 		typedef	UInt64	ByteIndex;
 
+	// Structs
+	public:
+		struct SubDataMatch {
+			// Methods
+			public:
+										// Lifecycle methods
+										SubDataMatch(UInt32 subDataIndex, const SRange64& range) :
+											mSubDataIndex(subDataIndex), mRange(range)
+											{}
+
+										// Instance methods
+						UInt32			getSubDataIndex() const
+											{ return mSubDataIndex; }
+				const	SRange64&		getRange() const
+											{ return mRange; }
+
+			// Properties
+			private:
+				UInt32		mSubDataIndex;
+				SRange64	mRange;
+		};
+
 	// Classes
+	public:
+		class Base64Encoder;
+		class Builder;
+
 	private:
 		class Internals;
 
@@ -31,6 +58,7 @@ class CData {
 										CData(const void* buffer, ByteCount bufferByteCount,
 												bool copySourceData = true);
 										CData(const CData& other);
+										CData(CData&& other);
 										~CData();
 
 										// Instance methods
@@ -52,16 +80,23 @@ class CData {
 
 				CString					getBase64String(bool prettyPrint = false) const;
 				CString					getHexString(bool uppercase = false) const;
+				void					hashInto(CHashable::HashCollector& hashableHashCollector) const;
 
 				TBuffer<const SInt8>	getSInt8Buffer(ByteIndex byteIndex, ByteCount byteCount) const;
 				TBuffer<const SInt8>	getSInt8Buffer(ByteIndex byteIndex = 0) const;
 				TBuffer<const UInt8>	getUInt8Buffer(ByteIndex byteIndex, ByteCount byteCount) const;
 				TBuffer<const UInt8>	getUInt8Buffer(ByteIndex byteIndex = 0) const;
 
+										// Sub data is a view onto the bytes of this data and keeps them alive until
+										//	it is destroyed or written to.
 				CData					subData(ByteIndex byteIndex, ByteCount byteCount) const;
 				CData					subData(ByteIndex byteIndex) const;
 				OV<SRange64>			findSubData(const CData& subData, ByteIndex startIndex = 0,
 												const OV<ByteCount>& byteCount = OV<ByteCount>()) const;
+										// Finds the earliest occurrence of any of the sub datas in a single pass.  When
+										//	several start at the same index, the first in the array wins.
+				OV<SubDataMatch>		findSubData(const TArray<CData>& subDatas, ByteIndex startIndex = 0,
+												const OV<ByteCount>& byteCount = OV<ByteCount>()) const;
 
 				TBuffer<UInt8>			getMutableBuffer(ByteIndex byteIndex, ByteCount byteCount);
 				TBuffer<UInt8>			getMutableBuffer(ByteCount byteCount);
@@ -82,6 +117,7 @@ class CData {
 													sizeof(UInt32)); }
 
 				CData&					operator=(const CData& other);
+				CData&					operator=(CData&& other);
 				bool					operator==(const CData& other) const;
 				bool					operator!=(const CData& other) const
 											{ return !operator==(other); }
@@ -101,6 +137,10 @@ class CData {
 		static	CData					storing(UInt32 value, bool copyValue = true)
 											{ return CData(&value, sizeof(UInt32), copyValue); }
 
+	private:
+										// Lifecycle methods
+										CData(Internals& internals) : mInternals(&internals) {}
+
 	// Properties
 	public:
 		static	const	CData		mEmpty;
@@ -109,3 +149,85 @@ class CData {
 	private:
 						Internals*	mInternals;
 };
+
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - CData::Base64Encoder
+//	CData::Base64Encoder encodes bytes handed to it in pieces, passing the characters to the CharactersProc in chunks
+//		as they are produced.  The characters match getBase64String() for the same bytes, so large payloads can be
+//		encoded straight to their destination without being gathered up first.
+
+class CData::Base64Encoder {
+	// Types
+	public:
+		typedef	void	(*CharactersProc)(const char* characters, UInt32 characterCount, void* userData);
+
+	// Classes
+	private:
+		class Internals;
+
+	// Methods
+	public:
+							// Lifecycle methods
+							Base64Encoder(CharactersProc charactersProc, void* userData, bool prettyPrint = false);
+							~Base64Encoder();
+
+							// Instance methods
+		void				add(const void* buffer, ByteCount bufferByteCount);
+		void				add(const CData& data)
+								{ add(*data.getUInt8Buffer(), data.getByteCount()); }
+		void				finish();
+
+	private:
+							Base64Encoder(const Base64Encoder& other);
+		Base64Encoder&		operator=(const Base64Encoder& other);
+
+	// Properties
+	private:
+		Internals*	mInternals;
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - CData::Builder
+//	CData::Builder accumulates bytes into a chain of fixed-size segments, so building up a large data never reallocates
+//		and copies what has already been appended.  Appended data of at least a quarter segment is chained by reference
+//		instead of being copied.  The segments can be flattened once with getData() or handed to
+//		CFileWriter::write() as a single gather write.
+
+class CData::Builder {
+	// Classes
+	private:
+		class Internals;
+
+	// Methods
+	public:
+							// Lifecycle methods
+							Builder(ByteCount segmentByteCount = 16 * 1024);
+							~Builder();
+
+							// Instance methods
+		ByteCount			getByteCount() const;
+
+		Builder&			append(const void* buffer, ByteCount bufferByteCount);
+		Builder&			append(const CData& data);
+		Builder&			append(UInt8 value)
+								{ return append(&value, sizeof(UInt8)); }
+		Builder&			append(UInt16 value)
+								{ return append(&value, sizeof(UInt16)); }
+		Builder&			append(UInt32 value)
+								{ return append(&value, sizeof(UInt32)); }
+		Builder&			append(UInt64 value)
+								{ return append(&value, sizeof(UInt64)); }
+
+		UInt32				getSegmentCount() const;
+		const	CData&		getSegment(UInt32 index) const;
+
+		CData				getData() const;
+
+	private:
+							Builder(const Builder& other);
+		Builder&			operator=(const Builder& other);
+
+	// Properties
+	private:
+		Internals*	mInternals;
+};
@@ -6,7 +6,9 @@
 
 #include "CppToolboxAssert.h"
 #include "CReferenceCountable.h"
+#include "CSlabAllocator.h"
 #include "SError.h"
+#include "TRobinHoodSlots.h"
 
 //----------------------------------------------------------------------------------------------------------------------
 // MARK: CDictionary::Iterator
@@ -68,225 +70,283 @@ SValue& CDictionary::Iterator::getValue() const
 //----------------------------------------------------------------------------------------------------------------------
 //----------------------------------------------------------------------------------------------------------------------
 // MARK: - SDictionaryItemInfo
+//	Item infos live in slabs owned by the backing and never move once constructed, so references handed out by
+//		getValue() stay valid while other keys are added.
 
 struct SDictionaryItemInfo {
-			SDictionaryItemInfo(UInt32 keyHashValue, const CString& key, const SValue& value) :
-				mKeyHashValue(keyHashValue), mItem(key, value), mNextItemInfo(nil)
-				{}
-			SDictionaryItemInfo(const SDictionaryItemInfo& itemInfo, SValue::OpaqueCopyProc opaqueCopyProc) :
-				mKeyHashValue(itemInfo.mKeyHashValue), mItem(itemInfo.mItem, opaqueCopyProc), mNextItemInfo(nil)
-				{}
-
-	bool	doesMatch(UInt32 hashValue, const CString& key)
-				{ return (hashValue == mKeyHashValue) && (key == mItem.getKey()); }
-	void	disposeValue(SValue::OpaqueDisposeProc opaqueDisposeProc)
-				{ mItem.getValue().dispose(opaqueDisposeProc); }
-
-	UInt32					mKeyHashValue;
-	CDictionary::Item		mItem;
-	SDictionaryItemInfo*	mNextItemInfo;
+								// Instance methods
+			void				construct(UInt32 keyHashValue, const CString& key, SValue&& value,
+										const CString::Atom::Info* keyAtomInfo = nil)
+									{
+										// Setup
+										new (mItemStorage) CDictionary::Item(key, std::move(value));
+										mKeyHashValue = keyHashValue;
+										mKeyAtomInfo = keyAtomInfo;
+										mIsInUse = true;
+									}
+			void				construct(const SDictionaryItemInfo& other, SValue::OpaqueCopyProc opaqueCopyProc)
+									{
+										// Setup
+										new (mItemStorage) CDictionary::Item(other.getItem(), opaqueCopyProc);
+										mKeyHashValue = other.mKeyHashValue;
+										mKeyAtomInfo = other.mKeyAtomInfo;
+										mIsInUse = true;
+									}
+			void				destruct(SValue::OpaqueDisposeProc opaqueDisposeProc)
+									{
+										// Cleanup
+										disposeValue(opaqueDisposeProc);
+										getItem().~Item();
+										mIsInUse = false;
+									}
+
+			CDictionary::Item&	getItem() const
+									{ return *((CDictionary::Item*) mItemStorage); }
+			void				disposeValue(SValue::OpaqueDisposeProc opaqueDisposeProc)
+									{ getItem().getValue().dispose(opaqueDisposeProc); }
+
+								// Class methods
+	static	bool				isMatch(const SDictionaryItemInfo& itemInfo, const CString& key)
+									{ return key == itemInfo.getItem().getKey(); }
+	static	bool				isMatch(const SDictionaryItemInfo& itemInfo, const CString::Atom& keyAtom)
+									{
+										// Atoms are unique per string, so if this key came from an atom, only the
+										//	same atom can match
+										return (itemInfo.mKeyAtomInfo != nil) ?
+												itemInfo.mKeyAtomInfo == keyAtom.getInfo() :
+												keyAtom.getString() == itemInfo.getItem().getKey();
+									}
+
+			UInt32					mKeyHashValue;
+	const	CString::Atom::Info*	mKeyAtomInfo;
+			bool					mIsInUse;
+	union {
+		alignas(CDictionary::Item)	UInt8					mItemStorage[sizeof(CDictionary::Item)];
+									SDictionaryItemInfo*	mNextFreeItemInfo;
+	};
 };
 
 //----------------------------------------------------------------------------------------------------------------------
 //----------------------------------------------------------------------------------------------------------------------
 // MARK: - CStandardBacking
 
-class CStandardBacking : public CDictionary::Backing {
-	class IteratorInfo : public CDictionary::IteratorInfo {
+class CStandardBacking : public CDictionary::Backing, public CSlabAllocatable {
+	class IteratorInfo : public CDictionary::IteratorInfo, public CSlabAllocatable {
 		public:
-								IteratorInfo(const CStandardBacking& backing,
-										UInt32 initialReference, UInt32 itemInfosIndex,
-										SDictionaryItemInfo* initialItemInfo) :
+								IteratorInfo(const CStandardBacking& backing, UInt32 initialReference) :
 									CDictionary::IteratorInfo(),
 											mBacking(backing), mInitialReference(initialReference),
-											mCurrentItemInfoIndex(itemInfosIndex), mCurrentItemInfo(initialItemInfo),
-											mCurrentIndex(0)
-									{}
+											mCurrentItemInfoSlabIndex(0), mCurrentItemInfoIndex(0),
+											mCurrentItemInfo(nil), mCurrentIndex(0)
+									{
+										// Find first item info
+										if (mBacking.mCount > 0)
+											// Setup
+											mCurrentItemInfo = findItemInfo();
+									}
 
 					UInt32		getCount() const
 									{ return mBacking.getCount(); }
 					UInt32		getCurrentIndex() const
 									{ return mCurrentIndex; }
 			const	CString&	getCurrentKey() const
-									{ return mCurrentItemInfo->mItem.getKey(); }
+									{ return mCurrentItemInfo->getItem().getKey(); }
 					SValue&		getCurrentValue() const
-									{ return mCurrentItemInfo->mItem.getValue(); }
+									{ return mCurrentItemInfo->getItem().getValue(); }
 					void		advance()
 									{
 										// Internals check
 										AssertFailIf(mInitialReference != mBacking.mReference);
 
-										// Check for additional item info in linked list
-										if (mCurrentItemInfo->mNextItemInfo != nil) {
-											// Have next item info
-											mCurrentItemInfo = mCurrentItemInfo->mNextItemInfo;
-											mCurrentIndex++;
-										} else {
-											// End of item info linked list
-											while ((++mCurrentItemInfoIndex < mBacking.mItemInfosCount) &&
-													(mBacking.mItemInfos[mCurrentItemInfoIndex] == nil)) ;
-
-											// Update
-											mCurrentItemInfo =
-													(mCurrentItemInfoIndex < mBacking.mItemInfosCount) ?
-															mBacking.mItemInfos[mCurrentItemInfoIndex] : nil;
-											mCurrentIndex++;
-										}
+										// Update
+										mCurrentIndex++;
+										mCurrentItemInfoIndex++;
+										mCurrentItemInfo = (mCurrentIndex < mBacking.mCount) ? findItemInfo() : nil;
 									}
 
+		private:
+					SDictionaryItemInfo*	findItemInfo()
+												{
+													// Scan slabs for the next item info in use
+													for (; mCurrentItemInfoSlabIndex < mBacking.mItemInfoSlabsCount;
+															mCurrentItemInfoSlabIndex++, mCurrentItemInfoIndex = 0) {
+														// Setup
+														SDictionaryItemInfo*	itemInfos =
+																						mBacking.mItemInfoSlabs[
+																								mCurrentItemInfoSlabIndex];
+														UInt32					itemInfosCount =
+																						mBacking.getItemInfoSlabUsedCount(
+																								mCurrentItemInfoSlabIndex);
+
+														// Scan this slab
+														for (; mCurrentItemInfoIndex < itemInfosCount;
+																mCurrentItemInfoIndex++) {
+															// Check if in use
+															if (itemInfos[mCurrentItemInfoIndex].mIsInUse)
+																// Found
+																return &itemInfos[mCurrentItemInfoIndex];
+														}
+													}
+
+													return nil;
+												}
+
 		private:
 			const	CStandardBacking&		mBacking;
 
 					UInt32					mInitialReference;
+					UInt32					mCurrentItemInfoSlabIndex;
 					UInt32					mCurrentItemInfoIndex;
 					SDictionaryItemInfo*	mCurrentItemInfo;
 
 					UInt32					mCurrentIndex;
 	};
 
-	public:
+	// Slot
+	typedef	TRobinHoodSlots<SDictionaryItemInfo>::Slot	Slot;
 
+	public:
 										CStandardBacking(SValue::OpaqueCopyProc opaqueCopyProc,
 												SValue::OpaqueEqualsProc opaqueEqualsProc,
 												SValue::OpaqueDisposeProc opaqueDisposeProc) :
 											mOpaqueCopyProc(opaqueCopyProc), mOpaqueEqualsProc(opaqueEqualsProc),
 													mOpaqueDisposeProc(opaqueDisposeProc),
-													mCount(0), mItemInfosCount(16),
-													mItemInfos(
-															(SDictionaryItemInfo**)
-																	::calloc(mItemInfosCount,
-																			sizeof(SDictionaryItemInfo*))),
-													mReference(0)
+													mCount(0), mReference(0),
+													mItemInfoSlabsCount(0), mItemInfoSlabs(nil),
+													mLastItemInfoSlabUsedCount(0), mFirstFreeItemInfo(nil)
 											{}
 										CStandardBacking(const CStandardBacking& other) :
 											mOpaqueCopyProc(other.mOpaqueCopyProc),
 													mOpaqueEqualsProc(other.mOpaqueEqualsProc),
 													mOpaqueDisposeProc(other.mOpaqueDisposeProc),
-													mCount(other.mCount), mItemInfosCount(other.mItemInfosCount),
-													mItemInfos(
-															(SDictionaryItemInfo**)
-																	::calloc(mItemInfosCount,
-																			sizeof(SDictionaryItemInfo*))),
-													mReference(0)
+													mCount(0), mReference(0),
+													mItemInfoSlabsCount(0), mItemInfoSlabs(nil),
+													mLastItemInfoSlabUsedCount(0), mFirstFreeItemInfo(nil)
 											{
-												// Copy item infos
-												for (UInt32 i = 0; i < mItemInfosCount; i++) {
-													// Setup for this linked list
-													SDictionaryItemInfo*	itemInfo = other.mItemInfos[i];
-													SDictionaryItemInfo*	dictionaryInternalsItemInfo = nil;
-
-													while (itemInfo != nil) {
-														// Check for first in the linked list
-														if (dictionaryInternalsItemInfo == nil) {
-															// First in this linked list
-															mItemInfos[i] =
-																	new SDictionaryItemInfo(*itemInfo, mOpaqueCopyProc);
-															dictionaryInternalsItemInfo = mItemInfos[i];
-														} else {
-															// Next one in this linked list
-															dictionaryInternalsItemInfo->mNextItemInfo =
-																	new SDictionaryItemInfo(*itemInfo, mOpaqueCopyProc);
-															dictionaryInternalsItemInfo =
-																	dictionaryInternalsItemInfo->mNextItemInfo;
-														}
+												// Check if empty
+												if (other.mCount == 0)
+													// Nothing to copy
+													return;
 
-														// Next
-														itemInfo = itemInfo->mNextItemInfo;
+												// Size storage up front
+												mSlots.reserve(other.mCount);
+
+												// Copy item infos.  Slot order is rebuilt from the cached hash values.
+												for (UInt32 i = 0; i < other.mItemInfoSlabsCount; i++) {
+													// Setup
+													SDictionaryItemInfo*	otherItemInfos = other.mItemInfoSlabs[i];
+													UInt32					otherItemInfosCount =
+																					other.getItemInfoSlabUsedCount(i);
+
+													// Iterate item infos
+													for (UInt32 j = 0; j < otherItemInfosCount; j++) {
+														// Check if in use
+														if (otherItemInfos[j].mIsInUse) {
+															// Copy
+															SDictionaryItemInfo*	itemInfo = newItemInfo();
+															itemInfo->construct(otherItemInfos[j], mOpaqueCopyProc);
+															mSlots.add(itemInfo->mKeyHashValue, itemInfo);
+														}
 													}
 												}
+
+												// Update info
+												mCount = other.mCount;
 											}
 										~CStandardBacking()
 											{
 												// Remove all
 												removeAllInternal();
-
-												// Cleanup
-												::free(mItemInfos);
 											}
 
 		CDictionary::Count				getCount() const
 											{ return mCount; }
 		OR<SValue>						getValue(const CString& key) const
 											{
-												// Setup
-												UInt32	hashValue = key.getHashValue();
-												UInt32	index = hashValue & (mItemInfosCount - 1);
+												// Find slot
+												Slot*	slot = findSlot(key.getHashValue(), key);
 
-												// Find item info that matches
-												SDictionaryItemInfo*	itemInfo = mItemInfos[index];
-												while ((itemInfo != nil) && !itemInfo->doesMatch(hashValue, key))
-													// Advance to next item info
-													itemInfo = itemInfo->mNextItemInfo;
+												return (slot != nil) ?
+														OR<SValue>(slot->mItem->getItem().getValue()) : OR<SValue>();
+											}
+		OR<SValue>						getValue(const CString::Atom& keyAtom) const
+											{
+												// Find slot
+												Slot*	slot = findSlot(keyAtom);
 
-												return (itemInfo != nil) ?
-														OR<SValue>(itemInfo->mItem.getValue()) : OR<SValue>();
+												return (slot != nil) ?
+														OR<SValue>(slot->mItem->getItem().getValue()) : OR<SValue>();
 											}
 		void							set(const CString& key, const SValue& value)
 											{
 												// Setup
 												UInt32	hashValue = key.getHashValue();
-												UInt32	index = hashValue & (mItemInfosCount - 1);
-
-												// Find
-												SDictionaryItemInfo*	previousItemInfo = nil;
-												SDictionaryItemInfo*	currentItemInfo = mItemInfos[index];
-												while ((currentItemInfo != nil) &&
-														!currentItemInfo->doesMatch(hashValue, key)) {
-													// Next in linked list
-													previousItemInfo = currentItemInfo;
-													currentItemInfo = currentItemInfo->mNextItemInfo;
-												}
+												Slot*	slot = findSlot(hashValue, key);
 
 												// Check results
-												if (currentItemInfo == nil) {
+												if (slot == nil)
 													// Did not find
-													if (previousItemInfo == nil)
-														// First one
-														mItemInfos[index] =
-																new SDictionaryItemInfo(hashValue, key, value);
-													else
-														// Add to the end
-														previousItemInfo->mNextItemInfo =
-																new SDictionaryItemInfo(hashValue, key, value);
-
-													// Update info
-													mCount++;
-													mReference++;
-												} else {
+													add(hashValue, key, SValue(value), nil);
+												else
 													// Did find a match
-													currentItemInfo->disposeValue(mOpaqueDisposeProc);
-													currentItemInfo->mItem.getValue() = SValue(value, mOpaqueCopyProc);
-												}
+													replaceValue(*slot->mItem, SValue(value, mOpaqueCopyProc));
 											}
-		void							remove(const CString& key)
+		void							set(const CString& key, SValue&& value)
 											{
 												// Setup
 												UInt32	hashValue = key.getHashValue();
-												UInt32	index = hashValue & (mItemInfosCount - 1);
-
-												// Find
-												SDictionaryItemInfo*	previousItemInfo = nil;
-												SDictionaryItemInfo*	currentItemInfo = mItemInfos[index];
-												while ((currentItemInfo != nil) &&
-														!currentItemInfo->doesMatch(hashValue, key)) {
-													// Next in linked list
-													previousItemInfo = currentItemInfo;
-													currentItemInfo = currentItemInfo->mNextItemInfo;
-												}
+												Slot*	slot = findSlot(hashValue, key);
 
-												// Check results
-												if (currentItemInfo != nil) {
+												// Check results.  The value is adopted as is.
+												if (slot == nil)
+													// Did not find
+													add(hashValue, key, std::move(value), nil);
+												else
 													// Did find a match
-													if (previousItemInfo == nil)
-														// First item info
-														mItemInfos[index] = currentItemInfo->mNextItemInfo;
-													else
-														// Not the first item info
-														previousItemInfo->mNextItemInfo =
-																currentItemInfo->mNextItemInfo;
+													replaceValue(*slot->mItem, std::move(value));
+											}
+		void							set(const CString::Atom& keyAtom, const SValue& value)
+											{
+												// Setup
+												Slot*	slot = findSlot(keyAtom);
 
-													// Cleanup
-													remove(currentItemInfo, false);
+												// Check results
+												if (slot == nil)
+													// Did not find
+													add(keyAtom.getHashValue(), keyAtom.getString(), SValue(value),
+															keyAtom.getInfo());
+												else {
+													// Did find a match.  Note the atom so later lookups by atom can
+													//	match by pointer.
+													slot->mItem->mKeyAtomInfo = keyAtom.getInfo();
+													replaceValue(*slot->mItem, SValue(value, mOpaqueCopyProc));
+												}
+											}
+		void							set(const CString::Atom& keyAtom, SValue&& value)
+											{
+												// Setup
+												Slot*	slot = findSlot(keyAtom);
+
+												// Check results.  The value is adopted as is.
+												if (slot == nil)
+													// Did not find
+													add(keyAtom.getHashValue(), keyAtom.getString(), std::move(value),
+															keyAtom.getInfo());
+												else {
+													// Did find a match.  Note the atom so later lookups by atom can
+													//	match by pointer.
+													slot->mItem->mKeyAtomInfo = keyAtom.getInfo();
+													replaceValue(*slot->mItem, std::move(value));
+												}
+											}
+		void							remove(const CString& key)
+											{
+												// Find slot
+												Slot*	slot = findSlot(key.getHashValue(), key);
+												if (slot != nil) {
+													// Did find a match
+													deleteItemInfo(slot->mItem);
+													mSlots.remove(*slot);
 
 													// Update info
 													mCount--;
@@ -318,50 +378,127 @@ class CStandardBacking : public CDictionary::Backing {
 
 		I<CDictionary::IteratorInfo>	getIteratorInfo() const
 											{
-												// Find first item info
-												for (UInt32 i = 0; i < mItemInfosCount; i++) {
-													// Check if have item in this slot
-													if (mItemInfos[i] != nil)
-														// Found first item
-														return I<CDictionary::IteratorInfo>(
-																new CStandardBacking::IteratorInfo(*this, mReference, i,
-																		mItemInfos[i]));
-												}
-
 												return I<CDictionary::IteratorInfo>(
-														new CStandardBacking::IteratorInfo(*this, mReference, 0, nil));
+														new CStandardBacking::IteratorInfo(*this, mReference));
 											}
 
 		I<Backing>						prepareForWrite()
 											{ return I<Backing>(new CStandardBacking(*this)); }
 		SValue::OpaqueEqualsProc		getOpaqueEqualsProc() const
 											{ return mOpaqueEqualsProc; }
-		private:
-		void							removeAllInternal()
+
+	private:
+		void							add(UInt32 hashValue, const CString& key, SValue&& value,
+												const CString::Atom::Info* keyAtomInfo)
 											{
-												// Iterate all item infos
-												for (UInt32 i = 0; i < mItemInfosCount; i++) {
-													// Check if have an item info
-													if (mItemInfos[i] != nil) {
-														// Remove this chain
-														remove(mItemInfos[i], true);
-
-														// Clear
-														mItemInfos[i] = nil;
-													}
+												// Make room
+												mSlots.reserve(mCount + 1);
+
+												// Add
+												SDictionaryItemInfo*	itemInfo = newItemInfo();
+												itemInfo->construct(hashValue, key, std::move(value), keyAtomInfo);
+												mSlots.add(hashValue, itemInfo);
+
+												// Update info
+												mCount++;
+												mReference++;
+											}
+		void							replaceValue(SDictionaryItemInfo& itemInfo, SValue&& value)
+											{
+												// Replace
+												itemInfo.disposeValue(mOpaqueDisposeProc);
+												itemInfo.getItem().getValue() = std::move(value);
+											}
+
+		Slot*							findSlot(UInt32 hashValue, const CString& key) const
+											{ return mSlots.find(hashValue, key, SDictionaryItemInfo::isMatch); }
+		Slot*							findSlot(const CString::Atom& keyAtom) const
+											{
+												return mSlots.find(keyAtom.getHashValue(), keyAtom,
+														SDictionaryItemInfo::isMatch);
+											}
+
+		SDictionaryItemInfo*			newItemInfo()
+											{
+												// Check for free item info
+												if (mFirstFreeItemInfo != nil) {
+													// Reuse
+													SDictionaryItemInfo*	itemInfo = mFirstFreeItemInfo;
+													mFirstFreeItemInfo = itemInfo->mNextFreeItemInfo;
+
+													return itemInfo;
+												}
+
+												// Check if need a new slab
+												if ((mItemInfoSlabsCount == 0) ||
+														(mLastItemInfoSlabUsedCount ==
+																getItemInfoSlabCapacity(mItemInfoSlabsCount - 1))) {
+													// Add slab
+													mItemInfoSlabs =
+															(SDictionaryItemInfo**)
+																	::realloc(mItemInfoSlabs,
+																			(mItemInfoSlabsCount + 1) *
+																					sizeof(SDictionaryItemInfo*));
+													mItemInfoSlabs[mItemInfoSlabsCount] =
+															(SDictionaryItemInfo*)
+																	::malloc(getItemInfoSlabCapacity(mItemInfoSlabsCount) *
+																			sizeof(SDictionaryItemInfo));
+													mItemInfoSlabsCount++;
+													mLastItemInfoSlabUsedCount = 0;
 												}
+
+												return &mItemInfoSlabs[mItemInfoSlabsCount - 1]
+														[mLastItemInfoSlabUsedCount++];
+											}
+		void							deleteItemInfo(SDictionaryItemInfo* itemInfo)
+											{
+												// Destruct and add to free list
+												itemInfo->destruct(mOpaqueDisposeProc);
+												itemInfo->mNextFreeItemInfo = mFirstFreeItemInfo;
+												mFirstFreeItemInfo = itemInfo;
+											}
+		UInt32							getItemInfoSlabUsedCount(UInt32 itemInfoSlabIndex) const
+											{
+												return (itemInfoSlabIndex == (mItemInfoSlabsCount - 1)) ?
+														mLastItemInfoSlabUsedCount :
+														getItemInfoSlabCapacity(itemInfoSlabIndex);
 											}
-		void							remove(SDictionaryItemInfo* itemInfo, bool removeAll)
+
+		void							removeAllInternal()
 											{
-												// Check for next item info
-												if (removeAll && (itemInfo->mNextItemInfo != nil))
-													// Remove the next item info
-													remove(itemInfo->mNextItemInfo, true);
+												// Iterate all slabs
+												for (UInt32 i = 0; i < mItemInfoSlabsCount; i++) {
+													// Iterate item infos
+													SDictionaryItemInfo*	itemInfos = mItemInfoSlabs[i];
+													UInt32					itemInfosCount = getItemInfoSlabUsedCount(i);
+													for (UInt32 j = 0; j < itemInfosCount; j++) {
+														// Check if in use
+														if (itemInfos[j].mIsInUse)
+															// Destruct
+															itemInfos[j].destruct(mOpaqueDisposeProc);
+													}
 
-												// Dispose
-												itemInfo->disposeValue(mOpaqueDisposeProc);
+													// Cleanup
+													::free(itemInfos);
+												}
 
-												Delete(itemInfo);
+												// Cleanup
+												::free(mItemInfoSlabs);
+												mSlots.removeAll();
+
+												// Reset
+												mItemInfoSlabsCount = 0;
+												mItemInfoSlabs = nil;
+												mLastItemInfoSlabUsedCount = 0;
+												mFirstFreeItemInfo = nil;
+											}
+
+		static	UInt32					getItemInfoSlabCapacity(UInt32 itemInfoSlabIndex)
+											{
+												return (itemInfoSlabIndex < kItemInfoSlabCapacityDoublingsCount) ?
+														kItemInfoSlabInitialCapacity << itemInfoSlabIndex :
+														kItemInfoSlabInitialCapacity <<
+																kItemInfoSlabCapacityDoublingsCount;
 											}
 
 	public:
@@ -370,9 +507,18 @@ class CStandardBacking : public CDictionary::Backing {
 		SValue::OpaqueDisposeProc	mOpaqueDisposeProc;
 
 		CDictionary::Count			mCount;
-		UInt32						mItemInfosCount;
-		SDictionaryItemInfo**		mItemInfos;
 		UInt32						mReference;
+
+		TRobinHoodSlots<SDictionaryItemInfo>	mSlots;
+
+		UInt32						mItemInfoSlabsCount;
+		SDictionaryItemInfo**		mItemInfoSlabs;
+		UInt32						mLastItemInfoSlabUsedCount;
+		SDictionaryItemInfo*		mFirstFreeItemInfo;
+
+		// Slabs hold 8, 16, 32, ... item infos up to 4096 each
+		static	const	UInt32		kItemInfoSlabInitialCapacity = 8;
+		static	const	UInt32		kItemInfoSlabCapacityDoublingsCount = 9;
 };
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -405,6 +551,12 @@ CDictionary::CDictionary(const CDictionary& other) : CEquatable(), mBacking(othe
 {
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+CDictionary::CDictionary(CDictionary&& other) : CEquatable(), mBacking(std::move(other.mBacking))
+//----------------------------------------------------------------------------------------------------------------------
+{
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 CDictionary::~CDictionary()
 //----------------------------------------------------------------------------------------------------------------------
@@ -442,6 +594,13 @@ bool CDictionary::contains(const CString& key) const
 	return mBacking->getValue(key).hasReference();
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+bool CDictionary::contains(const CString::Atom& keyAtom) const
+//----------------------------------------------------------------------------------------------------------------------
+{
+	return mBacking->getValue(keyAtom).hasReference();
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 const SValue& CDictionary::getValue(const CString& key) const
 //----------------------------------------------------------------------------------------------------------------------
@@ -449,6 +608,13 @@ const SValue& CDictionary::getValue(const CString& key) const
 	return *mBacking->getValue(key);
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+const SValue& CDictionary::getValue(const CString::Atom& keyAtom) const
+//----------------------------------------------------------------------------------------------------------------------
+{
+	return *mBacking->getValue(keyAtom);
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 OV<SValue> CDictionary::getOValue(const CString& key) const
 //----------------------------------------------------------------------------------------------------------------------
@@ -816,6 +982,19 @@ void CDictionary::set(const CString& key, const TArray<CDictionary>& value)
 	mBacking->set(key, SValue(value));
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+void CDictionary::set(const CString& key, TArray<CDictionary>&& value)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Check backing reference count
+	if (mBacking.getReferenceCount() > 1)
+		// Prepare for write
+		mBacking = mBacking->prepareForWrite();
+
+	// Set
+	mBacking->set(key, SValue(std::move(value)));
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 void CDictionary::set(const CString& key, const TArray<CString>& value)
 //----------------------------------------------------------------------------------------------------------------------
@@ -829,6 +1008,19 @@ void CDictionary::set(const CString& key, const TArray<CString>& value)
 	mBacking->set(key, SValue(value));
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+void CDictionary::set(const CString& key, TArray<CString>&& value)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Check backing reference count
+	if (mBacking.getReferenceCount() > 1)
+		// Prepare for write
+		mBacking = mBacking->prepareForWrite();
+
+	// Set
+	mBacking->set(key, SValue(std::move(value)));
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 void CDictionary::set(const CString& key, const CData& value)
 //----------------------------------------------------------------------------------------------------------------------
@@ -842,6 +1034,19 @@ void CDictionary::set(const CString& key, const CData& value)
 	mBacking->set(key, SValue(value));
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+void CDictionary::set(const CString& key, CData&& value)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Check backing reference count
+	if (mBacking.getReferenceCount() > 1)
+		// Prepare for write
+		mBacking = mBacking->prepareForWrite();
+
+	// Set
+	mBacking->set(key, SValue(std::move(value)));
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 void CDictionary::set(const CString& key, const CDictionary& value)
 //----------------------------------------------------------------------------------------------------------------------
@@ -855,6 +1060,19 @@ void CDictionary::set(const CString& key, const CDictionary& value)
 	mBacking->set(key, SValue(value));
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+void CDictionary::set(const CString& key, CDictionary&& value)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Check backing reference count
+	if (mBacking.getReferenceCount() > 1)
+		// Prepare for write
+		mBacking = mBacking->prepareForWrite();
+
+	// Set
+	mBacking->set(key, SValue(std::move(value)));
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 void CDictionary::set(const CString& key, const CString& value)
 //----------------------------------------------------------------------------------------------------------------------
@@ -868,6 +1086,19 @@ void CDictionary::set(const CString& key, const CString& value)
 	mBacking->set(key, SValue(value));
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+void CDictionary::set(const CString& key, CString&& value)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Check backing reference count
+	if (mBacking.getReferenceCount() > 1)
+		// Prepare for write
+		mBacking = mBacking->prepareForWrite();
+
+	// Set
+	mBacking->set(key, SValue(std::move(value)));
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 void CDictionary::set(const CString& key, Float32 value)
 //----------------------------------------------------------------------------------------------------------------------
@@ -1024,6 +1255,45 @@ void CDictionary::set(const CString& key, const SValue& value)
 	mBacking->set(key, value);
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+void CDictionary::set(const CString& key, SValue&& value)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Check backing reference count
+	if (mBacking.getReferenceCount() > 1)
+		// Prepare for write
+		mBacking = mBacking->prepareForWrite();
+
+	// Set
+	mBacking->set(key, std::move(value));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void CDictionary::set(const CString::Atom& keyAtom, const SValue& value)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Check backing reference count
+	if (mBacking.getReferenceCount() > 1)
+		// Prepare for write
+		mBacking = mBacking->prepareForWrite();
+
+	// Set
+	mBacking->set(keyAtom, value);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void CDictionary::set(const CString::Atom& keyAtom, SValue&& value)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Check backing reference count
+	if (mBacking.getReferenceCount() > 1)
+		// Prepare for write
+		mBacking = mBacking->prepareForWrite();
+
+	// Set
+	mBacking->set(keyAtom, std::move(value));
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 void CDictionary::remove(const CString& key)
 //----------------------------------------------------------------------------------------------------------------------
@@ -1106,6 +1376,9 @@ void CDictionary::removeAll()
 bool CDictionary::equals(const CDictionary& other, void* itemCompareProcUserData) const
 //----------------------------------------------------------------------------------------------------------------------
 {
+	// Values compare with the backing's opaque equals proc, which takes no user data
+	(void) itemCompareProcUserData;
+
 	// Check count
 	if (mBacking->getCount() != other.mBacking->getCount())
 		// Counts differ
@@ -1151,6 +1424,13 @@ const OR<SValue> CDictionary::operator[](const CString& key) const
 	return mBacking->getValue(key);
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+const OR<SValue> CDictionary::operator[](const CString::Atom& keyAtom) const
+//----------------------------------------------------------------------------------------------------------------------
+{
+	return mBacking->getValue(keyAtom);
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 CDictionary& CDictionary::operator=(const CDictionary& other)
 //----------------------------------------------------------------------------------------------------------------------
@@ -1165,6 +1445,16 @@ CDictionary& CDictionary::operator=(const CDictionary& other)
 	return *this;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+CDictionary& CDictionary::operator=(CDictionary&& other)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Swap backing
+	mBacking = std::move(other.mBacking);
+
+	return *this;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 CDictionary CDictionary::operator+(const CDictionary& other) const
 //----------------------------------------------------------------------------------------------------------------------
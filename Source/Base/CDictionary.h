@@ -27,6 +27,7 @@ class CDictionary : public CEquatable {
 
 								// Lifecycle methods
 								Item(const CString& key, const SValue& value) : mKey(key), mValue(value) {}
+								Item(const CString& key, SValue&& value) : mKey(key), mValue(std::move(value)) {}
 								Item(const CString& key, const SValue& value, SValue::OpaqueCopyProc opaqueCopyProc) :
 									mKey(key), mValue(value, opaqueCopyProc)
 									{}
@@ -118,7 +119,15 @@ class CDictionary : public CEquatable {
 													// Instance methods
 				virtual	CDictionary::Count			getCount() const = 0;
 				virtual	OR<SValue>					getValue(const CString& key) const = 0;
+				virtual	OR<SValue>					getValue(const CString::Atom& keyAtom) const
+														{ return getValue(keyAtom.getString()); }
 				virtual	void						set(const CString& key, const SValue& value) = 0;
+				virtual	void						set(const CString& key, SValue&& value)
+														{ set(key, (const SValue&) value); }
+				virtual	void						set(const CString::Atom& keyAtom, const SValue& value)
+														{ set(keyAtom.getString(), value); }
+				virtual	void						set(const CString::Atom& keyAtom, SValue&& value)
+														{ set(keyAtom, (const SValue&) value); }
 				virtual	void						remove(const CString& key) = 0;
 				virtual	void						remove(const TSet<CString>& keys) = 0;
 				virtual	void						removeAll() = 0;
@@ -144,6 +153,7 @@ class CDictionary : public CEquatable {
 															SValue::OpaqueDisposeProc opaqueDisposeProc = nil);
 													CDictionary(const I<Backing>& backing);
 													CDictionary(const CDictionary& other);
+													CDictionary(CDictionary&& other);
 		virtual										~CDictionary();
 
 													// CEquatable methods
@@ -157,8 +167,10 @@ class CDictionary : public CEquatable {
 														{ return getCount() == 0; }
 
 		virtual			bool						contains(const CString& key) const;
+						bool						contains(const CString::Atom& keyAtom) const;
 
 				const	SValue&						getValue(const CString& key) const;
+				const	SValue&						getValue(const CString::Atom& keyAtom) const;
 						OV<SValue>					getOValue(const CString& key) const;
 						bool						getBool(const CString& key, bool defaultValue = false) const;
 						OV<bool>					getOVBool(const CString& key) const;
@@ -261,7 +273,10 @@ class CDictionary : public CEquatable {
 														{ outValue = getOVUInt64(key); }
 
 						void						set(const CString& key, bool value);
+						void						set(const CString::Atom& keyAtom, const SValue& value);
+						void						set(const CString::Atom& keyAtom, SValue&& value);
 						void						set(const CString& key, const TArray<CDictionary>& value);
+						void						set(const CString& key, TArray<CDictionary>&& value);
 						void						set(const CString& key, const OV<TArray<CDictionary> >& value)
 														{
 															// Check for value
@@ -273,6 +288,7 @@ class CDictionary : public CEquatable {
 																remove(key);
 														}
 						void						set(const CString& key, const TArray<CString>& value);
+						void						set(const CString& key, TArray<CString>&& value);
 						void						set(const CString& key, const OV<TArray<CString> >& value)
 														{
 															// Check for value
@@ -284,6 +300,7 @@ class CDictionary : public CEquatable {
 																remove(key);
 														}
 						void						set(const CString& key, const CData& value);
+						void						set(const CString& key, CData&& value);
 						void						set(const CString& key, const OV<CData>& value)
 														{
 															// Check for value
@@ -295,6 +312,7 @@ class CDictionary : public CEquatable {
 																remove(key);
 														}
 						void						set(const CString& key, const CDictionary& value);
+						void						set(const CString& key, CDictionary&& value);
 						void						set(const CString& key, const OV<CDictionary>& value)
 														{
 															// Check for value
@@ -306,6 +324,7 @@ class CDictionary : public CEquatable {
 																remove(key);
 														}
 						void						set(const CString& key, const CString& value);
+						void						set(const CString& key, CString&& value);
 						void						set(const CString& key, const OV<CString>& value)
 														{
 															// Check for value
@@ -428,6 +447,7 @@ class CDictionary : public CEquatable {
 														}
 						void						set(const CString& key, SValue::Opaque value);
 						void						set(const CString& key, const SValue& value);
+						void						set(const CString& key, SValue&& value);
 						void						set(const CString& key, const OV<SValue>& value)
 														{
 															// Check for value
@@ -464,7 +484,9 @@ class CDictionary : public CEquatable {
 						ValueIterator				getValueIterator() const;
 
 				const	OR<SValue>					operator[](const CString& key) const;
+				const	OR<SValue>					operator[](const CString::Atom& keyAtom) const;
 						CDictionary&				operator=(const CDictionary& other);
+						CDictionary&				operator=(CDictionary&& other);
 						CDictionary					operator+(const CDictionary& other) const;
 						CDictionary&				operator+=(const CDictionary& other);
 
@@ -531,6 +553,13 @@ template <typename T> class TDictionary : public CDictionary {
 
 										return opaque.hasValue() ? *((T*) *opaque) : defaultValue;
 									}
+		const	OR<T>			get(const CString::Atom& keyAtom) const
+									{
+										// Get value
+										OR<SValue>	value = CDictionary::operator[](keyAtom);
+
+										return value.hasReference() ? OR<T>(*((T*) value->getOpaque())) : OR<T>();
+									}
 
 				Iterator		getIterator() const
 									{ return Iterator(getIteratorInfo()); }
@@ -539,6 +568,8 @@ template <typename T> class TDictionary : public CDictionary {
 
 		const	OR<T>			operator[](const CString& key) const
 									{ return get(key); }
+		const	OR<T>			operator[](const CString::Atom& keyAtom) const
+									{ return get(keyAtom); }
 
 	protected:
 								// Lifecycle methods
@@ -615,6 +646,15 @@ template <typename T> class TNDictionary : public TMDictionary<T> {
 
 		void			set(const CString& key, const T& item)
 							{ CDictionary::set(key, new T(item)); }
+		void			set(const CString& key, T&& item)
+							{ CDictionary::set(key, new T(std::move(item))); }
+		void			set(const CString::Atom& keyAtom, const T& item)
+							{ CDictionary::set(keyAtom, SValue((SValue::Opaque) new T(item))); }
+		void			set(const CString::Atom& keyAtom, T&& item)
+							{ CDictionary::set(keyAtom, SValue((SValue::Opaque) new T(std::move(item)))); }
+		template <typename... A>
+		void			emplace(const CString& key, A&&... args)
+							{ CDictionary::set(key, new T(std::forward<A>(args)...)); }
 		void			set(const CString& key, const OV<T>& item)
 							{
 								// Check for instance
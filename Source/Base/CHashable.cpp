@@ -4,81 +4,56 @@
 
 #include "CHashable.h"
 
-//----------------------------------------------------------------------------------------------------------------------
-// MARK: Local data
-
-// Based on https://stackoverflow.com/questions/8317508/hash-function-for-a-string
-const	UInt32	kA = 54059; /* a prime */
-const	UInt32	kB = 76963; /* another prime */
-//const	UInt32	kC = 86969; /* yet another prime */
-const	UInt32	kInitialValue = 37; /* also prime */
+#define XXH_INLINE_ALL
+#include "xxhash.h"
 
 //----------------------------------------------------------------------------------------------------------------------
-//----------------------------------------------------------------------------------------------------------------------
-// MARK: - CHashable::HashCollector::Internals
-
-class CHashable::HashCollector::Internals {
-	public:
-				Internals() : mValue(kInitialValue) {}
-				~Internals() {}
-
-		void	add(const char* string)
-					{
-						// Iterate all characters
-						for (; *string != 0; string++)
-							// Update value
-							mValue = (mValue * kA) ^ ((UInt32) string[0] * kB);
-					}
-		void	add(const UInt8* bytePtr, const UInt32 byteCount)
-					{
-						// Iterate all bytes
-						for (UInt32 i = 0; i < byteCount; i++)
-							// Update value
-							mValue = (mValue * kA) ^ ((UInt32) bytePtr[i] * kB);
-					}
+// MARK: Local data
 
-		UInt32	mValue;
-};
+static_assert(sizeof(XXH3_state_t) <= 576, "CHashable::HashCollector state storage is too small for XXH3_state_t");
 
 //----------------------------------------------------------------------------------------------------------------------
 //----------------------------------------------------------------------------------------------------------------------
 // MARK: - CHashable::HashCollector
 
-// MARK: Lifecycle methods
-
-//----------------------------------------------------------------------------------------------------------------------
-CHashable::HashCollector::HashCollector()
-//----------------------------------------------------------------------------------------------------------------------
-{
-	mInternals = new Internals();
-}
-
-//----------------------------------------------------------------------------------------------------------------------
-CHashable::HashCollector::~HashCollector()
-//----------------------------------------------------------------------------------------------------------------------
-{
-	Delete(mInternals);
-}
-
 // MARK: Instance methods
 
 //----------------------------------------------------------------------------------------------------------------------
 void CHashable::HashCollector::add(const char* string)
 //----------------------------------------------------------------------------------------------------------------------
 {
-	mInternals->add(string);
+	add((const UInt8*) string, ::strlen(string));
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-void CHashable::HashCollector::add(const UInt8* bytePtr, const UInt32 byteCount)
+void CHashable::HashCollector::add(const UInt8* bytePtr, UInt64 byteCount)
 //----------------------------------------------------------------------------------------------------------------------
 {
-	mInternals->add(bytePtr, byteCount);
+	// Check if still collecting in the buffer
+	if (!mHasState) {
+		// Check if fits
+		if ((mBufferByteCount + byteCount) <= kBufferByteCount) {
+			// Collect
+			::memcpy(mBuffer + mBufferByteCount, bytePtr, (size_t) byteCount);
+			mBufferByteCount += (UInt32) byteCount;
+
+			return;
+		}
+
+		// Switch to streaming state
+		XXH3_64bits_reset((XXH3_state_t*) mState);
+		XXH3_64bits_update((XXH3_state_t*) mState, mBuffer, mBufferByteCount);
+		mHasState = true;
+	}
+
+	// Update state
+	XXH3_64bits_update((XXH3_state_t*) mState, bytePtr, (size_t) byteCount);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-UInt32 CHashable::HashCollector::getValue() const
+UInt64 CHashable::HashCollector::getValue64() const
 //----------------------------------------------------------------------------------------------------------------------
 {
-	return mInternals->mValue;	 // or return mValue % kC
+	return mHasState ?
+			XXH3_64bits_digest((const XXH3_state_t*) mState) : XXH3_64bits(mBuffer, mBufferByteCount);
 }
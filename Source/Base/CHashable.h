@@ -13,25 +13,30 @@ class CHashable : public CEquatable {
 	// HashCollector
 	public:
 		class HashCollector {
-			// Classes
-			private:
-				class Internals;
-
 			// Methods
 			public:
 						// Lifecycle methods
-						HashCollector();
-						~HashCollector();
+						HashCollector() : mBufferByteCount(0), mHasState(false) {}
 
 						// Instance methods
 				void	add(const char* string);
-				void	add(const UInt8* bytePtr, const UInt32 byteCount);
+				void	add(const UInt8* bytePtr, UInt64 byteCount);
 
-				UInt32	getValue() const;
+				UInt32	getValue() const
+							{ UInt64 value = getValue64(); return (UInt32) (value ^ (value >> 32)); }
+				UInt64	getValue64() const;
 
 			// Properties
 			private:
-				Internals*	mInternals;
+				// Short inputs (the common case) collect in mBuffer and are hashed in one shot.  Longer inputs spill
+				//	into the xxHash3 streaming state, which is only initialized when needed.
+				static	const	UInt32	kBufferByteCount = 240;
+				static	const	UInt32	kStateByteCount = 576;
+
+				alignas(64)	UInt8		mState[kStateByteCount];
+							UInt8		mBuffer[kBufferByteCount];
+							UInt32		mBufferByteCount;
+							bool		mHasState;
 		};
 
 	// Methods
@@ -42,6 +47,8 @@ class CHashable : public CEquatable {
 						// Instance methods
 				UInt32	getHashValue() const
 							{ HashCollector hashCollector; hashInto(hashCollector); return hashCollector.getValue(); }
+				UInt64	getHashValue64() const
+							{ HashCollector hashCollector; hashInto(hashCollector); return hashCollector.getValue64(); }
 
 						// Subclass methods
 		virtual	void	hashInto(HashCollector& hashCollector) const = 0;
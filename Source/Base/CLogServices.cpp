@@ -39,11 +39,24 @@ static	TNArray<SLogProcInfo>*	sLogMessageProcInfos = nil;
 static	TNArray<SLogProcInfo>*	sLogWarningProcInfos = nil;
 static	TNArray<SLogProcInfo>*	sLogErrorProcInfos = nil;
 
+// The local time zone offset is looked up again when the hour changes
+struct STimeZoneOffsetCache {
+	// Methods
+	STimeZoneOffsetCache() : mHour(0x7FFFFFFFFFFFFFFFLL), mTimeZoneOffset(0.0) {}
+
+	// Properties
+	SInt64					mHour;
+	UniversalTimeInterval	mTimeZoneOffset;
+};
+
+static	thread_local	STimeZoneOffsetCache	sTimeZoneOffsetCache;
+
 //----------------------------------------------------------------------------------------------------------------------
 //----------------------------------------------------------------------------------------------------------------------
 // MARK: - Local proc declarations
 
-static	CString	sStringWithDate(const CString& string, void* userData = nil);
+static	UInt32	sGetDateChars(char* buffer);
+static	CString	sStringWithDate(const CString& string);
 static	void	sLogToConsoleOutput(const CString& string);
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -74,9 +87,20 @@ void CLogServices::logMessage(const CString& string)
 void CLogServices::logMessages(const TArray<CString>& strings)
 //----------------------------------------------------------------------------------------------------------------------
 {
-	// Setup
-	TNArray<CString>	stringsWithDates(strings, (TNArray<CString>::MapProc) sStringWithDate);
-	CString				stringsWithDatesString(stringsWithDates, CString::mPlatformDefaultNewline);
+	// Compose
+	char				dateChars[SUniversalTime::kRFC3339MaxCharCount];
+	UInt32				dateCharCount = sGetDateChars(dateChars);
+	CString::Builder	stringBuilder;
+	for (TArray<CString>::Iterator iterator = strings.getIterator(); iterator; iterator++) {
+		// Check if need newline
+		if (!iterator.isFirst())
+			// Append newline
+			stringBuilder.append(CString::mPlatformDefaultNewline);
+
+		// Append
+		stringBuilder.append(dateChars, dateCharCount).append(": ").append(*iterator);
+	}
+	CString	stringsWithDatesString = stringBuilder.getString();
 
 	// Check if passing to output/console
 	if (sConsoleLoggingEnabled)
@@ -106,27 +130,35 @@ void CLogServices::logWarning(const CString& warning, const CString& when, const
 		UInt32 line)
 //----------------------------------------------------------------------------------------------------------------------
 {
-	logWarning(*CFilesystemPath(file).getLastComponent() + CString(OSSTR(" - warning ")) +
-			CString(OSSTR("\"")) + warning + CString(OSSTR("\"")) +
-			(!when.isEmpty() ? CString(OSSTR(" when ")) + when : CString::mEmpty) +
-			CString(OSSTR(", in ")) + func + CString(OSSTR("()")) +
-			((line != 0) ? CString(OSSTR(", line: ")) + CString(line) : CString::mEmpty));
+	// Compose
+	CString::Builder	stringBuilder;
+	stringBuilder.append(*CFilesystemPath(file).getLastComponent()).append(" - warning \"").append(warning)
+			.append("\"");
+	if (!when.isEmpty())
+		// Add when
+		stringBuilder.append(" when ").append(when);
+	stringBuilder.append(", in ").append(func).append("()");
+	if (line != 0)
+		// Add line
+		stringBuilder.append(", line: ").append(line);
+
+	logWarning(stringBuilder.getString());
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 void CLogServices::logWarning(const CString& string)
 //----------------------------------------------------------------------------------------------------------------------
 {
-	// Setup
-	CString				dateString = SGregorianDate().getString();
-
-	TNArray<CString>	strings;
-	strings += CString::mEmpty;
-	strings += dateString + CString(OSSTR(": *** WARNING ***"));
-	strings += dateString + CString(OSSTR(": ")) + string;
-	strings += CString::mEmpty;
-
-	CString	compositeString(strings, CString::mPlatformDefaultNewline);
+	// Compose
+	char				dateChars[SUniversalTime::kRFC3339MaxCharCount];
+	UInt32				dateCharCount = sGetDateChars(dateChars);
+	CString::Builder	stringBuilder;
+	stringBuilder.append(CString::mPlatformDefaultNewline);
+	stringBuilder.append(dateChars, dateCharCount).append(": *** WARNING ***");
+	stringBuilder.append(CString::mPlatformDefaultNewline);
+	stringBuilder.append(dateChars, dateCharCount).append(": ").append(string);
+	stringBuilder.append(CString::mPlatformDefaultNewline);
+	CString	compositeString = stringBuilder.getString();
 
 	// Check if passing to output/console
 	if (sConsoleLoggingEnabled)
@@ -145,27 +177,35 @@ void CLogServices::logWarning(const CString& string)
 void CLogServices::logError(const CString& error, const CString& when, const CString& file, const CString& func, UInt32 line)
 //----------------------------------------------------------------------------------------------------------------------
 {
-	logError(*CFilesystemPath(file).getLastComponent() + CString(OSSTR(" - error ")) +
-			CString(OSSTR("\"")) + error + CString(OSSTR("\"")) +
-			(!when.isEmpty() ? CString(OSSTR(" when ")) + when : CString::mEmpty) +
-			CString(OSSTR(", in ")) + func + CString(OSSTR("()")) +
-			((line != 0) ? CString(OSSTR(", line: ")) + CString(line) : CString::mEmpty));
+	// Compose
+	CString::Builder	stringBuilder;
+	stringBuilder.append(*CFilesystemPath(file).getLastComponent()).append(" - error \"").append(error)
+			.append("\"");
+	if (!when.isEmpty())
+		// Add when
+		stringBuilder.append(" when ").append(when);
+	stringBuilder.append(", in ").append(func).append("()");
+	if (line != 0)
+		// Add line
+		stringBuilder.append(", line: ").append(line);
+
+	logError(stringBuilder.getString());
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 void CLogServices::logError(const CString& string)
 //----------------------------------------------------------------------------------------------------------------------
 {
-	// Setup
-	CString				dateString = SGregorianDate().getString();
-
-	TNArray<CString>	strings;
-	strings += CString::mEmpty;
-	strings += dateString + CString(OSSTR(": *** ERROR ***"));
-	strings += dateString + CString(OSSTR(": ")) + string;
-	strings += CString::mEmpty;
-
-	CString	compositeString(strings, CString::mPlatformDefaultNewline);
+	// Compose
+	char				dateChars[SUniversalTime::kRFC3339MaxCharCount];
+	UInt32				dateCharCount = sGetDateChars(dateChars);
+	CString::Builder	stringBuilder;
+	stringBuilder.append(CString::mPlatformDefaultNewline);
+	stringBuilder.append(dateChars, dateCharCount).append(": *** ERROR ***");
+	stringBuilder.append(CString::mPlatformDefaultNewline);
+	stringBuilder.append(dateChars, dateCharCount).append(": ").append(string);
+	stringBuilder.append(CString::mPlatformDefaultNewline);
+	CString	compositeString = stringBuilder.getString();
 
 	// Check if passing to output/console
 	if (sConsoleLoggingEnabled)
@@ -232,10 +272,33 @@ void CLogServices::enableConsoleLogging()
 // MARK: - Local proc definitions
 
 //----------------------------------------------------------------------------------------------------------------------
-CString	sStringWithDate(const CString& string, void* userData)
+UInt32 sGetDateChars(char* buffer)
 //----------------------------------------------------------------------------------------------------------------------
 {
-	return SGregorianDate().getString() + CString(OSSTR(": ")) + string;
+	// Setup
+	UniversalTime	time = SUniversalTime::getCurrent();
+	SInt64			hour = (SInt64) (time / kUniversalTimeIntervalHour);
+
+	// Check if need to update time zone offset
+	if (hour != sTimeZoneOffsetCache.mHour) {
+		// Update
+		sTimeZoneOffsetCache.mHour = hour;
+		sTimeZoneOffsetCache.mTimeZoneOffset = SGregorianDate::getCurrentTimeZoneOffset();
+	}
+
+	return SUniversalTime::getRFC3339Chars(time, buffer, sTimeZoneOffsetCache.mTimeZoneOffset);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CString	sStringWithDate(const CString& string)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Setup
+	char				dateChars[SUniversalTime::kRFC3339MaxCharCount];
+	UInt32				dateCharCount = sGetDateChars(dateChars);
+	CString::Builder	stringBuilder;
+
+	return stringBuilder.append(dateChars, dateCharCount).append(": ").append(string).getString();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
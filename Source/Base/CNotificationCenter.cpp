@@ -27,8 +27,10 @@ class CNotificationCenter::Internals {
 
 		void	registerObserver(const CString& notificationName, const Sender& sender, const Observer& observer)
 					{
-						// Get existing observer infos
-						OR<TNArray<ObserverInfo> >	observerInfos = mInfo[notificationName];
+						// Get existing observer infos.  Notification names are keyed by atom so send() can match
+						//	by pointer.
+						CString::Atom				notificationNameAtom(notificationName);
+						OR<TNArray<ObserverInfo> >	observerInfos = mInfo[notificationNameAtom];
 
 						// Add
 						if (observerInfos.hasReference())
@@ -36,12 +38,14 @@ class CNotificationCenter::Internals {
 							(*observerInfos).add(ObserverInfo(sender, observer));
 						else
 							// First
-							mInfo.set(notificationName, TNArray<ObserverInfo>(ObserverInfo(sender, observer)));
+							mInfo.set(notificationNameAtom, TNArray<ObserverInfo>(ObserverInfo(sender, observer)));
 					}
 		void	registerObserver(const CString& notificationName, const Observer& observer)
 					{
-						// Get existing observer infos
-						OR<TNArray<ObserverInfo> >	observerInfos = mInfo[notificationName];
+						// Get existing observer infos.  Notification names are keyed by atom so send() can match
+						//	by pointer.
+						CString::Atom				notificationNameAtom(notificationName);
+						OR<TNArray<ObserverInfo> >	observerInfos = mInfo[notificationNameAtom];
 
 						// Add
 						if (observerInfos.hasReference())
@@ -49,7 +53,7 @@ class CNotificationCenter::Internals {
 							(*observerInfos).add(ObserverInfo(observer));
 						else
 							// First
-							mInfo.set(notificationName, TNArray<ObserverInfo>(ObserverInfo(observer)));
+							mInfo.set(notificationNameAtom, TNArray<ObserverInfo>(ObserverInfo(observer)));
 					}
 		void	unregisterObserver(const CString& notificationName, Observer::Ref observerRef)
 					{
@@ -162,8 +166,13 @@ void CNotificationCenter::unregisterObserver(Observer::Ref observerRef)
 void CNotificationCenter::send(const CString& notificationName, const OR<Sender>& sender, const CDictionary& info) const
 //----------------------------------------------------------------------------------------------------------------------
 {
-	// Setup
-	OR<TNArray<Internals::ObserverInfo> >	observerInfos = mInternals->mInfo[notificationName];
+	// Setup.  A notification name that was never registered has no atom and so no observers.
+	OV<CString::Atom>	notificationNameAtom = CString::Atom::find(notificationName);
+	if (!notificationNameAtom.hasValue())
+		// No observers
+		return;
+
+	OR<TNArray<Internals::ObserverInfo> >	observerInfos = mInternals->mInfo[*notificationNameAtom];
 	if (!observerInfos.hasReference())
 		// No observers
 		return;
@@ -7,7 +7,33 @@
 #include "PlatformDefinitions.h"
 
 //----------------------------------------------------------------------------------------------------------------------
-// MARK: CReferenceCountable
+// MARK: SReferenceCount
+//	Build with REFERENCE_COUNT_STATISTICS defined to count every reference added to a shared count.  Benchmarks use
+//		this to report the atomic increments an operation does.
+
+struct SReferenceCount {
+	// Methods
+	public:
+										// Class methods
+										// Adds a reference to the given count
+		static	void					add(std::atomic<UInt32>& referenceCount)
+											{
+												// Add reference
+												referenceCount++;
+#if defined(REFERENCE_COUNT_STATISTICS)
+												// Count
+												getAddsCount().fetch_add(1, std::memory_order_relaxed);
+#endif
+											}
+#if defined(REFERENCE_COUNT_STATISTICS)
+										// Returns the number of references added so far
+		static	std::atomic<UInt64>&	getAddsCount()
+											{ static std::atomic<UInt64> sAddsCount(0); return sAddsCount; }
+#endif
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - CReferenceCountable
 
 class CReferenceCountable {
 	// Methods
@@ -42,7 +68,7 @@ class CReferenceCountable {
 
 						// Subclass methods
 				void	addReferenceInternal()
-							{ (*mReferenceCount)++; }
+							{ SReferenceCount::add(*mReferenceCount); }
 				UInt32	getReferenceCount() const
 							{ return mReferenceCount->load(); }
 
@@ -6,283 +6,191 @@
 
 #include "CppToolboxAssert.h"
 #include "CReferenceCountable.h"
+#include "CSlabAllocator.h"
+#include "TRobinHoodSlots.h"
 
 //----------------------------------------------------------------------------------------------------------------------
 // MARK: CSet::Internals
+//	Items are held in a TRobinHoodSlots index, so growing re-slots from the cached hash values and never rehashes the
+//		items.
 
-class CSet::Internals : public TCopyOnWriteReferenceCountable<Internals> {
+class CSet::Internals : public TCopyOnWriteReferenceCountable<Internals>, public CSlabAllocatable {
 	public:
-		struct ItemInfo {
-			public:
-						ItemInfo(UInt32 hashValue, CHashable* hashable) :
-							mHashValue(hashValue), mHashable(hashable), mNextItemInfo(nil)
-							{}
-
-				bool	doesMatch(UInt32 hashValue, const CHashable& hashable)
-							{ return (hashValue == mHashValue) && (hashable == *mHashable); }
-
-				UInt32		mHashValue;
-				CHashable*	mHashable;
-				ItemInfo*	mNextItemInfo;
-		};
+		typedef	TRobinHoodSlots<CHashable>::Slot	Slot;
 
 	public:
-		class IteratorInfo : public CSet::IteratorInfo {
+		class IteratorInfo : public CSet::IteratorInfo, public CSlabAllocatable {
 			public:
-							IteratorInfo(const Internals& internals, UInt32 initialReference, UInt32 itemInfosIndex,
-									Internals::ItemInfo* initialItemInfo) :
+							IteratorInfo(const Internals& internals, UInt32 initialReference) :
 								mInternals(internals),
-										mInitialReference(initialReference), mCurrentItemInfoIndex(itemInfosIndex),
-										mCurrentItemInfo(initialItemInfo),
+										mInitialReference(initialReference), mCurrentSlotIndex(0),
 										mCurrentIndex(0)
-								{}
+								{
+									// Find first slot
+									findSlot();
+								}
 
 				UInt32		getCurrentIndex() const
 								{ return mCurrentIndex; }
 				CHashable*	getCurrentItem() const
-								{ return (mCurrentItemInfo != nil) ? mCurrentItemInfo->mHashable : nil; }
+								{
+									return (mCurrentSlotIndex < mInternals.mSlots.getSlotsCount()) ?
+											mInternals.mSlots.getSlot(mCurrentSlotIndex).mItem : nil;
+								}
 				CHashable*	advance()
 								{
 									// Internals check
 									AssertFailIf(mInitialReference != mInternals.mReference);
 
-									// Check for additional item info in linked list
-									if (mCurrentItemInfo->mNextItemInfo != nil) {
-										// Have next item info
-										mCurrentItemInfo = mCurrentItemInfo->mNextItemInfo;
-										mCurrentIndex++;
-									} else {
-										// End of item info linked list
-										while ((++mCurrentItemInfoIndex < mInternals.mItemInfosCount) &&
-												(mInternals.mItemInfos[mCurrentItemInfoIndex] == nil)) ;
-
-										// Check if found another item info
-										if (mCurrentItemInfoIndex < mInternals.mItemInfosCount) {
-											// Found another item info
-											mCurrentItemInfo = mInternals.mItemInfos[mCurrentItemInfoIndex];
-											mCurrentIndex++;
-										} else
-											// No more item infos
-											mCurrentItemInfo = nil;
-									}
-
-									return (mCurrentItemInfo != nil) ? mCurrentItemInfo->mHashable : nil;
+									// Advance
+									mCurrentSlotIndex++;
+									mCurrentIndex++;
+									findSlot();
+
+									return getCurrentItem();
 								}
 
-				const	Internals&				mInternals;
+			private:
+				void		findSlot()
+								{
+									// Skip empty slots
+									while ((mCurrentSlotIndex < mInternals.mSlots.getSlotsCount()) &&
+											(mInternals.mSlots.getSlot(mCurrentSlotIndex).mItem == nil))
+										// Next slot
+										mCurrentSlotIndex++;
+								}
 
-						UInt32					mInitialReference;
-						UInt32					mCurrentItemInfoIndex;
-						Internals::ItemInfo*	mCurrentItemInfo;
+			private:
+				const	Internals&	mInternals;
 
-						UInt32					mCurrentIndex;
-		};
+						UInt32		mInitialReference;
+						UInt32		mCurrentSlotIndex;
 
+						UInt32		mCurrentIndex;
+		};
 
 	public:
 										Internals(CSet::CopyProc copyProc, CSet::DisposeProc disposeProc) :
 											TCopyOnWriteReferenceCountable(),
 													mCopyProc(copyProc), mDisposeProc(disposeProc),
-													mCount(0), mReference(0), mItemInfosCount(16)
-											{
-												mItemInfos = (ItemInfo**) ::calloc(mItemInfosCount, sizeof(ItemInfo*));
-											}
+													mCount(0), mReference(0)
+											{}
 										Internals(const Internals& other) :
 											TCopyOnWriteReferenceCountable(),
-													mCopyProc(other.mCopyProc),
-													mDisposeProc(other.mDisposeProc),
-													mCount(other.mCount), mReference(0),
-													mItemInfosCount(other.mItemInfosCount)
+													mCopyProc(other.mCopyProc), mDisposeProc(other.mDisposeProc),
+													mCount(other.mCount), mReference(0), mSlots(other.mSlots)
 											{
-												// Finish setup
-												mItemInfos = (ItemInfo**) ::calloc(mItemInfosCount, sizeof(ItemInfo*));
-
-												for (UInt32 i = 0; i < mItemInfosCount; i++) {
-													// Setup for this linked list
-													ItemInfo*	otherItemInfo = other.mItemInfos[i];
-													ItemInfo*	internalsItemInfo = nil;
-
-													while (otherItemInfo != nil) {
-														// Clone
-														ItemInfo*	itemInfo =
-																			new ItemInfo(
-																					otherItemInfo->mHashValue,
-																					(mCopyProc != nil) ?
-																							mCopyProc(
-																									*otherItemInfo->
-																											mHashable) :
-																							otherItemInfo->mHashable);
-
-														// Check for first in the linked list
-														if (internalsItemInfo == nil) {
-															// First in this linked list
-															mItemInfos[i] = itemInfo;
-															internalsItemInfo = mItemInfos[i];
-														} else {
-															// Next one in this linked list
-															internalsItemInfo->mNextItemInfo = itemInfo;
-															internalsItemInfo = internalsItemInfo->mNextItemInfo;
-														}
-
-														// Next
-														otherItemInfo = otherItemInfo->mNextItemInfo;
+												// Check if have copy proc
+												if (mCopyProc != nil) {
+													// Slot layout only depends on the hash values, so copy the items in
+													//	place
+													for (UInt32 i = 0; i < mSlots.getSlotsCount(); i++) {
+														// Check if have hashable
+														Slot&	slot = mSlots.getSlot(i);
+														if (slot.mItem != nil)
+															// Copy
+															slot.mItem = mCopyProc(*slot.mItem);
 													}
 												}
 											}
 										~Internals()
 											{
-												// Iterate all item infos
-												for (UInt32 i = 0; i < mItemInfosCount; i++) {
-													// Check if have an item info
-													if (mItemInfos[i] != nil)
-														// Remove this chain
-														remove(mItemInfos[i]);
-												}
-
-												::free(mItemInfos);
+												// Cleanup
+												removeAllInternal();
 											}
 
 						void			insert(const CHashable& hashable)
 											{
 												// Setup
-												UInt32		hashValue = hashable.getHashValue();
-												UInt32		index = hashValue & (mItemInfosCount - 1);
-												ItemInfo*	itemInfo =
-																	new ItemInfo(hashValue,
-																			(mCopyProc != nil) ?
-																					mCopyProc(hashable) :
-																					(CHashable*) &hashable);
+												UInt32	hashValue = hashable.getHashValue();
 
-												// Find
-												ItemInfo*	previousItemInfo = nil;
-												ItemInfo*	currentItemInfo = mItemInfos[index];
-												while ((currentItemInfo != nil) &&
-														!currentItemInfo->doesMatch(hashValue, hashable)) {
-													// Next in linked list
-													previousItemInfo = currentItemInfo;
-													currentItemInfo = currentItemInfo->mNextItemInfo;
-												}
+												// Check if already have
+												if (mSlots.find(hashValue, hashable, isMatch) != nil)
+													// Already have
+													return;
 
-												// Check results
-												if (currentItemInfo == nil) {
-													// Did not find
-													if (previousItemInfo == nil)
-														// First one
-														mItemInfos[index] = itemInfo;
-													else
-														// Add to the end
-														previousItemInfo->mNextItemInfo = itemInfo;
-
-													// Update info
-													mCount++;
-													mReference++;
-												}
-											}
-						bool			contains(const CHashable& hashable)
-											{
-												// Setup
-												UInt32	hashValue = hashable.getHashValue();
-												UInt32	index = hashValue & (mItemInfosCount - 1);
+												// Make room
+												mSlots.reserve(mCount + 1);
 
-												// Find item info that matches
-												ItemInfo*	itemInfo = mItemInfos[index];
-												while ((itemInfo != nil) && !itemInfo->doesMatch(hashValue, hashable))
-													// Advance to next item info
-													itemInfo = itemInfo->mNextItemInfo;
+												// Insert
+												mSlots.add(hashValue,
+														(mCopyProc != nil) ? mCopyProc(hashable) : (CHashable*) &hashable);
 
-												return itemInfo != nil;
+												// Update info
+												mCount++;
+												mReference++;
 											}
+						bool			contains(const CHashable& hashable) const
+											{ return mSlots.find(hashable.getHashValue(), hashable, isMatch) != nil; }
 						void			remove(const CHashable& hashable)
 											{
-												// Setup
-												UInt32	hashValue = hashable.getHashValue();
-												UInt32	index = hashValue & (mItemInfosCount - 1);
-
 												// Find
-												ItemInfo*	previousItemInfo = nil;
-												ItemInfo*	currentItemInfo = mItemInfos[index];
-												while ((currentItemInfo != nil) &&
-														!currentItemInfo->doesMatch(hashValue, hashable)) {
-													// Next in linked list
-													previousItemInfo = currentItemInfo;
-													currentItemInfo = currentItemInfo->mNextItemInfo;
-												}
+												Slot*	slot = mSlots.find(hashable.getHashValue(), hashable, isMatch);
+												if (slot == nil)
+													// Not found
+													return;
 
-												// Check if found
-												if (currentItemInfo != nil) {
-													// Remove
-													if (previousItemInfo == nil)
-														// First in linked list
-														mItemInfos[index] = currentItemInfo->mNextItemInfo;
-													else
-														// Some other item info in linked list
-														previousItemInfo->mNextItemInfo =
-																currentItemInfo->mNextItemInfo;
-
-													// Check if have dispose proc
-													if (mDisposeProc != nil)
-														// Dispose
-														mDisposeProc(currentItemInfo->mHashable);
-
-													// Cleanup this one
-													Delete(currentItemInfo);
-
-													// Update info
-													mCount--;
-													mReference++;
-												}
+												// Check if have dispose proc
+												if (mDisposeProc != nil)
+													// Dispose
+													mDisposeProc(slot->mItem);
+
+												// Remove
+												mSlots.remove(*slot);
+
+												// Update info
+												mCount--;
+												mReference++;
 											}
 						void			removeAll()
 											{
-												// Iterate all item infos
-												for (UInt32 i = 0; i < mItemInfosCount; i++) {
-													// Check if have an item info
-													if (mItemInfos[i] != nil) {
-														// Remove this chain
-														remove(mItemInfos[i]);
-
-														// Clear
-														mItemInfos[i] = nil;
-													}
-												}
+												// Remove all
+												removeAllInternal();
+												mSlots.removeAll();
 
 												// Update info
 												mCount = 0;
 												mReference++;
 											}
-						void			remove(ItemInfo* itemInfo)
+				const	OR<CHashable>	getAny() const
 											{
-												// Check for next item info
-												if (itemInfo->mNextItemInfo != nil)
-													// Remove the next item info
-													remove(itemInfo->mNextItemInfo);
-
-												// Check if have dispose proc
-												if (mDisposeProc != nil)
-													// Dispose
-													mDisposeProc(itemInfo->mHashable);
+												// Find first slot
+												for (UInt32 i = 0; i < mSlots.getSlotsCount(); i++) {
+													// Check if have hashable
+													if (mSlots.getSlot(i).mItem != nil)
+														// Found
+														return OR<CHashable>(*mSlots.getSlot(i).mItem);
+												}
 
-												// Cleanup this one
-												Delete(itemInfo);
+												return OR<CHashable>();
 											}
-				const	OR<CHashable>	getAny() const
-											{
-												// Find first item info
-												UInt32	index = 0;
-												while ((mItemInfos[index] == nil) && (++index < mItemInfosCount)) ;
 
-												return (index < mItemInfosCount) ?
-													OR<CHashable>(*mItemInfos[index]->mHashable) : OR<CHashable>();
+	private:
+						void			removeAllInternal()
+											{
+												// Check if have dispose proc
+												if (mDisposeProc != nil) {
+													// Iterate all slots
+													for (UInt32 i = 0; i < mSlots.getSlotsCount(); i++) {
+														// Check if have hashable
+														if (mSlots.getSlot(i).mItem != nil)
+															// Dispose
+															mDisposeProc(mSlots.getSlot(i).mItem);
+													}
+												}
 											}
 
-		CSet::CopyProc		mCopyProc;
-		CSet::DisposeProc	mDisposeProc;
+		static			bool			isMatch(const CHashable& item, const CHashable& hashable)
+											{ return hashable == item; }
+
+	public:
+		CSet::CopyProc				mCopyProc;
+		CSet::DisposeProc			mDisposeProc;
 
-		CSet::ItemCount		mCount;
-		UInt32				mReference;
+		CSet::ItemCount				mCount;
+		UInt32						mReference;
 
-		ItemInfo**			mItemInfos;
-		UInt32				mItemInfosCount;
+		TRobinHoodSlots<CHashable>	mSlots;
 };
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -381,16 +289,7 @@ const OR<CHashable> CSet::getAny() const
 I<CSet::IteratorInfo> CSet::getIteratorInfo() const
 //----------------------------------------------------------------------------------------------------------------------
 {
-	// Find first item info
-	for (UInt32 i = 0; i < mInternals->mItemInfosCount; i++) {
-		// Check if have item in this slot
-		if (mInternals->mItemInfos[i] != nil)
-			// Found first item
-			return I<IteratorInfo>(
-					new Internals::IteratorInfo(*mInternals, mInternals->mReference, i, mInternals->mItemInfos[i]));
-	}
-
-	return I<IteratorInfo>(new Internals::IteratorInfo(*mInternals, mInternals->mReference, 0, nil));
+	return I<IteratorInfo>(new Internals::IteratorInfo(*mInternals, mInternals->mReference));
 }
 
 //----------------------------------------------------------------------------------------------------------------------
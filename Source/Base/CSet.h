@@ -5,7 +5,9 @@
 #pragma once
 
 #include "CArray.h"
+#include "CBits.h"
 #include "CHashable.h"
+#include "CReferenceCountable.h"
 
 //----------------------------------------------------------------------------------------------------------------------
 // MARK: CSet
@@ -364,62 +366,320 @@ template <typename T> class TNSet : public TMSet<T> {
 
 //----------------------------------------------------------------------------------------------------------------------
 // MARK: - TNumberSet
+//	TNumberSets hold their values inline in a flat, open-addressed table with a separate occupancy bitmap, so there
+//		is no per-value allocation and lookups touch a single contiguous run of values.
 
-template <typename T> class TNumberSet : public TMSet<TNumber<T> > {
+template <typename T> class TNumberSet {
 	// Types
 	public:
 		typedef	T	(*ArrayMapProc)(CArray::ItemRef item);
 
+	// Internals
+	private:
+		class Internals : public TCopyOnWriteReferenceCountable<Internals> {
+			public:
+								Internals() :
+									TCopyOnWriteReferenceCountable<Internals>(),
+											mCount(0), mSlotsCount(0), mValues(nil), mOccupiedBits(nil)
+									{}
+								Internals(const Internals& other) :
+									TCopyOnWriteReferenceCountable<Internals>(),
+											mCount(other.mCount), mSlotsCount(other.mSlotsCount),
+											mValues((T*) ::malloc(mSlotsCount * sizeof(T))),
+											mOccupiedBits((UInt64*) ::malloc(getOccupiedBitsCount() * sizeof(UInt64)))
+									{
+										// Copy
+										::memcpy(mValues, other.mValues, mSlotsCount * sizeof(T));
+										::memcpy(mOccupiedBits, other.mOccupiedBits,
+												getOccupiedBitsCount() * sizeof(UInt64));
+									}
+								~Internals()
+									{ ::free(mValues); ::free(mOccupiedBits); }
+
+						bool	contains(T value) const
+									{ return findSlotIndex(value).hasValue(); }
+						void	insert(T value)
+									{
+										// Check if already have
+										if (contains(value))
+											// Already have
+											return;
+
+										// Check if need more slots
+										if (((mCount + 1) * 4) > (mSlotsCount * 3))
+											// Grow
+											resizeSlots((mSlotsCount > 0) ? mSlotsCount * 2 : 16);
+
+										// Insert
+										insertSlot(value);
+										mCount++;
+									}
+						void	remove(T value)
+									{
+										// Find
+										OV<UInt32>	slotIndex = findSlotIndex(value);
+										if (!slotIndex.hasValue())
+											// Not found
+											return;
+
+										// Shift following values back into the hole wherever that keeps them
+										//	reachable from their home slot
+										UInt32	mask = mSlotsCount - 1;
+										UInt32	holeIndex = *slotIndex;
+										for (UInt32 index = (holeIndex + 1) & mask; isOccupied(index);
+												index = (index + 1) & mask) {
+											// Check if can move
+											UInt32	homeIndex = getHashValue(mValues[index]) & mask;
+											if (((index - homeIndex) & mask) >= ((index - holeIndex) & mask)) {
+												// Move
+												mValues[holeIndex] = mValues[index];
+												holeIndex = index;
+											}
+										}
+										mOccupiedBits[holeIndex >> 6] &= ~(1ULL << (holeIndex & 63));
+
+										// Update info
+										mCount--;
+									}
+						void	removeAll()
+									{
+										// Clear occupancy
+										if (mOccupiedBits != nil)
+											::memset(mOccupiedBits, 0, getOccupiedBitsCount() * sizeof(UInt64));
+										mCount = 0;
+									}
+
+						bool	isOccupied(UInt32 index) const
+									{ return (mOccupiedBits[index >> 6] & (1ULL << (index & 63))) != 0; }
+						OV<UInt32>	getNextOccupiedIndex(UInt32 index) const
+									{
+										// Scan bitmap words from index
+										UInt32	occupiedBitsCount = getOccupiedBitsCount();
+										for (UInt32 wordIndex = index >> 6; wordIndex < occupiedBitsCount;
+												wordIndex++) {
+											// Mask off bits before index in the first word
+											UInt64	bits = mOccupiedBits[wordIndex];
+											if (wordIndex == (index >> 6))
+												bits &= ~0ULL << (index & 63);
+
+											// Check bits
+											if (bits != 0)
+												// Found
+												return OV<UInt32>((wordIndex << 6) + CBits::countTrailingZeros(bits));
+										}
+
+										return OV<UInt32>();
+									}
+
+			private:
+						UInt32	getOccupiedBitsCount() const
+									{ return (mSlotsCount + 63) >> 6; }
+						OV<UInt32>	findSlotIndex(T value) const
+									{
+										// Check if have slots
+										if (mCount == 0)
+											// Nothing to find
+											return OV<UInt32>();
+
+										// Probe
+										UInt32	mask = mSlotsCount - 1;
+										for (UInt32 index = getHashValue(value) & mask; isOccupied(index);
+												index = (index + 1) & mask) {
+											// Check value
+											if (mValues[index] == value)
+												// Found
+												return OV<UInt32>(index);
+										}
+
+										return OV<UInt32>();
+									}
+						void	insertSlot(T value)
+									{
+										// Probe for an empty slot
+										UInt32	mask = mSlotsCount - 1;
+										UInt32	index = getHashValue(value) & mask;
+										while (isOccupied(index))
+											// Next slot
+											index = (index + 1) & mask;
+
+										// Store
+										mValues[index] = value;
+										mOccupiedBits[index >> 6] |= 1ULL << (index & 63);
+									}
+						void	resizeSlots(UInt32 slotsCount)
+									{
+										// Setup
+										T*		previousValues = mValues;
+										UInt64*	previousOccupiedBits = mOccupiedBits;
+										UInt32	previousSlotsCount = mSlotsCount;
+
+										// Update
+										mSlotsCount = slotsCount;
+										mValues = (T*) ::malloc(mSlotsCount * sizeof(T));
+										mOccupiedBits = (UInt64*) ::calloc(getOccupiedBitsCount(), sizeof(UInt64));
+
+										// Re-insert
+										for (UInt32 i = 0; i < previousSlotsCount; i++) {
+											// Check if occupied
+											if ((previousOccupiedBits[i >> 6] & (1ULL << (i & 63))) != 0)
+												// Insert
+												insertSlot(previousValues[i]);
+										}
+
+										// Cleanup
+										::free(previousValues);
+										::free(previousOccupiedBits);
+									}
+
+				static	UInt32	getHashValue(T value)
+									{
+										// Mix the value bits (64-bit finalizer) so sequential values spread out
+										UInt64	bits = 0;
+										::memcpy(&bits, &value,
+												(sizeof(T) < sizeof(UInt64)) ? sizeof(T) : sizeof(UInt64));
+										bits ^= bits >> 33;
+										bits *= 0xFF51AFD7ED558CCDULL;
+										bits ^= bits >> 33;
+										bits *= 0xC4CEB9FE1A85EC53ULL;
+										bits ^= bits >> 33;
+
+										return (UInt32) bits;
+									}
+
+			public:
+				UInt32	mCount;
+				UInt32	mSlotsCount;
+				T*		mValues;
+				UInt64*	mOccupiedBits;
+		};
+
+	// Iterator
+	public:
+		class Iterator : public CIterator {
+			// Methods
+			public:
+						// Lifecycle methods
+						Iterator(const Internals& internals) :
+							CIterator(),
+									mInternals(((Internals&) internals).addReference()), mIndex(0),
+									mSlotIndex(internals.getNextOccupiedIndex(0))
+							{}
+						Iterator(const Iterator& other) :
+							CIterator(other),
+									mInternals(other.mInternals->addReference()), mIndex(other.mIndex),
+									mSlotIndex(other.mSlotIndex)
+							{}
+						~Iterator()
+							{ mInternals->removeReference(); }
+
+						// CIterator methods
+				bool	isValid() const
+							{ return mSlotIndex.hasValue(); }
+				UInt32	getIndex() const
+							{ return mIndex; }
+				void	advance()
+							{ mIndex++; mSlotIndex = mInternals->getNextOccupiedIndex(*mSlotIndex + 1); }
+
+						// Instance methods
+				T		getValue() const
+							{ return mInternals->mValues[*mSlotIndex]; }
+
+				T		operator*() const
+							{ return mInternals->mValues[*mSlotIndex]; }
+
+			// Properties
+			private:
+				Internals*	mInternals;
+				UInt32		mIndex;
+				OV<UInt32>	mSlotIndex;
+		};
+
 	// Methods
 	public:
 								// Lifecycle methods
-								TNumberSet() : TMSet<TNumber<T> >((CSet::CopyProc) copy, (CSet::DisposeProc) dispose) {}
-								TNumberSet(T value) :
-									TMSet<TNumber<T> >((CSet::CopyProc) copy, (CSet::DisposeProc) dispose)
-									{ TMSet<TNumber<T> >::insert(TNumber<T>(value)); }
+								TNumberSet() : mInternals(new Internals()) {}
+								TNumberSet(T value) : mInternals(new Internals()) { mInternals->insert(value); }
 								TNumberSet(const CArray& array, ArrayMapProc arrayMapProc) :
-									TMSet<TNumber<T> >((CSet::CopyProc) copy, (CSet::DisposeProc) dispose)
+									mInternals(new Internals())
 									{
 										// Iterate items
-										ItemCount	count = array.getCount();
+										CArray::ItemCount	count = array.getCount();
 										for (CArray::ItemIndex i = 0; i < count; i++)
 											// Insert
-											insert(arrayMapProc(array.getItemAt(i)));
+											mInternals->insert(arrayMapProc(array.getItemAt(i)));
 									}
+								TNumberSet(const TNumberSet<T>& other) : mInternals(other.mInternals->addReference()) {}
+		virtual					~TNumberSet()
+									{ mInternals->removeReference(); }
 
 								// Instance methods
+				UInt32			getCount() const
+									{ return mInternals->mCount; }
+				bool			isEmpty() const
+									{ return mInternals->mCount == 0; }
+
 				bool			contains(T value) const
-									{ return TMSet<TNumber<T> >::contains(TNumber<T>(value)); }
+									{ return mInternals->contains(value); }
 
 				TNumberSet<T>&	insert(T value)
-									{ TMSet<TNumber<T> >::insert(TNumber<T>(value)); return *this; }
+									{
+										// Insert
+										Internals::prepareForWrite(&mInternals);
+										mInternals->insert(value);
+
+										return *this;
+									}
 				TNumberSet<T>&	remove(T value)
-									{ TMSet<TNumber<T> >::remove(TNumber<T>(value)); return *this; }
+									{
+										// Remove
+										Internals::prepareForWrite(&mInternals);
+										mInternals->remove(value);
+
+										return *this;
+									}
+				TNumberSet<T>&	removeAll()
+									{
+										// Remove all
+										Internals::prepareForWrite(&mInternals);
+										mInternals->removeAll();
+
+										return *this;
+									}
 
 				TNumberArray<T>	getNumberArray() const
 									{
 										// Setup
 										TNumberArray<T>	array;
 
-										// Iterate all hashables
-										for (typename TSet<TNumber<T> >::Iterator iterator =
-														TSet<TNumber<T> >::getIterator();
-												iterator; iterator++)
+										// Iterate all values
+										for (Iterator iterator = getIterator(); iterator; iterator++)
 											// Add
-											array += **iterator;
+											array += *iterator;
 
 										return array;
 									}
 
+				Iterator		getIterator() const
+									{ return Iterator(*mInternals); }
+
+				TNumberSet<T>&	operator=(const TNumberSet<T>& other)
+									{
+										// Check for same
+										if (this == &other)
+											return *this;
+
+										// Update
+										mInternals->removeReference();
+										mInternals = other.mInternals->addReference();
+
+										return *this;
+									}
 				TNumberSet<T>&	operator+=(T value)
 									{ return insert(value); }
 				TNumberSet<T>&	operator-=(T value)
 									{ return remove(value); }
 
+	// Properties
 	private:
-								// Class methods
-		static	TNumber<T>*		copy(const CHashable& hashable)
-									{ return new TNumber<T>(*((TNumber<T>*) &hashable)); }
-		static	void			dispose(const CHashable* hashable)
-									{ TNumber<T>* t = (TNumber<T>*) hashable; Delete(t); }
+		Internals*	mInternals;
 };
@@ -0,0 +1,367 @@
+//----------------------------------------------------------------------------------------------------------------------
+//	CSlabAllocator.cpp			©2026 Stevo Brock	All rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+
+#include "CSlabAllocator.h"
+
+#include "ConcurrencyPrimitives.h"
+#include "CppToolboxAssert.h"
+
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: Local data
+
+// Slabs and arenas are carved from chunks.  Arena requests too big for a chunk get a chunk of their own.
+static	const	size_t	kChunkByteCount = 64 * 1024;
+static	const	size_t	kChunkHeaderByteCount = 64;
+
+static	const	size_t	kSizeClassByteCount = 16;
+static	const	UInt32	kSizeClassCount = (UInt32) (CSlabAllocator::kMaximumByteCount / kSizeClassByteCount);
+static	const	UInt32	kMagazineBlockCount = 32;
+
+struct SChunk {
+	SChunk*	mNext;
+};
+
+struct SBlock {
+	SBlock*	mNext;
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - Local procs
+
+//----------------------------------------------------------------------------------------------------------------------
+static SChunk* sNewChunk(size_t byteCount = kChunkByteCount)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Allocate
+	SChunk*	chunk = (SChunk*) ::malloc(byteCount);
+	AssertNotNil(chunk);
+
+	// Setup
+	chunk->mNext = nil;
+
+	return chunk;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - CSlabDepot
+
+class CSlabDepot {
+	public:
+						CSlabDepot()
+							{
+								// Setup
+								for (UInt32 i = 0; i < kSizeClassCount; i++) {
+									// Setup
+									mFreeBlocks[i] = nil;
+									mFreeBlockCounts[i] = 0;
+								}
+							}
+
+				SBlock*	take(UInt32 sizeClassIndex, UInt32 maxBlockCount, UInt32& blockCount)
+							{
+								// Lock
+								mLocks[sizeClassIndex].lock();
+
+								// Check if need a new slab
+								if (mFreeBlocks[sizeClassIndex] == nil)
+									// Add slab
+									addSlab(sizeClassIndex);
+
+								// Detach up to the requested number of blocks
+								SBlock*	firstBlock = mFreeBlocks[sizeClassIndex];
+								SBlock*	lastBlock = firstBlock;
+								blockCount = 1;
+								while ((blockCount < maxBlockCount) && (lastBlock->mNext != nil)) {
+									// Next block
+									lastBlock = lastBlock->mNext;
+									blockCount++;
+								}
+								mFreeBlocks[sizeClassIndex] = lastBlock->mNext;
+								mFreeBlockCounts[sizeClassIndex] -= blockCount;
+								lastBlock->mNext = nil;
+
+								// Unlock
+								mLocks[sizeClassIndex].unlock();
+
+								return firstBlock;
+							}
+				void	put(UInt32 sizeClassIndex, SBlock* firstBlock, SBlock* lastBlock, UInt32 blockCount)
+							{
+								// Lock
+								mLocks[sizeClassIndex].lock();
+
+								// Attach
+								lastBlock->mNext = mFreeBlocks[sizeClassIndex];
+								mFreeBlocks[sizeClassIndex] = firstBlock;
+								mFreeBlockCounts[sizeClassIndex] += blockCount;
+
+								// Unlock
+								mLocks[sizeClassIndex].unlock();
+							}
+
+		static	CSlabDepot&	shared()
+							{
+								// Created on first use so allocations made by other static initializers are served
+								static	CSlabDepot*	sSlabDepot = new CSlabDepot();
+
+								return *sSlabDepot;
+							}
+
+	private:
+				void	addSlab(UInt32 sizeClassIndex)
+							{
+								// Setup
+								size_t	blockByteCount = (sizeClassIndex + 1) * kSizeClassByteCount;
+								UInt32	blockCount =
+												(UInt32) ((kChunkByteCount - kChunkHeaderByteCount) / blockByteCount);
+								UInt8*	firstBlockPtr = (UInt8*) sNewChunk() + kChunkHeaderByteCount;
+
+								// Link blocks
+								for (UInt32 i = 0; i < blockCount; i++)
+									// Link to next block
+									((SBlock*) (firstBlockPtr + i * blockByteCount))->mNext =
+											((i + 1) < blockCount) ?
+													(SBlock*) (firstBlockPtr + (i + 1) * blockByteCount) : nil;
+
+								// Store
+								mFreeBlocks[sizeClassIndex] = (SBlock*) firstBlockPtr;
+								mFreeBlockCounts[sizeClassIndex] = blockCount;
+							}
+
+		CLock	mLocks[kSizeClassCount];
+		SBlock*	mFreeBlocks[kSizeClassCount];
+		UInt32	mFreeBlockCounts[kSizeClassCount];
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - CSlabAllocator::Arena::Internals
+
+class CSlabAllocator::Arena::Internals {
+	public:
+				Internals() : mChunk(nil), mNextBytePtr(nil), mEndBytePtr(nil) {}
+				~Internals()
+					{
+						// Release all chunks
+						while (mChunk != nil) {
+							// Release
+							SChunk*	chunk = mChunk;
+							mChunk = mChunk->mNext;
+							::free(chunk);
+						}
+					}
+
+		void*	allocate(size_t byteCount)
+					{
+						// Keep blocks aligned to the size class size
+						byteCount = (byteCount + kSizeClassByteCount - 1) & ~(kSizeClassByteCount - 1);
+
+						// Check if too big to share a chunk
+						if (byteCount > (kChunkByteCount - kChunkHeaderByteCount)) {
+							// Add a chunk of its own behind the current one
+							SChunk*	chunk = sNewChunk(kChunkHeaderByteCount + byteCount);
+							if (mChunk != nil) {
+								// Link behind
+								chunk->mNext = mChunk->mNext;
+								mChunk->mNext = chunk;
+							} else
+								// First chunk
+								mChunk = chunk;
+
+							return (UInt8*) chunk + kChunkHeaderByteCount;
+						}
+
+						// Check if have room
+						if ((mNextBytePtr + byteCount) > mEndBytePtr) {
+							// Add chunk
+							SChunk*	chunk = sNewChunk();
+							chunk->mNext = mChunk;
+							mChunk = chunk;
+							mNextBytePtr = (UInt8*) chunk + kChunkHeaderByteCount;
+							mEndBytePtr = (UInt8*) chunk + kChunkByteCount;
+						}
+
+						// Bump
+						void*	ptr = mNextBytePtr;
+						mNextBytePtr += byteCount;
+
+						return ptr;
+					}
+
+		SChunk*	mChunk;
+		UInt8*	mNextBytePtr;
+		UInt8*	mEndBytePtr;
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - Thread cache
+
+// Kept trivially constructible so it is usable at any point in the life of a thread, including during static
+//	destruction after SThreadCacheRetirer has run.
+struct SThreadCache {
+	SBlock*	mFreeBlocks[kSizeClassCount];
+	UInt32	mFreeBlockCounts[kSizeClassCount];
+	bool	mIsActive;
+	bool	mIsRetired;
+};
+
+static	thread_local	SThreadCache	sThreadCache;
+
+// Returns the thread's cached blocks to the depot when the thread exits
+struct SThreadCacheRetirer {
+	~SThreadCacheRetirer()
+		{
+			// Iterate size classes
+			for (UInt32 i = 0; i < kSizeClassCount; i++) {
+				// Check if have blocks
+				SBlock*	firstBlock = sThreadCache.mFreeBlocks[i];
+				if (firstBlock != nil) {
+					// Find last block
+					SBlock*	lastBlock = firstBlock;
+					while (lastBlock->mNext != nil)
+						lastBlock = lastBlock->mNext;
+
+					// Return to depot
+					CSlabDepot::shared().put(i, firstBlock, lastBlock, sThreadCache.mFreeBlockCounts[i]);
+					sThreadCache.mFreeBlocks[i] = nil;
+					sThreadCache.mFreeBlockCounts[i] = 0;
+				}
+			}
+
+			// Go direct to the depot from now on
+			sThreadCache.mIsRetired = true;
+		}
+};
+
+static	thread_local	SThreadCacheRetirer	sThreadCacheRetirer;
+
+//----------------------------------------------------------------------------------------------------------------------
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - CSlabAllocator::Arena
+
+// MARK: Lifecycle methods
+
+//----------------------------------------------------------------------------------------------------------------------
+CSlabAllocator::Arena::Arena()
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Setup
+	mInternals = new Internals();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CSlabAllocator::Arena::~Arena()
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Cleanup
+	Delete(mInternals);
+}
+
+// MARK: Instance methods
+
+//----------------------------------------------------------------------------------------------------------------------
+void* CSlabAllocator::Arena::allocate(size_t byteCount)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	return mInternals->allocate(byteCount);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - CSlabAllocator
+
+// MARK: Class methods
+
+//----------------------------------------------------------------------------------------------------------------------
+void* CSlabAllocator::allocate(size_t byteCount)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Check size
+	if (byteCount > kMaximumByteCount)
+		// Too big for a slab
+		return ::malloc(byteCount);
+
+	// Setup
+	SThreadCache&	threadCache = sThreadCache;
+	UInt32			sizeClassIndex = (byteCount > 0) ? (UInt32) ((byteCount - 1) / kSizeClassByteCount) : 0;
+
+	// Check if need to refill the magazine
+	if (threadCache.mFreeBlocks[sizeClassIndex] == nil) {
+		// Check if thread has exited
+		UInt32	blockCount;
+		if (threadCache.mIsRetired)
+			// Take one block directly
+			return CSlabDepot::shared().take(sizeClassIndex, 1, blockCount);
+
+		// Check if first use on this thread
+		if (!threadCache.mIsActive) {
+			// Arrange for cached blocks to be returned when this thread exits
+			(void) &sThreadCacheRetirer;
+			threadCache.mIsActive = true;
+		}
+
+		// Refill
+		threadCache.mFreeBlocks[sizeClassIndex] =
+				CSlabDepot::shared().take(sizeClassIndex, kMagazineBlockCount, blockCount);
+		threadCache.mFreeBlockCounts[sizeClassIndex] = blockCount;
+	}
+
+	// Pop block
+	SBlock*	block = threadCache.mFreeBlocks[sizeClassIndex];
+	threadCache.mFreeBlocks[sizeClassIndex] = block->mNext;
+	threadCache.mFreeBlockCounts[sizeClassIndex]--;
+
+	return block;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void CSlabAllocator::deallocate(void* ptr, size_t byteCount)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Check for nil
+	if (ptr == nil)
+		return;
+
+	// Check size
+	if (byteCount > kMaximumByteCount) {
+		// Was not from a slab
+		::free(ptr);
+
+		return;
+	}
+
+	// Setup
+	SThreadCache&	threadCache = sThreadCache;
+	UInt32			sizeClassIndex = (byteCount > 0) ? (UInt32) ((byteCount - 1) / kSizeClassByteCount) : 0;
+	SBlock*			block = (SBlock*) ptr;
+
+	// Check if thread has exited
+	if (threadCache.mIsRetired) {
+		// Return directly
+		block->mNext = nil;
+		CSlabDepot::shared().put(sizeClassIndex, block, block, 1);
+
+		return;
+	}
+
+	// Push block
+	block->mNext = threadCache.mFreeBlocks[sizeClassIndex];
+	threadCache.mFreeBlocks[sizeClassIndex] = block;
+
+	// Check if magazine is overfull
+	if (++threadCache.mFreeBlockCounts[sizeClassIndex] >= (kMagazineBlockCount * 2)) {
+		// Return a magazine's worth to the depot
+		SBlock*	firstBlock = threadCache.mFreeBlocks[sizeClassIndex];
+		SBlock*	lastBlock = firstBlock;
+		for (UInt32 i = 1; i < kMagazineBlockCount; i++)
+			// Next block
+			lastBlock = lastBlock->mNext;
+		threadCache.mFreeBlocks[sizeClassIndex] = lastBlock->mNext;
+		threadCache.mFreeBlockCounts[sizeClassIndex] -= kMagazineBlockCount;
+		CSlabDepot::shared().put(sizeClassIndex, firstBlock, lastBlock, kMagazineBlockCount);
+	}
+}
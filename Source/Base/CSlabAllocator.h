@@ -0,0 +1,71 @@
+//----------------------------------------------------------------------------------------------------------------------
+//	CSlabAllocator.h			©2026 Stevo Brock	All rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include "PlatformDefinitions.h"
+
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: CSlabAllocator
+//	CSlabAllocator serves small blocks (up to kMaximumByteCount bytes) from size-classed slabs.  Each thread keeps a
+//		magazine of free blocks per size class, so most allocations and frees touch no shared state; magazines are
+//		refilled from and drained to a locked per-size-class depot in batches.  Slab memory is kept for reuse and is
+//		not returned to the system.  Larger requests go straight to malloc() and free().
+//
+//	An Arena is a separate bump allocator that is only ever used explicitly, through Arena::allocate().  Its blocks
+//		are never freed one at a time; all of its memory is released at once when the Arena is destroyed.  Nothing
+//		reaches an Arena implicitly, so objects created with new or CSlabAllocatable can never land in arena memory
+//		and outlive it.  The owner of anything placed in an Arena destroys it in place before the Arena goes away.
+
+class CSlabAllocator {
+	// Arena
+	public:
+		class Arena {
+			// Classes
+			public:
+				class Internals;
+
+			// Methods
+			public:
+						// Lifecycle methods
+						Arena();
+						~Arena();
+
+						// Instance methods
+				void*	allocate(size_t byteCount);
+
+			private:
+						Arena(const Arena& other);
+				Arena&	operator=(const Arena& other);
+
+			// Properties
+			private:
+				Internals*	mInternals;
+		};
+
+	// Methods
+	public:
+								// Class methods
+		static	void*			allocate(size_t byteCount);
+		static	void			deallocate(void* ptr, size_t byteCount);
+
+	// Properties
+	public:
+		static	const	size_t	kMaximumByteCount = 256;
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - CSlabAllocatable
+//	Classes opt into CSlabAllocator by inheriting from CSlabAllocatable.  Deleting through a base class pointer
+//		requires a virtual destructor so the correct byte count reaches deallocate().
+
+class CSlabAllocatable {
+	// Methods
+	public:
+						// Class methods
+		static	void*	operator new(size_t byteCount)
+							{ return CSlabAllocator::allocate(byteCount); }
+		static	void	operator delete(void* ptr, size_t byteCount)
+							{ CSlabAllocator::deallocate(ptr, byteCount); }
+};
@@ -5,6 +5,9 @@
 #include "CString.h"
 
 #include "CData.h"
+#include "ConcurrencyPrimitives.h"
+#include "CppToolboxAssert.h"
+#include "CSlabAllocator.h"
 #include "TBuffer.h"
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -18,6 +21,190 @@ const	UInt64	kDisplayAsKiBThreshhold = 4097;
 const	UInt64	kDisplayAsMiBThreshHold = 1000 * 1024;
 const	UInt64	kDisplayAsGiBThreshHold = 1024 * 1024 * 1024;
 
+struct SSharedBufferHeader {
+	std::atomic<UInt32>	mReferenceCount;
+	UInt64				mByteCount;
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - CAtomTable
+//	Open-addressed, linearly probed table of interned atom infos.  Infos are never removed, so lookups only need to
+//		hold off resizing.
+
+class CAtomTable {
+	public:
+											CAtomTable() : mCount(0), mSlotsCount(0), mSlots(nil) {}
+
+		const	CString::Atom::Info*		find(const CString& string, UInt32 hashValue) const
+												{
+													// Find
+													mLock.lockForReading();
+													const	CString::Atom::Info*	info = findInfo(string, hashValue);
+													mLock.unlockForReading();
+
+													return info;
+												}
+		const	CString::Atom::Info*		intern(const CString& string)
+												{
+													// Check if already have
+															UInt32					hashValue = string.getHashValue();
+													const	CString::Atom::Info*	info = find(string, hashValue);
+													if (info != nil)
+														// Have
+														return info;
+
+													// Check again now that we have exclusive access
+													mLock.lockForWriting();
+													info = findInfo(string, hashValue);
+													if (info == nil) {
+														// Check if need more slots
+														if (((mCount + 1) * 4) > (mSlotsCount * 3))
+															// Grow
+															resizeSlots((mSlotsCount > 0) ? mSlotsCount * 2 : 256);
+
+														// Add
+														info = new CString::Atom::Info(string);
+														insertInfo(info);
+														mCount++;
+													}
+													mLock.unlockForWriting();
+
+													return info;
+												}
+
+		static	CAtomTable&					shared()
+												{
+													// Setup - never destroyed as atoms may outlive static cleanup
+													static	CAtomTable*	sAtomTable = new CAtomTable();
+
+													return *sAtomTable;
+												}
+
+	private:
+		const	CString::Atom::Info*		findInfo(const CString& string, UInt32 hashValue) const
+												{
+													// Check if have slots
+													if (mSlotsCount == 0)
+														// Nothing to find
+														return nil;
+
+													// Probe
+													UInt32	mask = mSlotsCount - 1;
+													for (UInt32 index = hashValue & mask;; index = (index + 1) & mask) {
+														// Check slot
+														const	CString::Atom::Info*	info = mSlots[index];
+														if (info == nil)
+															// Not found
+															return nil;
+														else if ((info->mHashValue == hashValue) && (info->mString == string))
+															// Found
+															return info;
+													}
+												}
+				void						insertInfo(const CString::Atom::Info* info)
+												{
+													// Probe for an empty slot
+													UInt32	mask = mSlotsCount - 1;
+													UInt32	index = info->mHashValue & mask;
+													while (mSlots[index] != nil)
+														// Next slot
+														index = (index + 1) & mask;
+
+													// Store
+													mSlots[index] = info;
+												}
+				void						resizeSlots(UInt32 slotsCount)
+												{
+													// Setup
+															UInt32					previousSlotsCount = mSlotsCount;
+													const	CString::Atom::Info**	previousSlots = mSlots;
+
+													// Update
+													mSlotsCount = slotsCount;
+													mSlots =
+															(const CString::Atom::Info**)
+																	::calloc(mSlotsCount,
+																			sizeof(const CString::Atom::Info*));
+
+													// Re-insert
+													for (UInt32 i = 0; i < previousSlotsCount; i++) {
+														// Check if have info
+														if (previousSlots[i] != nil)
+															// Insert
+															insertInfo(previousSlots[i]);
+													}
+
+													// Cleanup
+													::free(previousSlots);
+												}
+
+	private:
+				CReadPreferringLock			mLock;
+
+				UInt32						mCount;
+				UInt32						mSlotsCount;
+		const	CString::Atom::Info**		mSlots;
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - CString::Atom
+
+// MARK: Lifecycle methods
+
+//----------------------------------------------------------------------------------------------------------------------
+CString::Atom::Atom(const CString& string) : mInfo(CAtomTable::shared().intern(string))
+//----------------------------------------------------------------------------------------------------------------------
+{
+}
+
+// MARK: Class methods
+
+//----------------------------------------------------------------------------------------------------------------------
+OV<CString::Atom> CString::Atom::find(const CString& string)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Find
+	const	Info*	info = CAtomTable::shared().find(string, string.getHashValue());
+
+	return (info != nil) ? OV<Atom>(Atom(info)) : OV<Atom>();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - CString::C
+
+// MARK: Class methods
+
+//----------------------------------------------------------------------------------------------------------------------
+char* CString::C::newSharedBuffer(Length length, std::atomic<UInt32>*& referenceCount)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Allocate header and chars together
+	UInt64					byteCount = sizeof(SSharedBufferHeader) + length;
+	SSharedBufferHeader*	sharedBufferHeader = (SSharedBufferHeader*) CSlabAllocator::allocate(byteCount);
+	new (&sharedBufferHeader->mReferenceCount) std::atomic<UInt32>(1);
+	sharedBufferHeader->mByteCount = byteCount;
+
+	// Store
+	referenceCount = &sharedBufferHeader->mReferenceCount;
+
+	return (char*) (sharedBufferHeader + 1);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void CString::C::releaseSharedBuffer(std::atomic<UInt32>* referenceCount)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Check if last reference
+	if (--(*referenceCount) == 0) {
+		// Cleanup
+		SSharedBufferHeader*	sharedBufferHeader = (SSharedBufferHeader*) referenceCount;
+		CSlabAllocator::deallocate(sharedBufferHeader, sharedBufferHeader->mByteCount);
+	}
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 //----------------------------------------------------------------------------------------------------------------------
 // MARK: - CString
@@ -345,7 +532,20 @@ OV<SInt32> CString::getOVSInt32() const
 SInt64 CString::getSInt64(UInt8 base) const
 //----------------------------------------------------------------------------------------------------------------------
 {
-	return ::strtoll(*getUTF8String(), nil, base);
+	// Setup
+	const	C	chars = getUTF8String();
+
+	// Check base
+	if (base == 10) {
+		// Parse, leaving what SNumber does not handle (leading whitespace, out of range) to strtoll
+		const	char*	charPtr = *chars;
+				SInt64	value;
+		if (SNumber::getSInt64(charPtr, charPtr + ::strlen(*chars), value))
+			// Success
+			return value;
+	}
+
+	return ::strtoll(*chars, nil, base);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -408,7 +608,20 @@ OSType CString::getOSType() const
 UInt64 CString::getUInt64(UInt8 base) const
 //----------------------------------------------------------------------------------------------------------------------
 {
-	return ::strtoull(*getUTF8String(), nil, base);
+	// Setup
+	const	C	chars = getUTF8String();
+
+	// Check base
+	if (base == 10) {
+		// Parse, leaving what SNumber does not handle (leading whitespace, negative, out of range) to strtoull
+		const	char*	charPtr = *chars;
+				UInt64	value;
+		if (SNumber::getUInt64(charPtr, charPtr + ::strlen(*chars), value))
+			// Success
+			return value;
+	}
+
+	return ::strtoull(*chars, nil, base);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -629,3 +842,185 @@ CString CString::make(OSStringType format, ...)
 
 	return string;
 }
+
+//----------------------------------------------------------------------------------------------------------------------
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - CString::Builder
+
+// MARK: Lifecycle methods
+
+//----------------------------------------------------------------------------------------------------------------------
+CString::Builder::Builder(UInt64 byteCount) : mChars(mInlineChars), mByteCount(0), mCapacity(kInlineByteCount)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Reserve
+	reserve(byteCount);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CString::Builder::~Builder()
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Check if grew out of the inline buffer
+	if (mChars != mInlineChars)
+		// Cleanup
+		::free(mChars);
+}
+
+// MARK: Instance methods
+
+//----------------------------------------------------------------------------------------------------------------------
+void CString::Builder::reserve(UInt64 byteCount)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Check if need to grow
+	if (byteCount <= mCapacity)
+		// Have room
+		return;
+
+	// Grow by at least double so appending stays linear
+	UInt64	capacity = std::max<UInt64>(byteCount, mCapacity * 2);
+	char*	chars = (char*) ::malloc((size_t) capacity);
+	AssertNotNil(chars);
+
+	// Move
+	::memcpy(chars, mChars, (size_t) mByteCount);
+	if (mChars != mInlineChars)
+		// Cleanup
+		::free(mChars);
+
+	// Update
+	mChars = chars;
+	mCapacity = capacity;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CString::Builder& CString::Builder::append(const char* chars, UInt64 byteCount)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Append
+	reserve(mByteCount + byteCount);
+	::memcpy(mChars + mByteCount, chars, (size_t) byteCount);
+	mByteCount += byteCount;
+
+	return *this;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CString::Builder& CString::Builder::append(const CString& string)
+//----------------------------------------------------------------------------------------------------------------------
+{
+#if defined(TARGET_OS_LINUX)
+	// Append our UTF-8 directly
+	return append(string.getChars(), string.mByteCount);
+#else
+	// Append UTF-8
+	const	C	chars = string.getUTF8String();
+
+	return append(*chars, ::strlen(*chars));
+#endif
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CString::Builder& CString::Builder::append(SInt64 value)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Format in place
+	reserve(mByteCount + SNumber::kIntegerMaxCharCount);
+	mByteCount += SNumber::getChars(value, mChars + mByteCount);
+
+	return *this;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CString::Builder& CString::Builder::append(UInt64 value)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Format in place
+	reserve(mByteCount + SNumber::kIntegerMaxCharCount);
+	mByteCount += SNumber::getChars(value, mChars + mByteCount);
+
+	return *this;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CString::Builder& CString::Builder::append(Float64 value)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Format in place
+	reserve(mByteCount + SNumber::kFloatMaxCharCount);
+	mByteCount += SNumber::getChars(value, mChars + mByteCount);
+
+	return *this;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CString::Builder& CString::Builder::append(OSType osType, bool isOSType, bool includeQuotes)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Setup
+	char	chars[6] =
+					{'\'', (char) ((osType >> 24) & 0xFF), (char) ((osType >> 16) & 0xFF),
+							(char) ((osType >> 8) & 0xFF), (char) (osType & 0xFF), '\''};
+
+	// Check for anything outside of ASCII
+	for (UInt32 i = 1; i < 5; i++) {
+		// Check char
+		if ((UInt8) chars[i] >= 0x80)
+			// MacRoman chars must be transcoded
+			return append(CString(osType, isOSType, includeQuotes));
+	}
+
+	return includeQuotes ? append(chars, 6) : append(chars + 1, 4);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CString::Builder& CString::Builder::append(const TArray<CString>& components, const char* separator)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Setup
+	UInt64	separatorByteCount = ::strlen(separator);
+
+	// Iterate components
+	for (TArray<CString>::Iterator iterator = components.getIterator(); iterator; iterator++) {
+		// Check if need separator
+		if (!iterator.isFirst())
+			// Append separator
+			append(separator, separatorByteCount);
+
+		// Append component
+		append(*iterator);
+	}
+
+	return *this;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CString::Builder& CString::Builder::appendRepeated(const char* chars, UInt32 count, const char* separator)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Setup
+	UInt64	byteCount = ::strlen(chars);
+	UInt64	separatorByteCount = ::strlen(separator);
+
+	// Append
+	reserve(mByteCount + (byteCount + separatorByteCount) * count);
+	for (UInt32 i = 0; i < count; i++) {
+		// Check if need separator
+		if (i > 0)
+			// Append separator
+			append(separator, separatorByteCount);
+
+		// Append
+		append(chars, byteCount);
+	}
+
+	return *this;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+CString CString::Builder::getString() const
+//----------------------------------------------------------------------------------------------------------------------
+{
+	return CString(mChars, mByteCount, kEncodingUTF8);
+}
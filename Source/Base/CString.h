@@ -16,6 +16,10 @@
 	#define OSStringType	CFStringRef
 	#define OSStringVar(s)	CFStringRef s
 	#define	OSSTR(s)		CFSTR(s)
+#elif defined(TARGET_OS_LINUX)
+	#define OSStringType	const char*
+	#define OSStringVar(s)	const char s[]
+	#define OSSTR(s)		s
 #elif defined(TARGET_OS_WINDOWS)
 	#define OSStringType	const TCHAR*
 	#define OSStringVar(s)	const TCHAR s[]
@@ -174,23 +178,41 @@ class CString : public CHashable {
 					// Lifecycle methods
 					C(Length length)
 						{
-							// Setup
-							mBuffer = new char[std::max<Length>(length, 1)];
+							// Check length
+							if (length <= sizeof(mInlineBuffer)) {
+								// Use inline buffer
+								mBuffer = mInlineBuffer;
+								mReferenceCount = nil;
+							} else {
+								// Allocate
+								mBuffer = newSharedBuffer(length, mReferenceCount);
+							}
 							mBuffer[0] = 0;
-
-							mReferenceCount = new std::atomic<UInt32>(1);
 						}
-					C(const C& other) :
-						mBuffer(other.mBuffer), mReferenceCount(other.mReferenceCount)
-						{ (*mReferenceCount)++; }
+					C(char* buffer, std::atomic<UInt32>* referenceCount) :
+						mBuffer(buffer), mReferenceCount(referenceCount)
+						{ SReferenceCount::add(*mReferenceCount); }
+					C(const C& other)
+						{
+							// Check if other is inline
+							if (other.mReferenceCount == nil) {
+								// Copy
+								::memcpy(mInlineBuffer, other.mInlineBuffer, sizeof(mInlineBuffer));
+								mBuffer = mInlineBuffer;
+								mReferenceCount = nil;
+							} else {
+								// Share
+								mBuffer = other.mBuffer;
+								mReferenceCount = other.mReferenceCount;
+								SReferenceCount::add(*mReferenceCount);
+							}
+						}
 					~C()
 						{
 							// Check if need to cleanup
-							if (--(*mReferenceCount) == 0) {
-								// Cleanup
-								DeleteArray(mBuffer);
-								Delete(mReferenceCount);
-							}
+							if (mReferenceCount != nil)
+								// Release
+								releaseSharedBuffer(mReferenceCount);
 						}
 
 					// Instance methods
@@ -199,11 +221,74 @@ class CString : public CHashable {
 
 			char*	operator*() const
 						{ return mBuffer; }
+			C&		operator=(const C& other)
+						{
+							// Check for same
+							if (this == &other)
+								return *this;
+
+							// Replace
+							this->~C();
+							new (this) C(other);
+
+							return *this;
+						}
+
+					// Class methods
+					//	Shared buffers carry their reference count in a header in front of the chars and come from
+					//		CSlabAllocator, so short-lived long strings avoid two trips to the heap.
+			static	char*	newSharedBuffer(Length length, std::atomic<UInt32>*& referenceCount);
+			static	void	releaseSharedBuffer(std::atomic<UInt32>* referenceCount);
 
 			// Properties
 			private:
 				char*					mBuffer;
 				std::atomic<UInt32>*	mReferenceCount;
+				char					mInlineBuffer[24];
+		};
+
+	// Classes
+	public:
+		class Builder;
+
+	// Atom - a string interned in a global table.  All atoms for equal strings share one Info, so atoms compare by
+	//	pointer and carry a precomputed hash value.  Interned strings live for the life of the process, so atoms are
+	//	meant for bounded sets of strings like dictionary keys, notification names, and column names.
+	public:
+		class Atom {
+			// Info
+			public:
+				struct Info;
+
+			// Methods
+			public:
+											// Lifecycle methods
+				explicit					Atom(const CString& string);
+											Atom(const Atom& other) : mInfo(other.mInfo) {}
+
+											// Instance methods
+				inline	const	CString&	getString() const;
+				inline			UInt32		getHashValue() const;
+						const	Info*		getInfo() const
+												{ return mInfo; }
+
+								bool		operator==(const Atom& other) const
+												{ return mInfo == other.mInfo; }
+								bool		operator!=(const Atom& other) const
+												{ return mInfo != other.mInfo; }
+								Atom&		operator=(const Atom& other)
+												{ mInfo = other.mInfo; return *this; }
+
+											// Class methods
+				static			OV<Atom>	find(const CString& string);
+
+			private:
+											// Lifecycle methods
+											Atom(const Info* info) : mInfo(info) {}
+
+			// Properties
+			private:
+				const	Info*	mInfo;
 		};
 
 	// Methods
@@ -211,6 +296,7 @@ class CString : public CHashable {
 											// Lifecycle methods
 											CString();
 											CString(const CString& other);
+											CString(CString&& other);
 											CString(OSStringVar(initialString));
 											CString(const char chars[], CString::Length maxLength, Encoding encoding);
 											CString(const void* ptr, UInt64 byteCount, Encoding encoding);
@@ -256,8 +342,7 @@ class CString : public CHashable {
 												{ return equals((const CString&) other); }
 
 											// CHashable methods
-						void				hashInto(CHashable::HashCollector& hashableHashCollector) const
-												{ getUTF8String().hashInto(hashableHashCollector); }
+						void				hashInto(CHashable::HashCollector& hashableHashCollector) const;
 
 											// Instance methods
 						OSStringType		getOSString() const;
@@ -357,6 +442,7 @@ class CString : public CHashable {
 						bool				operator==(const CString& other) const
 												{ return equals(other); }
 						CString&			operator=(const CString& other);
+						CString&			operator=(CString&& other);
 						CString&			operator+=(const CString& other);
 						CString				operator+(const CString& other) const;
 												
@@ -376,7 +462,7 @@ class CString : public CHashable {
 		static			bool				isEmpty(const CString& string, void* userData);
 		static			bool				isNotEmpty(const CString& string, void* userData);
 
-#if defined(TARGET_OS_WINDOWS)
+#if defined(TARGET_OS_LINUX) || defined(TARGET_OS_WINDOWS)
 		static			void				setupLocalization(const CData& stringsFileData);
 #endif
 		static			bool				hasLocalizationFor(const CString& localizationGroup,
@@ -385,6 +471,13 @@ class CString : public CHashable {
 	protected:
 											// Internal methods
 						void				init();
+#if defined(TARGET_OS_LINUX)
+						void				init(const char* chars, UInt64 byteCount, UInt64 length);
+						void				cleanup();
+				const	char*				getChars() const
+												{ return (mByteCount <= kInlineByteCount) ?
+														mInlineChars : mSharedChars.mChars; }
+#endif
 
 	// Properties
 	public:
@@ -418,11 +511,100 @@ class CString : public CHashable {
 	private:
 #if defined(TARGET_OS_IOS) || defined(TARGET_OS_MACOS) || defined(TARGET_OS_TVOS) || defined(TARGET_OS_WATCHOS)
 						CFStringRef					mStringRef;
+#elif defined(TARGET_OS_LINUX)
+		// UTF-8 storage.  Strings of up to kInlineByteCount bytes live inline, longer strings share a reference
+		//	counted heap buffer laid out exactly as C expects, so getUTF8String() can hand it out without copying.
+		static	const	UInt32			kInlineByteCount = 23;
+
+						union {
+							char	mInlineChars[kInlineByteCount + 1];
+							struct {
+								char*					mChars;
+								std::atomic<UInt32>*	mReferenceCount;
+							}		mSharedChars;
+						};
+						UInt64			mByteCount;
+						UInt64			mLength;
 #elif defined(TARGET_OS_WINDOWS)
 						std::basic_string<TCHAR>	mString;
 #endif
 };
 
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - CString::Builder
+//	CString::Builder accumulates UTF-8 in one growable buffer, so a long string composed from many pieces costs only
+//		the bytes appended instead of a new CString and a full copy per +.  Short strings never leave the inline
+//		buffer.  Numbers are formatted in place with SNumber.  The result is materialized once with getString().
+
+class CString::Builder {
+	// Methods
+	public:
+						// Lifecycle methods
+						Builder(UInt64 byteCount = 0);
+						~Builder();
+
+						// Instance methods
+		UInt64			getByteCount() const
+							{ return mByteCount; }
+		void			reserve(UInt64 byteCount);
+
+		Builder&		append(const char* chars, UInt64 byteCount);
+		Builder&		append(const char* chars)
+							{ return append(chars, ::strlen(chars)); }
+		Builder&		append(const CString& string);
+		Builder&		append(SInt32 value)
+							{ return append((SInt64) value); }
+		Builder&		append(SInt64 value);
+		Builder&		append(UInt32 value)
+							{ return append((UInt64) value); }
+		Builder&		append(UInt64 value);
+		Builder&		append(Float64 value);
+		Builder&		append(OSType osType, bool isOSType, bool includeQuotes = true);
+		Builder&		append(const TArray<CString>& components, const char* separator);
+		Builder&		appendRepeated(const char* chars, UInt32 count, const char* separator);
+
+		CString			getString() const;
+
+	private:
+						Builder(const Builder& other);
+		Builder&		operator=(const Builder& other);
+
+	// Properties
+	private:
+		static	const	UInt32	kInlineByteCount = 256;
+
+						char*	mChars;
+						UInt64	mByteCount;
+						UInt64	mCapacity;
+						char	mInlineChars[kInlineByteCount];
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - CString::Atom::Info
+
+struct CString::Atom::Info {
+	// Methods
+	Info(const CString& string) : mString(string), mHashValue(string.getHashValue()) {}
+
+	// Properties
+	const	CString	mString;
+	const	UInt32	mHashValue;
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+inline const CString& CString::Atom::getString() const
+//----------------------------------------------------------------------------------------------------------------------
+{
+	return mInfo->mString;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+inline UInt32 CString::Atom::getHashValue() const
+//----------------------------------------------------------------------------------------------------------------------
+{
+	return mInfo->mHashValue;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 // MARK: - Macros
 
@@ -1,74 +1,67 @@
 //----------------------------------------------------------------------------------------------------------------------
-//	CUUIDCFImplementation.cpp			©2009 Stevo Brock	All rights reserved.
+//	CUUID.cpp			©2009 Stevo Brock	All rights reserved.
 //----------------------------------------------------------------------------------------------------------------------
 
 #include "CUUID.h"
 
 #include "CppToolboxAssert.h"
-#include "CReferenceCountable.h"
-
-#if defined(TARGET_OS_WINDOWS)
-	#undef Delete
-	#include "Rpc.h"
-	#define Delete(x)	{ delete x; x = nil; }
-#endif
-
-//----------------------------------------------------------------------------------------------------------------------
-// MARK: CUUID::Internals
-
-class CUUID::Internals : public TReferenceCountableAutoDelete<Internals> {
-	public:
-		Internals() : TReferenceCountableAutoDelete()
-			{
-#if defined(TARGET_OS_IOS) || defined(TARGET_OS_MACOS) || defined(TARGET_OS_TVOS)
-				// Create new UUID and get raw bytes
-				CFUUIDRef	uuidRef = ::CFUUIDCreate(kCFAllocatorDefault);
-				CFUUIDBytes	uuidBytes = ::CFUUIDGetUUIDBytes(uuidRef);
-				::CFRelease(uuidRef);
-
-				::memcpy(mBytes, &uuidBytes, sizeof(Bytes));
-#elif defined(TARGET_OS_WINDOWS)
-				::UuidCreate((UUID*) &mBytes);
-#endif
-			}
-		Internals(const Bytes& uuidBytes) :
-			TReferenceCountableAutoDelete()
-			{
-				::memcpy(mBytes, uuidBytes, sizeof(Bytes));
-			}
-		Internals(const CData& data) : TReferenceCountableAutoDelete()
-			{
-				// Check if data is correct size
-				AssertFailIf(data.getByteCount() != 16);
-
-				// Check data size
-				if (data.getByteCount() == 16)
-					// Data is correct size
-					data.copyBytes(&mBytes, 0, 16);
-				else
-					// Data is not correct size
-					::memcpy(&mBytes, "-Invalid data-", 14);
-			}
-		Internals(const CString& string) : TReferenceCountableAutoDelete()
-			{
-				// Check length
-				if (string.getLength() == 36) {
-					// Hex string
-					//	Note only version 1 strings are supported currently
-					*((UInt32*) &mBytes[0]) = EndianU32_NtoB(string.getSubString(0, 8).getUInt32(16));
-					*((UInt16*) &mBytes[4]) = EndianU16_NtoB(string.getSubString(9, 4).getUInt16(16));
-					*((UInt16*) &mBytes[6]) = EndianU16_NtoB(string.getSubString(14, 4).getUInt16(16));
-					*((UInt16*) &mBytes[8]) = EndianU16_NtoB(string.getSubString(19, 4).getUInt16(16));
-					*((UInt32*) &mBytes[10]) = EndianU32_NtoB(string.getSubString(24, 8).getUInt32(16));
-					*((UInt16*) &mBytes[14]) = EndianU16_NtoB(string.getSubString(32, 4).getUInt16(16));
-				} else
-					// Unknown
-					::memcpy(&mBytes, "-Unknown Format-", 16);
-			}
-
-		Bytes	mBytes;
+#include "TimeAndDate.h"
+
+#include <random>
+
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: Local data
+
+static	const	char	sBase64Table[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+//----------------------------------------------------------------------------------------------------------------------
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - SUUIDGenerator
+//	Each thread has its own xoshiro256** generator, seeded from std::random_device the first time the thread makes a
+//		UUID, along with the version 7 timestamp and counter for that thread.
+
+struct SUUIDGenerator {
+			// Methods
+			SUUIDGenerator() : mIsSeeded(false), mLastMilliseconds(0), mCounter(0) {}
+
+	UInt64	getNext()
+				{
+					// Check if seeded
+					if (!mIsSeeded) {
+						// Seed
+						std::random_device	randomDevice;
+						for (UInt32 i = 0; i < 4; i++)
+							// Seed word
+							mState[i] = ((UInt64) randomDevice() << 32) | randomDevice();
+						mState[0] |= 1;
+						mIsSeeded = true;
+					}
+
+					// Advance
+					UInt64	result = rotateLeft(mState[1] * 5, 7) * 9;
+					UInt64	t = mState[1] << 17;
+					mState[2] ^= mState[0];
+					mState[3] ^= mState[1];
+					mState[1] ^= mState[2];
+					mState[0] ^= mState[3];
+					mState[2] ^= t;
+					mState[3] = rotateLeft(mState[3], 45);
+
+					return result;
+				}
+
+	static	UInt64	rotateLeft(UInt64 value, UInt32 count)
+						{ return (value << count) | (value >> (64 - count)); }
+
+	// Properties
+	UInt64	mState[4];
+	bool	mIsSeeded;
+	UInt64	mLastMilliseconds;
+	UInt16	mCounter;
 };
 
+static	thread_local	SUUIDGenerator	sUUIDGenerator;
+
 //----------------------------------------------------------------------------------------------------------------------
 //----------------------------------------------------------------------------------------------------------------------
 // MARK: - CUUID
@@ -78,67 +71,106 @@ const	CUUID	CUUID::mZero(CString(OSSTR("00000000-0000-0000-0000-000000000000")))
 // MARK: Lifecycle methods
 
 //----------------------------------------------------------------------------------------------------------------------
-CUUID::CUUID()
+CUUID::CUUID() : CHashable()
 //----------------------------------------------------------------------------------------------------------------------
 {
-	mInternals = new Internals();
+	// Version 4
+	*this = makeVersion4();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-CUUID::CUUID(const Bytes& bytes)
+CUUID::CUUID(const Bytes& bytes) : CHashable()
 //----------------------------------------------------------------------------------------------------------------------
 {
-	mInternals = new Internals(bytes);
+	// Copy
+	::memcpy(mBytes, bytes, sizeof(Bytes));
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-CUUID::CUUID(const CData& data)
+CUUID::CUUID(const CData& data) : CHashable()
 //----------------------------------------------------------------------------------------------------------------------
 {
-	mInternals = new Internals(data);
+	// Check if data is correct size
+	AssertFailIf(data.getByteCount() != 16);
+
+	// Check data size
+	if (data.getByteCount() == 16)
+		// Data is correct size
+		data.copyBytes(mBytes, 0, 16);
+	else
+		// Data is not correct size
+		::memcpy(mBytes, "-Invalid data-\0\0", 16);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-CUUID::CUUID(const CString& string)
+CUUID::CUUID(const CString& string) : CHashable()
 //----------------------------------------------------------------------------------------------------------------------
 {
-	mInternals = new Internals(string);
+	// Check length
+	if (string.getLength() == 36) {
+		// Hex string
+		//	Note only version 1 strings are supported currently
+		*((UInt32*) &mBytes[0]) = EndianU32_NtoB(string.getSubString(0, 8).getUInt32(16));
+		*((UInt16*) &mBytes[4]) = EndianU16_NtoB(string.getSubString(9, 4).getUInt16(16));
+		*((UInt16*) &mBytes[6]) = EndianU16_NtoB(string.getSubString(14, 4).getUInt16(16));
+		*((UInt16*) &mBytes[8]) = EndianU16_NtoB(string.getSubString(19, 4).getUInt16(16));
+		*((UInt32*) &mBytes[10]) = EndianU32_NtoB(string.getSubString(24, 8).getUInt32(16));
+		*((UInt16*) &mBytes[14]) = EndianU16_NtoB(string.getSubString(32, 4).getUInt16(16));
+	} else
+		// Unknown
+		::memcpy(mBytes, "-Unknown Format-", 16);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-CUUID::CUUID(const CUUID& other)
+CUUID::CUUID(const CUUID& other) : CHashable()
 //----------------------------------------------------------------------------------------------------------------------
 {
-	mInternals = other.mInternals->addReference();
+	// Copy
+	mWords[0] = other.mWords[0];
+	mWords[1] = other.mWords[1];
 }
 
+// MARK: Instance methods
+
 //----------------------------------------------------------------------------------------------------------------------
-CUUID::~CUUID()
+CString CUUID::getHexString() const
 //----------------------------------------------------------------------------------------------------------------------
 {
-	mInternals->removeReference();
+	return CString::make(OSSTR("%02x%02x%02x%02x-%02x%02x-%02x%02x-%02x%02x-%02x%02x%02x%02x%02x%02x"),
+			mBytes[0], mBytes[1], mBytes[2], mBytes[3], mBytes[4], mBytes[5], mBytes[6], mBytes[7], mBytes[8],
+			mBytes[9], mBytes[10], mBytes[11], mBytes[12], mBytes[13], mBytes[14], mBytes[15]);
 }
 
-// MARK: Instance methods
-
 //----------------------------------------------------------------------------------------------------------------------
-CString CUUID::getHexString() const
+CString CUUID::getBase64String() const
 //----------------------------------------------------------------------------------------------------------------------
 {
-	return CString::make(OSSTR("%02x%02x%02x%02x-%02x%02x-%02x%02x-%02x%02x-%02x%02x%02x%02x%02x%02x"),
-			mInternals->mBytes[0], mInternals->mBytes[1], mInternals->mBytes[2],
-			mInternals->mBytes[3], mInternals->mBytes[4], mInternals->mBytes[5],
-			mInternals->mBytes[6], mInternals->mBytes[7], mInternals->mBytes[8],
-			mInternals->mBytes[9], mInternals->mBytes[10], mInternals->mBytes[11],
-			mInternals->mBytes[12], mInternals->mBytes[13], mInternals->mBytes[14],
-			mInternals->mBytes[15]);
+	// Setup
+	char	chars[22];
+	char*	charPtr = chars;
+
+	// Encode 5 groups of 3 bytes
+	for (UInt32 i = 0; i < 15; i += 3) {
+		// Encode group
+		UInt32	group = ((UInt32) mBytes[i] << 16) | ((UInt32) mBytes[i + 1] << 8) | mBytes[i + 2];
+		*charPtr++ = sBase64Table[(group >> 18) & 0x3F];
+		*charPtr++ = sBase64Table[(group >> 12) & 0x3F];
+		*charPtr++ = sBase64Table[(group >> 6) & 0x3F];
+		*charPtr++ = sBase64Table[group & 0x3F];
+	}
+
+	// Encode last byte without padding
+	*charPtr++ = sBase64Table[mBytes[15] >> 2];
+	*charPtr++ = sBase64Table[(mBytes[15] & 0x03) << 4];
+
+	return CString(chars, sizeof(chars), CString::kEncodingASCII);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 CData CUUID::getData() const
 //----------------------------------------------------------------------------------------------------------------------
 {
-	return CData(&mInternals->mBytes, sizeof(Bytes));
+	return CData(mBytes, sizeof(Bytes));
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -146,12 +178,61 @@ void CUUID::getBytes(Bytes& bytes) const
 //----------------------------------------------------------------------------------------------------------------------
 {
 	// Copy
-	::memcpy(bytes, mInternals->mBytes, sizeof(Bytes));
+	::memcpy(bytes, mBytes, sizeof(Bytes));
+}
+
+// MARK: Class methods
+
+//----------------------------------------------------------------------------------------------------------------------
+CUUID CUUID::makeVersion4()
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Setup
+	UInt64	words[2] = { sUUIDGenerator.getNext(), sUUIDGenerator.getNext() };
+	Bytes	bytes;
+	::memcpy(bytes, words, sizeof(Bytes));
+
+	// Set version and variant
+	bytes[6] = (bytes[6] & 0x0F) | 0x40;
+	bytes[8] = (bytes[8] & 0x3F) | 0x80;
+
+	return CUUID(bytes);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-bool CUUID::equals(const CUUID& other) const
+CUUID CUUID::makeVersion7()
 //----------------------------------------------------------------------------------------------------------------------
 {
-	return ::memcmp(&mInternals->mBytes, &other.mInternals->mBytes, sizeof(Bytes)) == 0;
+	// Setup
+	UInt64	milliseconds =
+					(UInt64) ((SUniversalTime::getCurrent() + kUniversalTimeInterval1970To2001) * 1000.0);
+	UInt64	random = sUUIDGenerator.getNext();
+
+	// Check time.  Within the same millisecond (or if the clock goes back), count up from the last UUID.  A new
+	//	millisecond starts the 12-bit counter at a random value in its lower half to leave room to count.
+	if (milliseconds > sUUIDGenerator.mLastMilliseconds)
+		// New millisecond
+		sUUIDGenerator.mCounter = (UInt16) (sUUIDGenerator.getNext() & 0x7FF);
+	else if (++sUUIDGenerator.mCounter > 0xFFF) {
+		// Counter overflowed, so borrow the next millisecond
+		milliseconds = sUUIDGenerator.mLastMilliseconds + 1;
+		sUUIDGenerator.mCounter = (UInt16) (sUUIDGenerator.getNext() & 0x7FF);
+	} else
+		// Same millisecond
+		milliseconds = sUUIDGenerator.mLastMilliseconds;
+	sUUIDGenerator.mLastMilliseconds = milliseconds;
+
+	// Compose
+	Bytes	bytes;
+	for (UInt32 i = 0; i < 6; i++)
+		// Timestamp, most significant byte first
+		bytes[i] = (UInt8) (milliseconds >> (40 - i * 8));
+	bytes[6] = 0x70 | (UInt8) (sUUIDGenerator.mCounter >> 8);
+	bytes[7] = (UInt8) sUUIDGenerator.mCounter;
+	bytes[8] = 0x80 | (UInt8) (random & 0x3F);
+	for (UInt32 i = 9; i < 16; i++)
+		// Random
+		bytes[i] = (UInt8) (random >> ((i - 8) * 8));
+
+	return CUUID(bytes);
 }
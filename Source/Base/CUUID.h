@@ -23,10 +23,6 @@ class CUUID : public CHashable {
 	public:
 		using Bytes = UInt8[16];
 
-	// Classes
-	private:
-		class Internals;
-
 	// Methods
 	public:
 						// Lifecycle methods
@@ -35,7 +31,6 @@ class CUUID : public CHashable {
 						CUUID(const CData& data);
 						CUUID(const CString& string);
 						CUUID(const CUUID& other);
-						~CUUID();
 
 						// CEquatable methods
 				bool	operator==(const CEquatable& other) const
@@ -43,21 +38,42 @@ class CUUID : public CHashable {
 
 						// CHashable methods
 				void	hashInto(CHashable::HashCollector& hashableHashCollector) const
-							{ getBase64String().hashInto(hashableHashCollector); }
+							{ hashableHashCollector.add(mBytes, sizeof(Bytes)); }
 
 						// Instance methods
 				CData	getData() const;
 				CString	getHexString() const;
-				CString	getBase64String() const
-							{ return getData().getBase64String().getSubString(0, 22); }
+				CString	getBase64String() const;
 				void	getBytes(Bytes& bytes) const;
 
-				bool	equals(const CUUID& other) const;
+				bool	equals(const CUUID& other) const
+							{ return (mWords[0] == other.mWords[0]) && (mWords[1] == other.mWords[1]); }
+
+						// Orders by bytes, so version 7 UUIDs order by creation time
+				bool	operator<(const CUUID& other) const
+							{ return ::memcmp(mBytes, other.mBytes, sizeof(Bytes)) < 0; }
+				bool	operator==(const CUUID& other) const
+							{ return equals(other); }
+				bool	operator!=(const CUUID& other) const
+							{ return !equals(other); }
+				CUUID&	operator=(const CUUID& other)
+							{ mWords[0] = other.mWords[0]; mWords[1] = other.mWords[1]; return *this; }
+
+						// Class methods
+						// Random UUIDs come from a per-thread generator seeded once from the system, so creating one
+						//	makes no system call.  They are unique but not suitable as secrets.
+		static	CUUID	makeVersion4();
+						// Version 7 UUIDs start with the current time in milliseconds, and UUIDs made on the same
+						//	thread within the same millisecond count up, so they sort in creation order.
+		static	CUUID	makeVersion7();
 
 	// Properties
 	public:
-		static	const	CUUID		mZero;
+		static	const	CUUID	mZero;
 
 	private:
-						Internals*	mInternals;
+		union {
+			Bytes	mBytes;
+			UInt64	mWords[2];
+		};
 };
@@ -4,11 +4,431 @@
 
 #include "SNumber.h"
 
+#include "TBuffer.h"
+
+#include <math.h>
+
 //----------------------------------------------------------------------------------------------------------------------
 // MARK: Local data
 
 static	bool	sRandHasBeenSeeded = false;
 
+// Digit pairs for 00 through 99, so integers are written two digits per division
+static	const	char	sDigitPairs[] =
+								"0001020304050607080910111213141516171819"
+								"2021222324252627282930313233343536373839"
+								"4041424344454647484950515253545556575859"
+								"6061626364656667686970717273747576777879"
+								"8081828384858687888990919293949596979899";
+
+// Powers of ten that are exact as Float64, for the fast parsing path
+static	const	Float64	sExactPowersOf10[] =
+								{
+									1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14,
+									1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+								};
+static	const	UInt64	kExactSignificandMaximum = 1ULL << 53;
+static	const	UInt32	kParseSignificantDigitMaximum = 19;
+static	const	UInt32	kParseStackCharCount = 64;
+
+// Shortest float formatting is Grisu2: the value and the midpoints to its neighbors are scaled by a cached power of
+//	ten so their top bits become decimal digits, and digits are generated until the result is inside the rounding
+//	interval.  The output always reads back as the original value and is the shortest possible in nearly all cases.
+struct SDiyFP {
+	UInt64	mSignificand;
+	SInt32	mExponent;
+};
+
+struct SCachedPower {
+	UInt64	mSignificand;
+	SInt32	mExponent;
+	SInt32	mDecimalExponent;
+};
+
+static	const	SCachedPower	sCachedPowers[] =
+									{
+										{0xAB70FE17C79AC6CAULL, -1060, -300},
+										{0xFF77B1FCBEBCDC4FULL, -1034, -292},
+										{0xBE5691EF416BD60CULL, -1007, -284},
+										{0x8DD01FAD907FFC3CULL,  -980, -276},
+										{0xD3515C2831559A83ULL,  -954, -268},
+										{0x9D71AC8FADA6C9B5ULL,  -927, -260},
+										{0xEA9C227723EE8BCBULL,  -901, -252},
+										{0xAECC49914078536DULL,  -874, -244},
+										{0x823C12795DB6CE57ULL,  -847, -236},
+										{0xC21094364DFB5637ULL,  -821, -228},
+										{0x9096EA6F3848984FULL,  -794, -220},
+										{0xD77485CB25823AC7ULL,  -768, -212},
+										{0xA086CFCD97BF97F4ULL,  -741, -204},
+										{0xEF340A98172AACE5ULL,  -715, -196},
+										{0xB23867FB2A35B28EULL,  -688, -188},
+										{0x84C8D4DFD2C63F3BULL,  -661, -180},
+										{0xC5DD44271AD3CDBAULL,  -635, -172},
+										{0x936B9FCEBB25C996ULL,  -608, -164},
+										{0xDBAC6C247D62A584ULL,  -582, -156},
+										{0xA3AB66580D5FDAF6ULL,  -555, -148},
+										{0xF3E2F893DEC3F126ULL,  -529, -140},
+										{0xB5B5ADA8AAFF80B8ULL,  -502, -132},
+										{0x87625F056C7C4A8BULL,  -475, -124},
+										{0xC9BCFF6034C13053ULL,  -449, -116},
+										{0x964E858C91BA2655ULL,  -422, -108},
+										{0xDFF9772470297EBDULL,  -396, -100},
+										{0xA6DFBD9FB8E5B88FULL,  -369,  -92},
+										{0xF8A95FCF88747D94ULL,  -343,  -84},
+										{0xB94470938FA89BCFULL,  -316,  -76},
+										{0x8A08F0F8BF0F156BULL,  -289,  -68},
+										{0xCDB02555653131B6ULL,  -263,  -60},
+										{0x993FE2C6D07B7FACULL,  -236,  -52},
+										{0xE45C10C42A2B3B06ULL,  -210,  -44},
+										{0xAA242499697392D3ULL,  -183,  -36},
+										{0xFD87B5F28300CA0EULL,  -157,  -28},
+										{0xBCE5086492111AEBULL,  -130,  -20},
+										{0x8CBCCC096F5088CCULL,  -103,  -12},
+										{0xD1B71758E219652CULL,   -77,   -4},
+										{0x9C40000000000000ULL,   -50,    4},
+										{0xE8D4A51000000000ULL,   -24,   12},
+										{0xAD78EBC5AC620000ULL,     3,   20},
+										{0x813F3978F8940984ULL,    30,   28},
+										{0xC097CE7BC90715B3ULL,    56,   36},
+										{0x8F7E32CE7BEA5C70ULL,    83,   44},
+										{0xD5D238A4ABE98068ULL,   109,   52},
+										{0x9F4F2726179A2245ULL,   136,   60},
+										{0xED63A231D4C4FB27ULL,   162,   68},
+										{0xB0DE65388CC8ADA8ULL,   189,   76},
+										{0x83C7088E1AAB65DBULL,   216,   84},
+										{0xC45D1DF942711D9AULL,   242,   92},
+										{0x924D692CA61BE758ULL,   269,  100},
+										{0xDA01EE641A708DEAULL,   295,  108},
+										{0xA26DA3999AEF774AULL,   322,  116},
+										{0xF209787BB47D6B85ULL,   348,  124},
+										{0xB454E4A179DD1877ULL,   375,  132},
+										{0x865B86925B9BC5C2ULL,   402,  140},
+										{0xC83553C5C8965D3DULL,   428,  148},
+										{0x952AB45CFA97A0B3ULL,   455,  156},
+										{0xDE469FBD99A05FE3ULL,   481,  164},
+										{0xA59BC234DB398C25ULL,   508,  172},
+										{0xF6C69A72A3989F5CULL,   534,  180},
+										{0xB7DCBF5354E9BECEULL,   561,  188},
+										{0x88FCF317F22241E2ULL,   588,  196},
+										{0xCC20CE9BD35C78A5ULL,   614,  204},
+										{0x98165AF37B2153DFULL,   641,  212},
+										{0xE2A0B5DC971F303AULL,   667,  220},
+										{0xA8D9D1535CE3B396ULL,   694,  228},
+										{0xFB9B7CD9A4A7443CULL,   720,  236},
+										{0xBB764C4CA7A44410ULL,   747,  244},
+										{0x8BAB8EEFB6409C1AULL,   774,  252},
+										{0xD01FEF10A657842CULL,   800,  260},
+										{0x9B10A4E5E9913129ULL,   827,  268},
+										{0xE7109BFBA19C0C9DULL,   853,  276},
+										{0xAC2820D9623BF429ULL,   880,  284},
+										{0x80444B5E7AA7CF85ULL,   907,  292},
+										{0xBF21E44003ACDD2DULL,   933,  300},
+										{0x8E679C2F5E44FF8FULL,   960,  308},
+										{0xD433179D9C8CB841ULL,   986,  316},
+										{0x9E19DB92B4E31BA9ULL,  1013,  324}
+									};
+static	const	SInt32			kCachedPowerMinimumDecimalExponent = -300;
+static	const	SInt32			kCachedPowerDecimalExponentStep = 8;
+static	const	SInt32			kGrisuAlpha = -60;
+
+//----------------------------------------------------------------------------------------------------------------------
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - Local procs
+
+//----------------------------------------------------------------------------------------------------------------------
+static UInt32 sGetDigitCount(UInt64 value)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Count digits
+	UInt32	count = 1;
+	for (; value >= 10; value /= 10)
+		// One more digit
+		count++;
+
+	return count;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+static void sPutDigits(UInt64 value, char* buffer, UInt32 count)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Write digit pairs from the end
+	char*	charPtr = buffer + count;
+	while (value >= 100) {
+		// Write pair
+		UInt32	index = (UInt32) (value % 100) * 2;
+		value /= 100;
+		*(--charPtr) = sDigitPairs[index + 1];
+		*(--charPtr) = sDigitPairs[index];
+	}
+
+	// Write remaining digits
+	if (value >= 10) {
+		// Pair
+		*(--charPtr) = sDigitPairs[value * 2 + 1];
+		*(--charPtr) = sDigitPairs[value * 2];
+	} else
+		// Single
+		*(--charPtr) = (char) ('0' + value);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+static SDiyFP sMultiply(const SDiyFP& diyFP1, const SDiyFP& diyFP2)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Multiply 64x64 in 32-bit halves and keep the upper 64 bits, rounded
+	UInt64	low1 = diyFP1.mSignificand & 0xFFFFFFFF;
+	UInt64	high1 = diyFP1.mSignificand >> 32;
+	UInt64	low2 = diyFP2.mSignificand & 0xFFFFFFFF;
+	UInt64	high2 = diyFP2.mSignificand >> 32;
+
+	UInt64	lowLow = low1 * low2;
+	UInt64	lowHigh = low1 * high2;
+	UInt64	highLow = high1 * low2;
+	UInt64	highHigh = high1 * high2;
+
+	UInt64	middle = (lowLow >> 32) + (lowHigh & 0xFFFFFFFF) + (highLow & 0xFFFFFFFF) + (1ULL << 31);
+
+	SDiyFP	diyFP;
+	diyFP.mSignificand = highHigh + (lowHigh >> 32) + (highLow >> 32) + (middle >> 32);
+	diyFP.mExponent = diyFP1.mExponent + diyFP2.mExponent + 64;
+
+	return diyFP;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+static SDiyFP sNormalize(SDiyFP diyFP)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Shift until the top bit is set
+	while ((diyFP.mSignificand >> 63) == 0) {
+		// Shift
+		diyFP.mSignificand <<= 1;
+		diyFP.mExponent--;
+	}
+
+	return diyFP;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+static void sGrisuRound(char* digits, UInt32 count, UInt64 distance, UInt64 delta, UInt64 rest, UInt64 tenToK)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Step the last digit down while that moves closer to the value and stays inside the rounding interval
+	while ((rest < distance) && ((delta - rest) >= tenToK) &&
+			(((rest + tenToK) < distance) || ((distance - rest) > (rest + tenToK - distance)))) {
+		// Step down
+		digits[count - 1]--;
+		rest += tenToK;
+	}
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+static UInt32 sGrisuGetDigits(UInt64 significand, SInt32 exponent, bool lowerBoundaryIsCloser, char* digits,
+		SInt32& decimalExponent)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Compute boundaries.  The lower neighbor is closer when the significand is a power of two.
+	SDiyFP	plus = {(significand << 1) + 1, exponent - 1};
+	plus = sNormalize(plus);
+
+	SDiyFP	minus;
+	if (lowerBoundaryIsCloser) {
+		// Lower neighbor is half as far away
+		minus.mSignificand = (significand << 2) - 1;
+		minus.mExponent = exponent - 2;
+	} else {
+		// Neighbors are equally far away
+		minus.mSignificand = (significand << 1) - 1;
+		minus.mExponent = exponent - 1;
+	}
+	minus.mSignificand <<= minus.mExponent - plus.mExponent;
+	minus.mExponent = plus.mExponent;
+
+	SDiyFP	value = {significand, exponent};
+	value = sNormalize(value);
+
+	// Pick the cached power that scales the upper boundary's exponent into [kGrisuAlpha, kGrisuAlpha + 28]
+			SInt32			f = kGrisuAlpha - plus.mExponent - 1;
+			SInt32			k = (f * 78913) / (1 << 18) + ((f > 0) ? 1 : 0);
+	const	SCachedPower&	cachedPower =
+									sCachedPowers[(k - kCachedPowerMinimumDecimalExponent +
+											kCachedPowerDecimalExponentStep - 1) / kCachedPowerDecimalExponentStep];
+			SDiyFP			scale = {cachedPower.mSignificand, cachedPower.mExponent};
+
+	// Scale, then pull the boundaries in by one unit to cover the multiplication error
+	SDiyFP	scaledValue = sMultiply(value, scale);
+	SDiyFP	scaledMinus = sMultiply(minus, scale);
+	SDiyFP	scaledPlus = sMultiply(plus, scale);
+	scaledMinus.mSignificand++;
+	scaledPlus.mSignificand--;
+	decimalExponent = -cachedPower.mDecimalExponent;
+
+	// Split the upper boundary into integral and fractional parts
+	UInt32	shift = (UInt32) -scaledPlus.mExponent;
+	UInt64	one = 1ULL << shift;
+	UInt64	delta = scaledPlus.mSignificand - scaledMinus.mSignificand;
+	UInt64	distance = scaledPlus.mSignificand - scaledValue.mSignificand;
+	UInt32	integral = (UInt32) (scaledPlus.mSignificand >> shift);
+	UInt64	fractional = scaledPlus.mSignificand & (one - 1);
+
+	// Generate integral digits
+	UInt32	count = 0;
+	UInt32	remaining = sGetDigitCount(integral);
+	UInt32	power = 1;
+	for (UInt32 i = 1; i < remaining; i++)
+		// Next power
+		power *= 10;
+	while (remaining > 0) {
+		// Emit digit
+		digits[count++] = (char) ('0' + integral / power);
+		integral %= power;
+		remaining--;
+
+		// Check if inside the interval
+		UInt64	rest = ((UInt64) integral << shift) + fractional;
+		if (rest <= delta) {
+			// Done
+			decimalExponent += (SInt32) remaining;
+			sGrisuRound(digits, count, distance, delta, rest, (UInt64) power << shift);
+
+			return count;
+		}
+
+		power /= 10;
+	}
+
+	// Generate fractional digits
+	SInt32	fractionalCount = 0;
+	do {
+		// Emit digit
+		fractional *= 10;
+		digits[count++] = (char) ('0' + (fractional >> shift));
+		fractional &= one - 1;
+		fractionalCount++;
+		delta *= 10;
+		distance *= 10;
+	} while (fractional > delta);
+
+	decimalExponent -= fractionalCount;
+	sGrisuRound(digits, count, distance, delta, fractional, one);
+
+	return count;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+static UInt32 sFormat(const char* digits, UInt32 digitCount, SInt32 decimalExponent, char* buffer)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Setup.  The decimal point goes after decimalPointPosition digits.
+	SInt32	decimalPointPosition = (SInt32) digitCount + decimalExponent;
+	char*	charPtr = buffer;
+
+	// Check layout
+	if (((SInt32) digitCount <= decimalPointPosition) && (decimalPointPosition <= 21)) {
+		// Integral: digits, zeros, ".0"
+		::memcpy(charPtr, digits, digitCount);
+		charPtr += digitCount;
+		::memset(charPtr, '0', decimalPointPosition - digitCount);
+		charPtr += decimalPointPosition - digitCount;
+		*charPtr++ = '.';
+		*charPtr++ = '0';
+	} else if ((decimalPointPosition > 0) && (decimalPointPosition <= 21)) {
+		// Decimal point within the digits
+		::memcpy(charPtr, digits, decimalPointPosition);
+		charPtr += decimalPointPosition;
+		*charPtr++ = '.';
+		::memcpy(charPtr, digits + decimalPointPosition, digitCount - decimalPointPosition);
+		charPtr += digitCount - decimalPointPosition;
+	} else if ((decimalPointPosition > -6) && (decimalPointPosition <= 0)) {
+		// Leading zeros: "0.", zeros, digits
+		*charPtr++ = '0';
+		*charPtr++ = '.';
+		::memset(charPtr, '0', -decimalPointPosition);
+		charPtr += -decimalPointPosition;
+		::memcpy(charPtr, digits, digitCount);
+		charPtr += digitCount;
+	} else {
+		// Exponent: d[.ddd]e±x
+		*charPtr++ = digits[0];
+		if (digitCount > 1) {
+			// Remaining digits
+			*charPtr++ = '.';
+			::memcpy(charPtr, digits + 1, digitCount - 1);
+			charPtr += digitCount - 1;
+		}
+
+		SInt32	exponent = decimalPointPosition - 1;
+		*charPtr++ = 'e';
+		*charPtr++ = (exponent < 0) ? '-' : '+';
+		UInt32	exponentMagnitude = (exponent < 0) ? (UInt32) -exponent : (UInt32) exponent;
+		UInt32	exponentDigitCount = sGetDigitCount(exponentMagnitude);
+		sPutDigits(exponentMagnitude, charPtr, exponentDigitCount);
+		charPtr += exponentDigitCount;
+	}
+
+	return (UInt32) (charPtr - buffer);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+static UInt32 sGetSpecialChars(bool isNegative, bool isNaN, bool isZero, char* buffer)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Compose as printf would, with zero written as a float
+	const	char*	string = isNaN ? "nan" : (isZero ? "0.0" : "inf");
+			UInt32	count = 0;
+	if (isNegative && !isNaN)
+		// Sign
+		buffer[count++] = '-';
+	::memcpy(buffer + count, string, 3);
+
+	return count + 3;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+static bool sGetMagnitude(const char*& charPtr, const char* endCharPtr, UInt64 maximum, UInt64& value)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Accumulate digits
+	const	char*	startCharPtr = charPtr;
+	value = 0;
+	for (; (charPtr < endCharPtr) && (*charPtr >= '0') && (*charPtr <= '9'); charPtr++) {
+		// Check range
+		UInt64	digit = (UInt64) (*charPtr - '0');
+		if (value > ((maximum - digit) / 10))
+			// Out of range
+			return false;
+
+		// Add digit
+		value = value * 10 + digit;
+	}
+
+	return charPtr > startCharPtr;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+static Float64 sParseWithStrtod(const char* startCharPtr, const char* endCharPtr)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Copy into a null terminated buffer, on the stack unless the text is unusually long
+	UInt32	count = (UInt32) (endCharPtr - startCharPtr);
+	if (count < kParseStackCharCount) {
+		// Stack
+		char	buffer[kParseStackCharCount];
+		::memcpy(buffer, startCharPtr, count);
+		buffer[count] = 0;
+
+		return ::strtod(buffer, nil);
+	} else {
+		// Heap
+		TBuffer<char>	buffer(count + 1);
+		::memcpy(*buffer, startCharPtr, count);
+		(*buffer)[count] = 0;
+
+		return ::strtod(*buffer, nil);
+	}
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 // MARK: - SNumber
 
@@ -28,6 +448,253 @@ UInt16 SNumber::getNextPowerOf2(UInt16 value)
 	return ++value;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+UInt32 SNumber::getChars(SInt64 value, char* buffer)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Check sign
+	if (value < 0) {
+		// Negative
+		buffer[0] = '-';
+
+		return getChars((UInt64) 0 - (UInt64) value, buffer + 1) + 1;
+	} else
+		// Positive
+		return getChars((UInt64) value, buffer);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+UInt32 SNumber::getChars(UInt64 value, char* buffer)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Write digits
+	UInt32	count = sGetDigitCount(value);
+	sPutDigits(value, buffer, count);
+
+	return count;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+UInt32 SNumber::getChars(Float32 value, char* buffer)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Setup
+	UInt32	bits;
+	::memcpy(&bits, &value, sizeof(bits));
+	bool	isNegative = (bits >> 31) != 0;
+	UInt32	biasedExponent = (bits >> 23) & 0xFF;
+	UInt32	fraction = bits & 0x7FFFFF;
+
+	// Check for special values
+	if ((biasedExponent == 0xFF) || ((biasedExponent == 0) && (fraction == 0)))
+		// NaN, infinity, or zero
+		return sGetSpecialChars(isNegative, (biasedExponent == 0xFF) && (fraction != 0),
+				biasedExponent == 0, buffer);
+
+	// Generate digits
+	char	digits[20];
+	SInt32	decimalExponent;
+	UInt32	digitCount =
+					(biasedExponent == 0) ?
+							sGrisuGetDigits(fraction, 1 - 150, false, digits, decimalExponent) :
+							sGrisuGetDigits(fraction | 0x800000, (SInt32) biasedExponent - 150,
+									(fraction == 0) && (biasedExponent > 1), digits, decimalExponent);
+
+	// Format
+	UInt32	count = 0;
+	if (isNegative)
+		// Sign
+		buffer[count++] = '-';
+
+	return count + sFormat(digits, digitCount, decimalExponent, buffer + count);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+UInt32 SNumber::getChars(Float64 value, char* buffer)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Setup
+	UInt64	bits;
+	::memcpy(&bits, &value, sizeof(bits));
+	bool	isNegative = (bits >> 63) != 0;
+	UInt32	biasedExponent = (UInt32) (bits >> 52) & 0x7FF;
+	UInt64	fraction = bits & 0xFFFFFFFFFFFFFULL;
+
+	// Check for special values
+	if ((biasedExponent == 0x7FF) || ((biasedExponent == 0) && (fraction == 0)))
+		// NaN, infinity, or zero
+		return sGetSpecialChars(isNegative, (biasedExponent == 0x7FF) && (fraction != 0),
+				biasedExponent == 0, buffer);
+
+	// Generate digits
+	char	digits[20];
+	SInt32	decimalExponent;
+	UInt32	digitCount =
+					(biasedExponent == 0) ?
+							sGrisuGetDigits(fraction, 1 - 1075, false, digits, decimalExponent) :
+							sGrisuGetDigits(fraction | (1ULL << 52), (SInt32) biasedExponent - 1075,
+									(fraction == 0) && (biasedExponent > 1), digits, decimalExponent);
+
+	// Format
+	UInt32	count = 0;
+	if (isNegative)
+		// Sign
+		buffer[count++] = '-';
+
+	return count + sFormat(digits, digitCount, decimalExponent, buffer + count);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+bool SNumber::getSInt64(const char*& charPtr, const char* endCharPtr, SInt64& value)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Check sign
+	const	char*	currentCharPtr = charPtr;
+			bool	isNegative = (currentCharPtr < endCharPtr) && (*currentCharPtr == '-');
+	if ((currentCharPtr < endCharPtr) && ((*currentCharPtr == '-') || (*currentCharPtr == '+')))
+		// Skip sign
+		currentCharPtr++;
+
+	// Get magnitude
+	UInt64	magnitude;
+	if (!sGetMagnitude(currentCharPtr, endCharPtr, isNegative ? (1ULL << 63) : ((1ULL << 63) - 1), magnitude))
+		// No digits or out of range
+		return false;
+
+	// Success
+	charPtr = currentCharPtr;
+	value = isNegative ? -(SInt64) (magnitude - 1) - 1 : (SInt64) magnitude;
+
+	return true;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+bool SNumber::getUInt64(const char*& charPtr, const char* endCharPtr, UInt64& value)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Check sign
+	const	char*	currentCharPtr = charPtr;
+	if ((currentCharPtr < endCharPtr) && (*currentCharPtr == '+'))
+		// Skip sign
+		currentCharPtr++;
+
+	// Get magnitude
+	UInt64	magnitude;
+	if (!sGetMagnitude(currentCharPtr, endCharPtr, ~0ULL, magnitude))
+		// No digits or out of range
+		return false;
+
+	// Success
+	charPtr = currentCharPtr;
+	value = magnitude;
+
+	return true;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+bool SNumber::getFloat64(const char*& charPtr, const char* endCharPtr, Float64& value)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Check sign
+	const	char*	currentCharPtr = charPtr;
+			bool	isNegative = (currentCharPtr < endCharPtr) && (*currentCharPtr == '-');
+	if ((currentCharPtr < endCharPtr) && ((*currentCharPtr == '-') || (*currentCharPtr == '+')))
+		// Skip sign
+		currentCharPtr++;
+
+	// Collect up to kParseSignificantDigitMaximum significant digits, noting if any non-zero digits are dropped
+	UInt64	significand = 0;
+	UInt32	significantDigitCount = 0;
+	SInt32	decimalExponent = 0;
+	bool	hasDigits = false;
+	bool	isTruncated = false;
+	bool	isFraction = false;
+	for (; currentCharPtr < endCharPtr; currentCharPtr++) {
+		// Check char
+		if ((*currentCharPtr == '.') && !isFraction) {
+			// Decimal point
+			isFraction = true;
+			continue;
+		} else if ((*currentCharPtr < '0') || (*currentCharPtr > '9'))
+			// Done
+			break;
+
+		// Add digit
+		UInt32	digit = *currentCharPtr - '0';
+		hasDigits = true;
+		if ((significand == 0) && (digit == 0)) {
+			// Leading zero
+			if (isFraction)
+				// Shifts the value
+				decimalExponent--;
+		} else if (significantDigitCount < kParseSignificantDigitMaximum) {
+			// Significant digit
+			significand = significand * 10 + digit;
+			significantDigitCount++;
+			if (isFraction)
+				// Shifts the value
+				decimalExponent--;
+		} else {
+			// Dropped digit
+			isTruncated |= digit != 0;
+			if (!isFraction)
+				// Shifts the value
+				decimalExponent++;
+		}
+	}
+	if (!hasDigits)
+		// No digits
+		return false;
+
+	// Check for exponent
+	if ((currentCharPtr < endCharPtr) && ((*currentCharPtr == 'e') || (*currentCharPtr == 'E'))) {
+		// Check sign
+		const	char*	exponentCharPtr = currentCharPtr + 1;
+				bool	exponentIsNegative = (exponentCharPtr < endCharPtr) && (*exponentCharPtr == '-');
+		if ((exponentCharPtr < endCharPtr) && ((*exponentCharPtr == '-') || (*exponentCharPtr == '+')))
+			// Skip sign
+			exponentCharPtr++;
+
+		// Collect digits, saturating well past the range of Float64
+		if ((exponentCharPtr < endCharPtr) && (*exponentCharPtr >= '0') && (*exponentCharPtr <= '9')) {
+			// Have exponent
+			SInt32	exponent = 0;
+			for (; (exponentCharPtr < endCharPtr) && (*exponentCharPtr >= '0') && (*exponentCharPtr <= '9');
+					exponentCharPtr++) {
+				// Add digit
+				if (exponent < 100000)
+					// Still in range
+					exponent = exponent * 10 + (*exponentCharPtr - '0');
+			}
+			decimalExponent += exponentIsNegative ? -exponent : exponent;
+			currentCharPtr = exponentCharPtr;
+		}
+	}
+
+	// Compose value.  When the significand and power of ten are both exact, one multiply or divide is correctly
+	//	rounded; anything else goes to strtod.
+	Float64	magnitude;
+	if (significand == 0)
+		// Zero
+		magnitude = 0.0;
+	else if (!isTruncated && (significand <= kExactSignificandMaximum) && (decimalExponent >= -22) &&
+			(decimalExponent <= 22))
+		// Fast path
+		magnitude =
+				(decimalExponent < 0) ?
+						(Float64) significand / sExactPowersOf10[-decimalExponent] :
+						(Float64) significand * sExactPowersOf10[decimalExponent];
+	else
+		// Slow path
+		magnitude = ::fabs(sParseWithStrtod(charPtr, currentCharPtr));
+
+	// Success
+	charPtr = currentCharPtr;
+	value = isNegative ? -magnitude : magnitude;
+
+	return true;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 bool SNumber::randomBool()
 //----------------------------------------------------------------------------------------------------------------------
@@ -5,6 +5,7 @@
 #pragma once
 
 #include "CHashable.h"
+#include "TWrappers.h"
 
 //----------------------------------------------------------------------------------------------------------------------
 // MARK: Byte swapping
@@ -111,16 +112,35 @@ template <typename T> class TNumber : public CHashable {
 // MARK: - SNumber
 
 struct SNumber {
-					// Class methods
-	static	UInt16	getNextPowerOf2(UInt16 value);
-
-	static	bool	randomBool();
-
-	static	Float32	randomFloat32(Float32 min, Float32 max);
-	static	Float32	randomFloat32(Float32 max)
-						{ return randomFloat32(0.0, max); }
-
-	static	UInt32	randomUInt32(UInt32 min, UInt32 max);
-	static	UInt32	randomUInt32(UInt32 max)
-						{ return randomUInt32(0, max); }
+	// Text
+	//	Conversions between numbers and ASCII text that work in caller supplied buffers and never allocate.  Buffers
+	//	are not null terminated.  Floats are written as the shortest digit string that reads back as the same value,
+	//	with ".0" on integral values so the text still reads as a float.
+	static	const	UInt32	kIntegerMaxCharCount = 20;
+	static	const	UInt32	kFloatMaxCharCount = 32;
+
+								// Class methods
+	static			UInt16		getNextPowerOf2(UInt16 value);
+
+	static			UInt32		getChars(SInt64 value, char* buffer);
+	static			UInt32		getChars(UInt64 value, char* buffer);
+	static			UInt32		getChars(Float32 value, char* buffer);
+	static			UInt32		getChars(Float64 value, char* buffer);
+
+								// Parsing starts at charPtr and reads no further than endCharPtr.  On success, value is
+								//	set, charPtr is advanced past the characters used and true is returned; on failure
+								//	(no digits or out of range), both are left as they were and false is returned.
+	static			bool		getSInt64(const char*& charPtr, const char* endCharPtr, SInt64& value);
+	static			bool		getUInt64(const char*& charPtr, const char* endCharPtr, UInt64& value);
+	static			bool		getFloat64(const char*& charPtr, const char* endCharPtr, Float64& value);
+
+	static			bool		randomBool();
+
+	static			Float32		randomFloat32(Float32 min, Float32 max);
+	static			Float32		randomFloat32(Float32 max)
+									{ return randomFloat32(0.0, max); }
+
+	static			UInt32		randomUInt32(UInt32 min, UInt32 max);
+	static			UInt32		randomUInt32(UInt32 max)
+									{ return randomUInt32(0, max); }
 };
@@ -30,26 +30,65 @@ SValue::SValue(const TArray<CDictionary>& value) : mType(kTypeArrayOfDictionarie
 //----------------------------------------------------------------------------------------------------------------------
 {}
 
+//----------------------------------------------------------------------------------------------------------------------
+SValue::SValue(TArray<CDictionary>&& value) :
+		mType(kTypeArrayOfDictionaries), mValue(new TArray<CDictionary>(std::move(value)))
+//----------------------------------------------------------------------------------------------------------------------
+{}
+
 //----------------------------------------------------------------------------------------------------------------------
 SValue::SValue(const TArray<CString>& value) : mType(kTypeArrayOfStrings), mValue(new TArray<CString>(value))
 //----------------------------------------------------------------------------------------------------------------------
 {}
 
 //----------------------------------------------------------------------------------------------------------------------
-SValue::SValue(const CData& value) : mType(kTypeData), mValue(new CData(value))
+SValue::SValue(TArray<CString>&& value) :
+		mType(kTypeArrayOfStrings), mValue(new TArray<CString>(std::move(value)))
 //----------------------------------------------------------------------------------------------------------------------
 {}
 
+//----------------------------------------------------------------------------------------------------------------------
+SValue::SValue(const CData& value) : mType(kTypeData), mValue(false)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Construct inline
+	new (mValue.mDataStorage) CData(value);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+SValue::SValue(CData&& value) : mType(kTypeData), mValue(false)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Construct inline
+	new (mValue.mDataStorage) CData(std::move(value));
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 SValue::SValue(const CDictionary& value) : mType(kTypeDictionary), mValue(new CDictionary(value))
 //----------------------------------------------------------------------------------------------------------------------
 {}
 
 //----------------------------------------------------------------------------------------------------------------------
-SValue::SValue(const CString& value) : mType(kTypeString), mValue(new CString(value))
+SValue::SValue(CDictionary&& value) : mType(kTypeDictionary), mValue(new CDictionary(std::move(value)))
 //----------------------------------------------------------------------------------------------------------------------
 {}
 
+//----------------------------------------------------------------------------------------------------------------------
+SValue::SValue(const CString& value) : mType(kTypeString), mValue(false)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Construct inline
+	new (mValue.mStringStorage) CString(value);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+SValue::SValue(CString&& value) : mType(kTypeString), mValue(false)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Construct inline
+	new (mValue.mStringStorage) CString(std::move(value));
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 SValue::SValue(Float32 value) : mType(kTypeFloat32), mValue(value)
 //----------------------------------------------------------------------------------------------------------------------
@@ -123,7 +162,7 @@ SValue::SValue(const SValue& other, OpaqueCopyProc opaqueCopyProc) : mType(other
 
 		case kTypeData:
 			// Data
-			mValue.mData = new CData(*other.mValue.mData);
+			new (mValue.mDataStorage) CData(other.getInlineData());
 			break;
 
 		case kTypeDictionary:
@@ -133,7 +172,7 @@ SValue::SValue(const SValue& other, OpaqueCopyProc opaqueCopyProc) : mType(other
 
 		case kTypeString:
 			// String
-			mValue.mString = new CString(*other.mValue.mString);
+			new (mValue.mStringStorage) CString(other.getInlineString());
 			break;
 
 		case kTypeEmpty:
@@ -159,6 +198,14 @@ SValue::SValue(const SValue& other, OpaqueCopyProc opaqueCopyProc) : mType(other
 	}
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+SValue::SValue(SValue&& other) : mType(other.mType), mValue(other.mValue)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Take ownership of any allocated value, leaving other empty
+	takeInlineValue(other);
+}
+
 // MARK: Instance methods
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -275,7 +322,7 @@ const CData& SValue::getData(const CData& defaultValue) const
 	// Verify value type
 	AssertFailIf(mType != kTypeData);
 
-	return (mType == kTypeData) ? *mValue.mData : defaultValue;
+	return (mType == kTypeData) ? getInlineData() : defaultValue;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -295,7 +342,7 @@ const CString& SValue::getString(const CString& defaultValue) const
 	// Verify value type
 	AssertFailIf(mType != kTypeString);
 
-	return (mType == kTypeString) ? *mValue.mString : defaultValue;
+	return (mType == kTypeString) ? getInlineString() : defaultValue;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -576,7 +623,7 @@ bool SValue::equals(const SValue& other, OpaqueEqualsProc opaqueEqualsProc) cons
 
 		case kTypeData:
 			// Data
-			return *mValue.mData == *other.mValue.mData;
+			return getInlineData() == other.getInlineData();
 
 		case kTypeDictionary:
 			// Dictionary
@@ -584,7 +631,7 @@ bool SValue::equals(const SValue& other, OpaqueEqualsProc opaqueEqualsProc) cons
 
 		case kTypeString:
 			// String
-			return *mValue.mString == *other.mValue.mString;
+			return getInlineString() == other.getInlineString();
 
 		case kTypeFloat32:
 			// Float32
@@ -652,13 +699,15 @@ void SValue::dispose(OpaqueDisposeProc opaqueDisposeProc)
 		Delete(mValue.mArrayOfStrings);
 	} else if (mType == kTypeData) {
 		// Data
-		Delete(mValue.mData);
+		getInlineData().~CData();
+		mType = kTypeEmpty;
 	} else if (mType == kTypeDictionary) {
 		// Dictionary
 		Delete(mValue.mDictionary);
 	} else if (mType == kTypeString) {
 		// String
-		Delete(mValue.mString);
+		getInlineString().~CString();
+		mType = kTypeEmpty;
 	} else if ((mType == kTypeOpaque) && (opaqueDisposeProc != nil)) {
 		// Item Ref and have item dispose proc
 		opaqueDisposeProc(mValue.mOpaque);
@@ -669,6 +718,10 @@ void SValue::dispose(OpaqueDisposeProc opaqueDisposeProc)
 SValue& SValue::operator=(const SValue& other)
 //----------------------------------------------------------------------------------------------------------------------
 {
+	// Check for same
+	if (this == &other)
+		return *this;
+
 	// Copy type
 	mType = other.mType;
 
@@ -686,7 +739,7 @@ SValue& SValue::operator=(const SValue& other)
 
 		case kTypeData:
 			// Data
-			mValue.mData = new CData(*other.mValue.mData);
+			new (mValue.mDataStorage) CData(other.getInlineData());
 			break;
 
 		case kTypeDictionary:
@@ -696,7 +749,7 @@ SValue& SValue::operator=(const SValue& other)
 
 		case kTypeString:
 			// String
-			mValue.mString = new CString(*other.mValue.mString);
+			new (mValue.mStringStorage) CString(other.getInlineString());
 			break;
 
 		case kTypeEmpty:
@@ -720,6 +773,41 @@ SValue& SValue::operator=(const SValue& other)
 	return *this;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+SValue& SValue::operator=(SValue&& other)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Check for same
+	if (this == &other)
+		return *this;
+
+	// Take ownership of any allocated value, leaving other empty
+	mType = other.mType;
+	mValue = other.mValue;
+	takeInlineValue(other);
+
+	return *this;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void SValue::takeInlineValue(SValue& other)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Check value type
+	if (mType == kTypeData) {
+		// Data
+		new (mValue.mDataStorage) CData(std::move(other.getInlineData()));
+		other.getInlineData().~CData();
+	} else if (mType == kTypeString) {
+		// String
+		new (mValue.mStringStorage) CString(std::move(other.getInlineString()));
+		other.getInlineString().~CString();
+	}
+
+	// Leave other empty
+	other.mType = kTypeEmpty;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 const CDictionary& SValue::getEmptyDictionary()
 //----------------------------------------------------------------------------------------------------------------------
@@ -81,11 +81,16 @@ struct SValue {
 	public:
 												// Lifecycle methods
 												SValue(const TArray<CDictionary>& value);
+												SValue(TArray<CDictionary>&& value);
 												SValue(const TArray<CString>& value);
+												SValue(TArray<CString>&& value);
 												SValue(bool value);
 												SValue(const CData& value);
+												SValue(CData&& value);
 												SValue(const CDictionary& value);
+												SValue(CDictionary&& value);
 												SValue(const CString& value);
+												SValue(CString&& value);
 												SValue(Float32 value);
 												SValue(Float64 value);
 												SValue(SInt8 value);
@@ -98,6 +103,7 @@ struct SValue {
 												SValue(UInt64 value);
 												SValue(Opaque value);
 												SValue(const SValue& other, OpaqueCopyProc opaqueCopyProc = nil);
+												SValue(SValue&& other);
 
 												// Instance methods
 						Type					getType() const { return mType; }
@@ -153,11 +159,19 @@ struct SValue {
 						void					dispose(OpaqueDisposeProc opaqueDisposeProc);
 
 						SValue&					operator=(const SValue& other);
+						SValue&					operator=(SValue&& other);
 
 	private:
 												// Lifecycle methods
 												SValue();
 
+												// Instance methods
+						CData&					getInlineData() const
+													{ return *((CData*) mValue.mDataStorage); }
+						CString&				getInlineString() const
+													{ return *((CString*) mValue.mStringStorage); }
+						void					takeInlineValue(SValue& other);
+
 												// Class methods
 		static	const	CDictionary&			getEmptyDictionary();
 
@@ -172,9 +186,7 @@ struct SValue {
 							ValueValue(TArray<CDictionary>* value) : mArrayOfDictionaries(value) {}
 							ValueValue(TArray<CString>* value) : mArrayOfStrings(value) {}
 							ValueValue(bool value) : mBool(value) {}
-							ValueValue(CData* value) : mData(value) {}
 							ValueValue(CDictionary* value) : mDictionary(value) {}
-							ValueValue(CString* value) : mString(value) {}
 							ValueValue(Float32 value) : mFloat32(value) {}
 							ValueValue(Float64 value) : mFloat64(value) {}
 							ValueValue(SInt8 value) : mSInt8(value) {}
@@ -191,9 +203,7 @@ struct SValue {
 							TArray<CDictionary>*	mArrayOfDictionaries;
 							TArray<CString>*		mArrayOfStrings;
 							bool					mBool;
-							CData*					mData;
 							CDictionary*			mDictionary;
-							CString*				mString;
 							Float32					mFloat32;
 							Float64					mFloat64;
 							SInt8					mSInt8;
@@ -205,5 +215,10 @@ struct SValue {
 							UInt32					mUInt32;
 							UInt64					mUInt64;
 							Opaque					mOpaque;
+
+							// Data and strings live inline so string and data values need no allocation of their
+							//	own.  They are constructed and destroyed explicitly based on mType.
+							alignas(CData)		UInt8	mDataStorage[sizeof(CData)];
+							alignas(CString)	UInt8	mStringStorage[sizeof(CString)];
 						} mValue;
 };
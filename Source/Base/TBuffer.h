@@ -4,7 +4,9 @@
 
 #pragma once
 
+#include "CBufferPool.h"
 #include "CppToolboxAssert.h"
+#include "CReferenceCountable.h"
 
 //----------------------------------------------------------------------------------------------------------------------
 // MARK: TBuffer
@@ -13,22 +15,34 @@ template <typename T> struct TBuffer {
 	// Friends
 	template <typename U> friend struct TBuffer;
 
+	// Allocation
+	public:
+		enum Allocation {
+			// Value-initialized with new[]
+			kAllocationZeroed,
+
+			// 64-byte aligned from CBufferPool and returned to it when the last reference goes away.  Contents are
+			//	not initialized, so this is only for plain data types.
+			kAllocationPooled,
+		};
+
 	// Methods
 	public:
 					// Lifecycle methods
-					TBuffer(UInt64 count)
+					TBuffer(UInt64 count, Allocation allocation = kAllocationZeroed) :
+						mByteCount(count * sizeof(T)), mIsPooled(allocation == kAllocationPooled)
 						{
 							// Setup
-							mStorage = new T[count]();
-							mByteCount = count * sizeof(T);
+							mStorage = mIsPooled ? (T*) CBufferPool::allocate((size_t) mByteCount) : new T[count]();
 
 							mReferenceCount = new std::atomic<UInt32>(1);
 						}
 					TBuffer(T* buffer, UInt64 count) :
-						mStorage(buffer), mByteCount(count * sizeof(T)), mReferenceCount(nil)
+						mStorage(buffer), mByteCount(count * sizeof(T)), mReferenceCount(nil), mIsPooled(false)
 						{}
 					TBuffer(const TBuffer<T>& other, UInt64 count) :
-						mStorage(other.mStorage), mByteCount(count * sizeof(T)), mReferenceCount(other.mReferenceCount)
+						mStorage(other.mStorage), mByteCount(count * sizeof(T)), mReferenceCount(other.mReferenceCount),
+								mIsPooled(other.mIsPooled)
 						{
 							// Check
 							AssertFailIf(mByteCount > other.mByteCount);
@@ -36,35 +50,30 @@ template <typename T> struct TBuffer {
 							// Check for reference count
 							if (mReferenceCount != nil)
 								// Add reference
-								(*mReferenceCount)++;
+								SReferenceCount::add(*mReferenceCount);
 						}
 					TBuffer(const TBuffer<T>& other) :
-						mStorage(other.mStorage), mByteCount(other.mByteCount), mReferenceCount(other.mReferenceCount)
+						mStorage(other.mStorage), mByteCount(other.mByteCount), mReferenceCount(other.mReferenceCount),
+								mIsPooled(other.mIsPooled)
 						{
 							// Check for reference count
 							if (mReferenceCount != nil)
 								// Add reference
-								(*mReferenceCount)++;
+								SReferenceCount::add(*mReferenceCount);
 						}
 
 					template <typename U> TBuffer(const TBuffer<U>& other) :
-						mStorage(other.mStorage), mByteCount(other.mByteCount), mReferenceCount(other.mReferenceCount)
+						mStorage(other.mStorage), mByteCount(other.mByteCount), mReferenceCount(other.mReferenceCount),
+								mIsPooled(other.mIsPooled)
 						{
 							// Check for reference count
 							if (mReferenceCount != nil)
 								// Add reference
-								(*mReferenceCount)++;
+								SReferenceCount::add(*mReferenceCount);
 						}
 
 					~TBuffer()
-						{
-							// Check if need to cleanup
-							if ((mReferenceCount != nil) && (--(*mReferenceCount) == 0)) {
-								// Cleanup
-								DeleteArray(mStorage);
-								Delete(mReferenceCount);
-							}
-						}
+						{ removeReference(); }
 
 					// Instance methods
 		UInt64		getCount() const
@@ -80,29 +89,44 @@ template <typename T> struct TBuffer {
 						{ return mStorage[index]; }
 		TBuffer<T>&	operator=(const TBuffer<T>& other)
 						{
-							// Check if need to cleanup
-							if ((mReferenceCount != nil) && (--(*mReferenceCount) == 0)) {
-								// Cleanup
-								DeleteArray(mStorage);
-								Delete(mReferenceCount);
-							}
+							// Check for reference count
+							if (other.mReferenceCount != nil)
+								// Add reference first so assigning to self keeps the storage
+								SReferenceCount::add(*other.mReferenceCount);
+
+							// Remove our reference
+							removeReference();
 
 							// Copy values
 							mStorage = other.mStorage;
 							mByteCount = other.mByteCount;
 							mReferenceCount = other.mReferenceCount;
-
-							// Check for reference count
-							if (mReferenceCount != nil)
-								// Add reference
-								(*mReferenceCount)++;
+							mIsPooled = other.mIsPooled;
 
 							return *this;
 						}
 
+	private:
+					// Instance methods
+		void		removeReference()
+						{
+							// Check if need to cleanup
+							if ((mReferenceCount != nil) && (--(*mReferenceCount) == 0)) {
+								// Cleanup
+								if (mIsPooled)
+									// Return to pool
+									CBufferPool::deallocate((void*) mStorage);
+								else
+									// Delete
+									DeleteArray(mStorage);
+								Delete(mReferenceCount);
+							}
+						}
+
 	// Properties
 	private:
 		T*						mStorage;
 		UInt64					mByteCount;
 		std::atomic<UInt32>*	mReferenceCount;
+		bool					mIsPooled;
 };
@@ -1,99 +1,457 @@
-
 //----------------------------------------------------------------------------------------------------------------------
 //	TCache.h			©2026 Stevo Brock	All rights reserved.
 //----------------------------------------------------------------------------------------------------------------------
 
 #pragma once
 
-#include "CDictionary.h"
+#include "CString.h"
 
 //----------------------------------------------------------------------------------------------------------------------
 // MARK: TCache2D
+//	Items are keyed by column and row, hashed from the two identifiers directly so a lookup never builds a string.
+//		Each item is also linked into a list for its column and for its row, and those lists are released along with
+//		their last item.  An optional item count and byte count budget evicts the least recently used items.
 
 template <typename T> class TCache2D {
+	// Line
+	private:
+		struct Entry;
+		struct Line {
+			// Methods
+			Line(const CString& identifier, UInt32 hashValue) :
+				mIdentifier(identifier), mHashValue(hashValue), mNextInBucket(nil), mFirstEntry(nil), mEntryCount(0)
+				{}
+
+			// Properties
+			CString	mIdentifier;
+			UInt32	mHashValue;
+			Line*	mNextInBucket;
+			Entry*	mFirstEntry;
+			UInt32	mEntryCount;
+		};
+
+	// LineTable
+	private:
+		struct LineTable {
+			// Methods
+			LineTable() : mBuckets(nil), mBucketCount(0), mLineCount(0) {}
+
+			// Properties
+			Line**	mBuckets;
+			UInt32	mBucketCount;
+			UInt32	mLineCount;
+		};
+
+	// Entry
+	private:
+		struct Entry {
+			// Methods
+			Entry(Line& columnLine, Line& rowLine, UInt32 hashValue, const T& item, UInt64 byteCount) :
+				mColumnLine(columnLine), mRowLine(rowLine), mHashValue(hashValue), mNextInBucket(nil),
+						mPreviousInColumn(nil), mNextInColumn(nil), mPreviousInRow(nil), mNextInRow(nil),
+						mMoreRecent(nil), mLessRecent(nil), mItem(item), mByteCount(byteCount)
+				{}
+
+			// Properties
+			Line&	mColumnLine;
+			Line&	mRowLine;
+			UInt32	mHashValue;
+			Entry*	mNextInBucket;
+			Entry*	mPreviousInColumn;
+			Entry*	mNextInColumn;
+			Entry*	mPreviousInRow;
+			Entry*	mNextInRow;
+			Entry*	mMoreRecent;
+			Entry*	mLessRecent;
+			T		mItem;
+			UInt64	mByteCount;
+		};
+
 	// Methods
 	public:
 						// Lifecycle methods
-						TCache2D() {}
+						TCache2D(const OV<UInt32>& maximumCount = OV<UInt32>(),
+								const OV<UInt64>& maximumByteCount = OV<UInt64>()) :
+							mMaximumCount(maximumCount), mMaximumByteCount(maximumByteCount),
+									mEntryBuckets(nil), mEntryBucketCount(0), mCount(0), mByteCount(0),
+									mMostRecentEntry(nil), mLeastRecentEntry(nil),
+									mHitCount(0), mMissCount(0), mEvictionCount(0)
+							{}
+						~TCache2D()
+							{
+								// Cleanup
+								invalidate();
+								DeleteArray(mEntryBuckets);
+								DeleteArray(mColumnLineTable.mBuckets);
+								DeleteArray(mRowLineTable.mBuckets);
+							}
 
 						// Instance methods
-				void	add(const CString& columnID, const CString& rowID, const T& t)
+				void	add(const CString& columnID, const CString& rowID, const T& t, UInt64 byteCount = 0)
 							{
 								// Setup
-								CString	itemIdentifier = columnID + CString::mHyphen + rowID;
+								UInt32	columnHashValue = columnID.getHashValue();
+								UInt32	rowHashValue = rowID.getHashValue();
+								UInt32	hashValue = hashValueFor(columnHashValue, rowHashValue);
 
-								// Update
-								OR<TNSet<CString> >	itemIdentifiersForColumn = mItemIdentifiersByColumnID.get(columnID);
-								if (itemIdentifiersForColumn.hasReference())
-									// Insert
-									itemIdentifiersForColumn->insert(itemIdentifier);
-								else
-									// Store
-									mItemIdentifiersByColumnID.set(columnID, TNSet<CString>(itemIdentifier));
+								// Check for existing
+								Entry*	entry = findEntry(columnID, rowID, hashValue);
+								if (entry != nil) {
+									// Update
+									entry->mItem = t;
+									mByteCount = mByteCount - entry->mByteCount + byteCount;
+									entry->mByteCount = byteCount;
+									touch(*entry);
+								} else {
+									// Grow buckets if needed
+									if (mCount >= mEntryBucketCount)
+										resizeEntryBuckets((mEntryBucketCount > 0) ? mEntryBucketCount * 2 : 16);
 
-								OR<TNSet<CString> >	itemIdentifiersForRow = mItemIdentifiersByRowID.get(rowID);
-								if (itemIdentifiersForRow.hasReference())
-									// Insert
-									itemIdentifiersForRow->insert(itemIdentifier);
-								else
-									// Store
-									mItemIdentifiersByRowID.set(rowID, TNSet<CString>(itemIdentifier));
+									// Create entry
+									Line&	columnLine = addLine(mColumnLineTable, columnID, columnHashValue);
+									Line&	rowLine = addLine(mRowLineTable, rowID, rowHashValue);
+									entry = new Entry(columnLine, rowLine, hashValue, t, byteCount);
+
+									// Link into bucket
+									Entry*&	bucket = mEntryBuckets[hashValue & (mEntryBucketCount - 1)];
+									entry->mNextInBucket = bucket;
+									bucket = entry;
+
+									// Link into column and row
+									entry->mNextInColumn = columnLine.mFirstEntry;
+									if (columnLine.mFirstEntry != nil)
+										columnLine.mFirstEntry->mPreviousInColumn = entry;
+									columnLine.mFirstEntry = entry;
+									columnLine.mEntryCount++;
+
+									entry->mNextInRow = rowLine.mFirstEntry;
+									if (rowLine.mFirstEntry != nil)
+										rowLine.mFirstEntry->mPreviousInRow = entry;
+									rowLine.mFirstEntry = entry;
+									rowLine.mEntryCount++;
+
+									// Link as most recent
+									entry->mLessRecent = mMostRecentEntry;
+									if (mMostRecentEntry != nil)
+										mMostRecentEntry->mMoreRecent = entry;
+									else
+										mLeastRecentEntry = entry;
+									mMostRecentEntry = entry;
+
+									// Update
+									mCount++;
+									mByteCount += byteCount;
+								}
 
-								mItemByIdentifier.set(itemIdentifier, t);
+								// Evict least recently used until within budget, always keeping the item just added
+								while ((mLeastRecentEntry != entry) &&
+										((mMaximumCount.hasValue() && (mCount > *mMaximumCount)) ||
+												(mMaximumByteCount.hasValue() && (mByteCount > *mMaximumByteCount)))) {
+									// Evict
+									removeEntry(*mLeastRecentEntry);
+									mEvictionCount++;
+								}
 							}
-		const	OR<T>	get(const CString& columnID, const CString& rowID) const
+		const	OR<T>	get(const CString& columnID, const CString& rowID)
 							{
-								// Setup
-								CString	itemIdentifier = columnID + CString::mHyphen + rowID;
+								// Find entry
+								Entry*	entry =
+												findEntry(columnID, rowID,
+														hashValueFor(columnID.getHashValue(), rowID.getHashValue()));
+								if (entry == nil) {
+									// Miss
+									mMissCount++;
+
+									return OR<T>();
+								}
+
+								// Hit
+								mHitCount++;
+								touch(*entry);
 
-								return mItemByIdentifier.get(itemIdentifier);
+								return OR<T>(entry->mItem);
 							}
 
+				UInt32	getCount() const
+							{ return mCount; }
+				UInt64	getByteCount() const
+							{ return mByteCount; }
+				UInt64	getHitCount() const
+							{ return mHitCount; }
+				UInt64	getMissCount() const
+							{ return mMissCount; }
+				UInt64	getEvictionCount() const
+							{ return mEvictionCount; }
+				void	resetCounts()
+							{ mHitCount = 0; mMissCount = 0; mEvictionCount = 0; }
+
 				void	invalidate()
 							{
 								// Cleanup everything
-								mItemByIdentifier.removeAll();
-								mItemIdentifiersByColumnID.removeAll();
-								mItemIdentifiersByRowID.removeAll();
+								while (mLeastRecentEntry != nil)
+									// Remove
+									removeEntry(*mLeastRecentEntry);
 							}
 				void	invalidateColumn(const CString& columnID)
 							{
-								// Retrieve item dentifiers for this column
-								OR<TNSet<CString> >	itemIdentifiersForColumn = mItemIdentifiersByColumnID.get(columnID);
-								if (!itemIdentifiersForColumn.hasReference())
+								// Retrieve line for this column
+								Line*	line = findLine(mColumnLineTable, columnID, columnID.getHashValue());
+								if (line == nil)
 									return;
 
-								// Iterate item identifiers
-								for (TSet<CString>::Iterator iterator = itemIdentifiersForColumn->getIterator();
-										iterator; iterator++)
+								// Remove entries.  The line is removed along with its last entry.
+								Entry*	entry = line->mFirstEntry;
+								for (UInt32 i = line->mEntryCount; i > 0; i--) {
 									// Remove
-									mItemByIdentifier.remove(*iterator);
+									Entry*	nextEntry = entry->mNextInColumn;
+									removeEntry(*entry);
+									entry = nextEntry;
+								}
 							}
 				void	invalidateRow(const CString& rowID)
 							{
-								// Retrieve item identifiers for this row
-								OR<TNSet<CString> >	itemIdentifiersForRow = mItemIdentifiersByRowID.get(rowID);
-								if (!itemIdentifiersForRow.hasReference())
+								// Retrieve line for this row
+								Line*	line = findLine(mRowLineTable, rowID, rowID.getHashValue());
+								if (line == nil)
 									return;
 
-								// Iterate item identifiers
-								for (TSet<CString>::Iterator iterator = itemIdentifiersForRow->getIterator();
-										iterator; iterator++)
+								// Remove entries.  The line is removed along with its last entry.
+								Entry*	entry = line->mFirstEntry;
+								for (UInt32 i = line->mEntryCount; i > 0; i--) {
 									// Remove
-									mItemByIdentifier.remove(*iterator);
+									Entry*	nextEntry = entry->mNextInRow;
+									removeEntry(*entry);
+									entry = nextEntry;
+								}
 							}
 				void	invalidate(const CString& columnID, const CString& rowID)
+							{
+								// Find entry
+								Entry*	entry =
+												findEntry(columnID, rowID,
+														hashValueFor(columnID.getHashValue(), rowID.getHashValue()));
+								if (entry != nil)
+									// Remove
+									removeEntry(*entry);
+							}
+
+	private:
+						// Lifecycle methods
+						TCache2D(const TCache2D& other);
+
+						// Instance methods
+				TCache2D&	operator=(const TCache2D& other);
+
+				Entry*	findEntry(const CString& columnID, const CString& rowID, UInt32 hashValue) const
+							{
+								// Check if have any
+								if (mEntryBucketCount == 0)
+									return nil;
+
+								// Walk bucket
+								for (Entry* entry = mEntryBuckets[hashValue & (mEntryBucketCount - 1)]; entry != nil;
+										entry = entry->mNextInBucket) {
+									// Check entry
+									if ((entry->mHashValue == hashValue) &&
+											(entry->mColumnLine.mIdentifier == columnID) &&
+											(entry->mRowLine.mIdentifier == rowID))
+										// Found
+										return entry;
+								}
+
+								return nil;
+							}
+				void	resizeEntryBuckets(UInt32 bucketCount)
 							{
 								// Setup
-								CString	itemIdentifier = columnID + CString::mHyphen + rowID;
+								Entry**	buckets = new Entry*[bucketCount]();
+
+								// Move entries
+								for (UInt32 i = 0; i < mEntryBucketCount; i++) {
+									// Move entries in this bucket
+									Entry*	entry = mEntryBuckets[i];
+									while (entry != nil) {
+										// Move
+										Entry*	nextEntry = entry->mNextInBucket;
+										Entry*&	bucket = buckets[entry->mHashValue & (bucketCount - 1)];
+										entry->mNextInBucket = bucket;
+										bucket = entry;
+										entry = nextEntry;
+									}
+								}
+
+								// Update
+								DeleteArray(mEntryBuckets);
+								mEntryBuckets = buckets;
+								mEntryBucketCount = bucketCount;
+							}
+				void	touch(Entry& entry)
+							{
+								// Check if already most recent
+								if (&entry == mMostRecentEntry)
+									return;
+
+								// Unlink
+								entry.mMoreRecent->mLessRecent = entry.mLessRecent;
+								if (entry.mLessRecent != nil)
+									entry.mLessRecent->mMoreRecent = entry.mMoreRecent;
+								else
+									mLeastRecentEntry = entry.mMoreRecent;
+
+								// Link as most recent
+								entry.mMoreRecent = nil;
+								entry.mLessRecent = mMostRecentEntry;
+								mMostRecentEntry->mMoreRecent = &entry;
+								mMostRecentEntry = &entry;
+							}
+				void	removeEntry(Entry& entry)
+							{
+								// Unlink from bucket
+								Entry**	entryPtr = &mEntryBuckets[entry.mHashValue & (mEntryBucketCount - 1)];
+								while (*entryPtr != &entry)
+									// Next
+									entryPtr = &(*entryPtr)->mNextInBucket;
+								*entryPtr = entry.mNextInBucket;
+
+								// Unlink from column
+								if (entry.mPreviousInColumn != nil)
+									entry.mPreviousInColumn->mNextInColumn = entry.mNextInColumn;
+								else
+									entry.mColumnLine.mFirstEntry = entry.mNextInColumn;
+								if (entry.mNextInColumn != nil)
+									entry.mNextInColumn->mPreviousInColumn = entry.mPreviousInColumn;
+								if (--entry.mColumnLine.mEntryCount == 0)
+									removeLine(mColumnLineTable, entry.mColumnLine);
+
+								// Unlink from row
+								if (entry.mPreviousInRow != nil)
+									entry.mPreviousInRow->mNextInRow = entry.mNextInRow;
+								else
+									entry.mRowLine.mFirstEntry = entry.mNextInRow;
+								if (entry.mNextInRow != nil)
+									entry.mNextInRow->mPreviousInRow = entry.mPreviousInRow;
+								if (--entry.mRowLine.mEntryCount == 0)
+									removeLine(mRowLineTable, entry.mRowLine);
+
+								// Unlink from recents
+								if (entry.mMoreRecent != nil)
+									entry.mMoreRecent->mLessRecent = entry.mLessRecent;
+								else
+									mMostRecentEntry = entry.mLessRecent;
+								if (entry.mLessRecent != nil)
+									entry.mLessRecent->mMoreRecent = entry.mMoreRecent;
+								else
+									mLeastRecentEntry = entry.mMoreRecent;
+
+								// Update
+								mCount--;
+								mByteCount -= entry.mByteCount;
+
+								// Cleanup
+								Entry*	entryToDelete = &entry;
+								Delete(entryToDelete);
+							}
 
-								// Remove
-								mItemByIdentifier.remove(itemIdentifier);
+		static	UInt32	hashValueFor(UInt32 columnHashValue, UInt32 rowHashValue)
+							{
+								// Mix both halves so entries spread across the low bits used to pick a bucket
+								UInt64	value = ((UInt64) columnHashValue << 32) | rowHashValue;
+
+								return (UInt32) ((value * 0x9E3779B97F4A7C15ULL) >> 32);
+							}
+		static	Line*	findLine(const LineTable& lineTable, const CString& identifier, UInt32 hashValue)
+							{
+								// Check if have any
+								if (lineTable.mBucketCount == 0)
+									return nil;
+
+								// Walk bucket
+								for (Line* line = lineTable.mBuckets[hashValue & (lineTable.mBucketCount - 1)];
+										line != nil; line = line->mNextInBucket) {
+									// Check line
+									if ((line->mHashValue == hashValue) && (line->mIdentifier == identifier))
+										// Found
+										return line;
+								}
+
+								return nil;
+							}
+		static	Line&	addLine(LineTable& lineTable, const CString& identifier, UInt32 hashValue)
+							{
+								// Check for existing
+								Line*	line = findLine(lineTable, identifier, hashValue);
+								if (line != nil)
+									return *line;
+
+								// Grow buckets if needed
+								if (lineTable.mLineCount >= lineTable.mBucketCount) {
+									// Setup
+									UInt32	bucketCount =
+													(lineTable.mBucketCount > 0) ? lineTable.mBucketCount * 2 : 16;
+									Line**	buckets = new Line*[bucketCount]();
+
+									// Move lines
+									for (UInt32 i = 0; i < lineTable.mBucketCount; i++) {
+										// Move lines in this bucket
+										Line*	bucketLine = lineTable.mBuckets[i];
+										while (bucketLine != nil) {
+											// Move
+											Line*	nextLine = bucketLine->mNextInBucket;
+											Line*&	bucket = buckets[bucketLine->mHashValue & (bucketCount - 1)];
+											bucketLine->mNextInBucket = bucket;
+											bucket = bucketLine;
+											bucketLine = nextLine;
+										}
+									}
+
+									// Update
+									DeleteArray(lineTable.mBuckets);
+									lineTable.mBuckets = buckets;
+									lineTable.mBucketCount = bucketCount;
+								}
+
+								// Create line
+								line = new Line(identifier, hashValue);
+
+								// Link into bucket
+								Line*&	bucket = lineTable.mBuckets[hashValue & (lineTable.mBucketCount - 1)];
+								line->mNextInBucket = bucket;
+								bucket = line;
+								lineTable.mLineCount++;
+
+								return *line;
+							}
+		static	void	removeLine(LineTable& lineTable, Line& line)
+							{
+								// Unlink from bucket
+								Line**	linePtr = &lineTable.mBuckets[line.mHashValue & (lineTable.mBucketCount - 1)];
+								while (*linePtr != &line)
+									// Next
+									linePtr = &(*linePtr)->mNextInBucket;
+								*linePtr = line.mNextInBucket;
+								lineTable.mLineCount--;
+
+								// Cleanup
+								Line*	lineToDelete = &line;
+								Delete(lineToDelete);
 							}
 
 	// Properties
 	private:
-		TNDictionary<T>					mItemByIdentifier;
-		TNDictionary<TNSet<CString> >	mItemIdentifiersByColumnID;
-		TNDictionary<TNSet<CString> >	mItemIdentifiersByRowID;
+		OV<UInt32>	mMaximumCount;
+		OV<UInt64>	mMaximumByteCount;
+
+		Entry**		mEntryBuckets;
+		UInt32		mEntryBucketCount;
+		LineTable	mColumnLineTable;
+		LineTable	mRowLineTable;
+
+		UInt32		mCount;
+		UInt64		mByteCount;
+		Entry*		mMostRecentEntry;
+		Entry*		mLeastRecentEntry;
+
+		UInt64		mHitCount;
+		UInt64		mMissCount;
+		UInt64		mEvictionCount;
 };
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "CArray.h"
 #include "CBits.h"
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -37,30 +38,18 @@ template <typename T> class TIndexes : CBits {
 												// Setup
 												TNArray<TIndexRange<T> >	ranges;
 
-												// Iterate all bits
-												OV<T>	start;
-												OV<T>	end;
-												for (UInt32 i = 0; i < getCount(); i++) {
-													// Check this bit
-													if (get(i)) {
-														// Check if have range
-														if (!start.hasValue())
-															// Start of new range
-															start.setValue(i);
-
-														// Continue existing range
-														end.setValue(i);
-													} else if (start.hasValue()) {
-														// Add range
-														ranges += TIndexRange<T>(*start, *end);
-														start.removeValue();
-													}
-												}
+												// Each range runs from a set bit to just before the next clear bit
+												for (OV<UInt32> start = getNextSet(); start.hasValue();) {
+													// Find end of range
+													OV<UInt32>	end = getNextClear(*start);
+													UInt32		last = end.hasValue() ? (*end - 1) : (getCount() - 1);
+
+													// Add range
+													ranges += TIndexRange<T>((T) *start, (T) last);
 
-												// Check for one more range
-												if (start.hasValue())
-													// Add last range
-													ranges += TIndexRange<T>(*start, *end);
+													// Next
+													start = end.hasValue() ? getNextSet(*end) : OV<UInt32>();
+												}
 
 												return ranges;
 											}
@@ -44,7 +44,8 @@ template <typename T> struct TIResult {
 
 template <typename T> struct TVResult {
 					// Lifecycle Methods
-					TVResult(const T value) : mValue(OV<T>(value)) {}
+					TVResult(const T& value) : mValue(value) {}
+					TVResult(T&& value) : mValue(std::move(value)) {}
 					TVResult(const SError& error) : mError(OV<SError>(error)) {}
 					TVResult(const TVResult& other) : mValue(other.mValue), mError(other.mError) {}
 
@@ -75,7 +76,8 @@ template <typename T> struct TVResult {
 template <typename T> struct TOVResult {
 					// Lifecycle Methods
 					TOVResult() {}
-					TOVResult(const T value) : mValue(OV<T>(value)) {}
+					TOVResult(const T& value) : mValue(value) {}
+					TOVResult(T&& value) : mValue(std::move(value)) {}
 					TOVResult(const OV<T>& value) : mValue(value) {}
 					TOVResult(const SError& error) : mError(OV<SError>(error)) {}
 					TOVResult(const TOVResult& other) : mValue(other.mValue), mError(other.mError) {}
@@ -0,0 +1,179 @@
+//----------------------------------------------------------------------------------------------------------------------
+//	TRobinHoodSlots.h			©2026 Stevo Brock	All rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include "PlatformDefinitions.h"
+
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: TRobinHoodSlots
+//	TRobinHoodSlots is an open-addressed, Robin Hood ordered index of item pointers.  The hash value of each item is
+//		cached inline so probing and resizing never need to touch the items themselves.  The slot count is a power of 2
+//		and doubles once 3/4 full.  Items are owned by the caller.
+
+template <typename T> class TRobinHoodSlots {
+	// Slot
+	public:
+		struct Slot {
+			UInt32	mHashValue;
+			T*		mItem;
+		};
+
+	// Methods
+	public:
+							// Lifecycle methods
+							TRobinHoodSlots() : mSlotsCount(0), mSlots(nil) {}
+							TRobinHoodSlots(const TRobinHoodSlots<T>& other) :
+								mSlotsCount(other.mSlotsCount), mSlots(nil)
+								{
+									// Slot layout only depends on the hash values, so copy it as is
+									if (mSlotsCount > 0) {
+										// Copy
+										mSlots = (Slot*) ::malloc(mSlotsCount * sizeof(Slot));
+										::memcpy(mSlots, other.mSlots, mSlotsCount * sizeof(Slot));
+									}
+								}
+							~TRobinHoodSlots()
+								{ ::free(mSlots); }
+
+							// Instance methods
+				UInt32		getSlotsCount() const
+								{ return mSlotsCount; }
+				Slot&		getSlot(UInt32 index) const
+								{ return mSlots[index]; }
+
+				template <typename K>
+				Slot*		find(UInt32 hashValue, const K& key,
+									bool (*isMatchProc)(const T& item, const K& key)) const
+								{
+									// Check if have slots
+									if (mSlotsCount == 0)
+										// Nothing to find
+										return nil;
+
+									// Probe.  Robin Hood ordering lets us stop as soon as we reach a slot that is
+									//	closer to its home than we are to ours.
+									UInt32	mask = mSlotsCount - 1;
+									for (UInt32 index = hashValue & mask, distance = 0;;
+											index = (index + 1) & mask, distance++) {
+										// Setup
+										Slot&	slot = mSlots[index];
+
+										// Check slot
+										if ((slot.mItem == nil) || (getProbeDistance(slot.mHashValue, index) < distance))
+											// Not found
+											return nil;
+										else if ((slot.mHashValue == hashValue) && isMatchProc(*slot.mItem, key))
+											// Found
+											return &slot;
+									}
+								}
+
+				void		reserve(UInt32 count)
+								{
+									// Check if need more slots
+									if ((count * kLoadFactorDenominator) <= (mSlotsCount * kLoadFactorNumerator))
+										// Have enough
+										return;
+
+									// Find smallest power of 2 that satisfies the load factor
+									UInt32	slotsCount = mSlotsCount;
+									if (slotsCount == 0)
+										// First slots
+										slotsCount = kInitialCount;
+									while ((count * kLoadFactorDenominator) > (slotsCount * kLoadFactorNumerator))
+										// Double
+										slotsCount *= 2;
+
+									// Setup
+									UInt32	previousSlotsCount = mSlotsCount;
+									Slot*	previousSlots = mSlots;
+
+									// Update
+									mSlotsCount = slotsCount;
+									mSlots = (Slot*) ::calloc(mSlotsCount, sizeof(Slot));
+
+									// Re-insert using cached hash values
+									for (UInt32 i = 0; i < previousSlotsCount; i++) {
+										// Check if have item
+										if (previousSlots[i].mItem != nil)
+											// Insert
+											add(previousSlots[i].mHashValue, previousSlots[i].mItem);
+									}
+
+									// Cleanup
+									::free(previousSlots);
+								}
+				void		add(UInt32 hashValue, T* item)
+								{
+									// Probe for a place, displacing any slot that is closer to its home.  Room must
+									//	have been reserved.
+									Slot	slot = {hashValue, item};
+									UInt32	mask = mSlotsCount - 1;
+									for (UInt32 index = hashValue & mask, distance = 0;;
+											index = (index + 1) & mask, distance++) {
+										// Check slot
+										if (mSlots[index].mItem == nil) {
+											// Empty
+											mSlots[index] = slot;
+
+											return;
+										}
+
+										// Check if should displace
+										UInt32	existingDistance = getProbeDistance(mSlots[index].mHashValue, index);
+										if (existingDistance < distance) {
+											// Swap and continue placing the displaced slot
+											std::swap(mSlots[index], slot);
+											distance = existingDistance;
+										}
+									}
+								}
+				void		remove(Slot& slot)
+								{
+									// Shift following slots back until reaching an empty slot or one already in its
+									//	home position
+									UInt32	mask = mSlotsCount - 1;
+									for (UInt32 index = (UInt32) (&slot - mSlots), nextIndex = (index + 1) & mask;;
+											index = nextIndex, nextIndex = (nextIndex + 1) & mask) {
+										// Check next slot
+										if ((mSlots[nextIndex].mItem == nil) ||
+												(getProbeDistance(mSlots[nextIndex].mHashValue, nextIndex) == 0)) {
+											// Done
+											mSlots[index].mItem = nil;
+
+											return;
+										}
+
+										// Shift back
+										mSlots[index] = mSlots[nextIndex];
+									}
+								}
+				void		removeAll()
+								{
+									// Cleanup
+									::free(mSlots);
+
+									// Reset
+									mSlotsCount = 0;
+									mSlots = nil;
+								}
+
+	private:
+							// Lifecycle methods
+		TRobinHoodSlots<T>&	operator=(const TRobinHoodSlots<T>& other);
+
+							// Instance methods
+				UInt32		getProbeDistance(UInt32 hashValue, UInt32 index) const
+								{ return (index - hashValue) & (mSlotsCount - 1); }
+
+	// Properties
+	private:
+				UInt32			mSlotsCount;
+				Slot*			mSlots;
+
+		static	const	UInt32	kInitialCount = 8;
+		static	const	UInt32	kLoadFactorNumerator = 3;
+		static	const	UInt32	kLoadFactorDenominator = 4;
+};
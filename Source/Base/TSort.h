@@ -0,0 +1,251 @@
+//----------------------------------------------------------------------------------------------------------------------
+//	TSort.h			©2026 Stevo Brock	All rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include "PlatformDefinitions.h"
+
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: TSort
+//	TSort sorts a contiguous run of T in place with the comparator as a template parameter so each comparison can be
+//		inlined.  The comparator is called as compare(item1, item2) and returns true if item1 sorts before item2.
+//		sort() is an introsort (median-of-three quicksort falling back to heapsort) and is not stable.  stableSort()
+//		and merge() preserve the order of equal items.  Partitioning is bounds checked so comparators that also
+//		return true for equal items do not walk off the ends.
+
+template <typename T> class TSort {
+	// Methods
+	public:
+									// Class methods
+		template <typename C>
+		static	void				sort(T* items, UInt32 count, const C& compare)
+										{
+											// Setup
+											UInt32	depthLimit = 0;
+											for (UInt32 i = count; i > 1; i >>= 1)
+												// Add 2 levels for each power of 2
+												depthLimit += 2;
+
+											// Sort
+											introSort(items, count, depthLimit, compare);
+										}
+		template <typename C>
+		static	void				stableSort(T* items, UInt32 count, const C& compare)
+										{
+											// Check count
+											if (count <= kInsertionSortMaxCount) {
+												// Insertion sort is enough
+												insertionSort(items, count, compare);
+
+												return;
+											}
+
+											// Setup
+											T*	scratch = (T*) ::malloc(count * sizeof(T));
+
+											// Sort
+											mergeSort(items, count, scratch, compare);
+
+											// Cleanup
+											::free(scratch);
+										}
+		template <typename C>
+		static	void				mergeSort(T* items, UInt32 count, T* scratch, const C& compare)
+										{
+											// Insertion sort fixed-size runs
+											for (UInt32 start = 0; start < count; start += kInsertionSortMaxCount)
+												// Sort run
+												insertionSort(items + start,
+														std::min<UInt32>(kInsertionSortMaxCount, count - start),
+														compare);
+
+											// Merge runs of increasing width
+											for (UInt32 width = kInsertionSortMaxCount; width < count; width *= 2) {
+												// Iterate pairs of runs
+												for (UInt32 start = 0; (start + width) < count; start += width * 2)
+													// Merge
+													merge(items + start, width,
+															std::min<UInt32>(width * 2, count - start), scratch,
+															compare);
+											}
+										}
+		template <typename C>
+		static	void				merge(T* items, UInt32 leftCount, UInt32 count, T* scratch, const C& compare)
+										{
+											// Check if already in order
+											if (!compare(items[leftCount], items[leftCount - 1]))
+												// Nothing to do
+												return;
+
+											// Move left run aside (scratch must have room for leftCount items)
+											for (UInt32 i = 0; i < leftCount; i++)
+												// Move
+												new (scratch + i) T(std::move(items[i]));
+
+											// Merge back, taking from the right run only when strictly before
+											UInt32	leftIndex = 0;
+											UInt32	rightIndex = leftCount;
+											UInt32	index = 0;
+											while ((leftIndex < leftCount) && (rightIndex < count)) {
+												// Compare
+												if (compare(items[rightIndex], scratch[leftIndex]))
+													// Take right
+													items[index++] = std::move(items[rightIndex++]);
+												else
+													// Take left
+													items[index++] = std::move(scratch[leftIndex++]);
+											}
+											while (leftIndex < leftCount)
+												// Take left
+												items[index++] = std::move(scratch[leftIndex++]);
+
+											// Cleanup
+											for (UInt32 i = 0; i < leftCount; i++)
+												// Destroy
+												scratch[i].~T();
+										}
+
+	private:
+		template <typename C>
+		static	void				introSort(T* items, UInt32 count, UInt32 depthLimit, const C& compare)
+										{
+											// Partition until small enough
+											while (count > kInsertionSortMaxCount) {
+												// Check depth
+												if (depthLimit-- == 0) {
+													// Too many uneven partitions
+													heapSort(items, count, compare);
+
+													return;
+												}
+
+												// Partition
+												UInt32	pivotIndex = partition(items, count, compare);
+
+												// Recurse into the smaller side and loop on the larger
+												UInt32	rightCount = count - pivotIndex - 1;
+												if (pivotIndex < rightCount) {
+													// Left is smaller
+													introSort(items, pivotIndex, depthLimit, compare);
+													items += pivotIndex + 1;
+													count = rightCount;
+												} else {
+													// Right is smaller
+													introSort(items + pivotIndex + 1, rightCount, depthLimit, compare);
+													count = pivotIndex;
+												}
+											}
+
+											// Finish
+											insertionSort(items, count, compare);
+										}
+		template <typename C>
+		static	UInt32				partition(T* items, UInt32 count, const C& compare)
+										{
+											// Move median of first, middle and last to the front as the pivot
+											T*	first = items;
+											T*	middle = items + count / 2;
+											T*	last = items + count - 1;
+											if (compare(*middle, *first))
+												// Order first and middle
+												std::swap(*middle, *first);
+											if (compare(*last, *middle)) {
+												// Order middle and last
+												std::swap(*last, *middle);
+												if (compare(*middle, *first))
+													// Order first and middle
+													std::swap(*middle, *first);
+											}
+											std::swap(*first, *middle);
+
+											// Partition the rest around the pivot
+											UInt32	i = 1;
+											UInt32	j = count - 1;
+											while (true) {
+												// Skip items already on the correct side
+												while ((i <= j) && compare(items[i], items[0]))
+													i++;
+												while ((i <= j) && compare(items[0], items[j]))
+													j--;
+												if (i >= j)
+													break;
+
+												// Swap
+												std::swap(items[i++], items[j--]);
+											}
+
+											// Place pivot
+											std::swap(items[0], items[j]);
+
+											return j;
+										}
+		template <typename C>
+		static	void				insertionSort(T* items, UInt32 count, const C& compare)
+										{
+											// Iterate items
+											for (UInt32 i = 1; i < count; i++) {
+												// Check if out of order
+												if (!compare(items[i], items[i - 1]))
+													// In order
+													continue;
+
+												// Shift preceding items up until the slot is found
+												T		item = std::move(items[i]);
+												UInt32	j = i;
+												do {
+													// Shift
+													items[j] = std::move(items[j - 1]);
+													j--;
+												} while ((j > 0) && compare(item, items[j - 1]));
+
+												// Store
+												items[j] = std::move(item);
+											}
+										}
+		template <typename C>
+		static	void				heapSort(T* items, UInt32 count, const C& compare)
+										{
+											// Build heap
+											for (UInt32 i = count / 2; i > 0; i--)
+												// Sift down
+												siftDown(items, i - 1, count, compare);
+
+											// Extract
+											for (UInt32 end = count - 1; end > 0; end--) {
+												// Move largest to the end
+												std::swap(items[0], items[end]);
+												siftDown(items, 0, end, compare);
+											}
+										}
+		template <typename C>
+		static	void				siftDown(T* items, UInt32 index, UInt32 count, const C& compare)
+										{
+											// Sift
+											while (true) {
+												// Find largest child
+												UInt32	childIndex = index * 2 + 1;
+												if (childIndex >= count)
+													break;
+												if (((childIndex + 1) < count) &&
+														compare(items[childIndex], items[childIndex + 1]))
+													// Right child is larger
+													childIndex++;
+
+												// Check if in order
+												if (!compare(items[index], items[childIndex]))
+													break;
+
+												// Swap
+												std::swap(items[index], items[childIndex]);
+												index = childIndex;
+											}
+										}
+
+	// Properties
+	private:
+		static	const	UInt32	kInsertionSortMaxCount = 16;
+};
+
+// std::min() binds kInsertionSortMaxCount by reference, so it needs a definition
+template <typename T> const UInt32 TSort<T>::kInsertionSortMaxCount;
@@ -6,6 +6,7 @@
 
 #include "CppToolboxAssert.h"
 #include "CHashable.h"
+#include "CReferenceCountable.h"
 
 /*
 	// Top-level definitions
@@ -37,11 +38,18 @@ template <typename T> class I : public CHashable {
 						I(T* instance) : mInstance(instance), mReferenceCount(new std::atomic<UInt32>(1)) {}
 						I(const I<T>& other) :
 							mInstance(other.mInstance), mReferenceCount(other.mReferenceCount)
-							{ (*mReferenceCount)++; }
+							{ SReferenceCount::add(*mReferenceCount); }
+						I(I<T>&& other) :
+							mInstance(other.mInstance), mReferenceCount(other.mReferenceCount)
+							{
+								// Other can only be destroyed or assigned to after this
+								other.mInstance = nil;
+								other.mReferenceCount = nil;
+							}
 						~I()
 							{
 								// One less reference
-								if (--(*mReferenceCount) == 0) {
+								if ((mReferenceCount != nil) && (--(*mReferenceCount) == 0)) {
 									// All done
 									Delete(mInstance);
 									Delete(mReferenceCount);
@@ -67,8 +75,12 @@ template <typename T> class I : public CHashable {
 
 				I<T>&	operator=(const I<T>& other)
 							{
+								// Check for same
+								if (this == &other)
+									return *this;
+
 								// Check for instance
-								if (--(*mReferenceCount) == 0) {
+								if ((mReferenceCount != nil) && (--(*mReferenceCount) == 0)) {
 									// All done
 									Delete(mInstance);
 									Delete(mReferenceCount);
@@ -79,7 +91,15 @@ template <typename T> class I : public CHashable {
 								mReferenceCount = other.mReferenceCount;
 
 								// Additional reference
-								(*mReferenceCount)++;
+								SReferenceCount::add(*mReferenceCount);
+
+								return *this;
+							}
+				I<T>&	operator=(I<T>&& other)
+							{
+								// Swap
+								std::swap(mInstance, other.mInstance);
+								std::swap(mReferenceCount, other.mReferenceCount);
 
 								return *this;
 							}
@@ -136,7 +156,7 @@ template <typename T> struct OI {
 						// Check if have reference
 						if (mInstance != nil)
 							// Additional reference
-							(*mReferenceCount)++;
+							SReferenceCount::add(*mReferenceCount);
 					}
 				~OI()
 					{
@@ -193,7 +213,7 @@ template <typename T> struct OI {
 						// Check if have instance
 						if (mInstance != nil)
 							// Have instance
-							(*mReferenceCount)++;
+							SReferenceCount::add(*mReferenceCount);
 
 						return *this;
 					}
@@ -263,6 +283,9 @@ template <typename T> struct R {
 		T*		operator->() const
 					{ return mReference; }
 
+		R<T>&	operator=(const R<T>& other)
+					{ mReference = other.mReference; return *this; }
+
 		bool	operator==(const R<T>& other) const
 					{ return mReference == other.mReference; }
 
@@ -310,6 +333,9 @@ template <typename T> struct OR {
 		T*		operator->() const
 					{ AssertFailIf(mReference == nil); return mReference; }
 
+		OR<T>&	operator=(const OR<T>& other)
+					{ mReference = other.mReference; return *this; }
+
 		bool	operator==(const OR<T>& other) const
 					{ return (hasReference() == other.hasReference()) &&
 							(!hasReference() || (*mReference == *other.mReference)); }
@@ -351,7 +377,9 @@ template <typename T> struct OV {
 				// Lifecycle methods
 				OV() : mValue(nil) {}
 				OV(const T& value) : mValue(new T(value)) {}
+				OV(T&& value) : mValue(new T(std::move(value))) {}
 				OV(const OV& other) : mValue((other.mValue != nil) ? new T(*other.mValue) : nil) {}
+				OV(OV&& other) : mValue(other.mValue) { other.mValue = nil; }
 				~OV() { Delete(mValue); }
 
 				// Instamce methods
@@ -363,6 +391,8 @@ template <typename T> struct OV {
 					{ return (mValue != nil) ? *mValue : defaultValue; }
 		void	setValue(const T& value)
 					{ if (mValue != nil) *mValue = value; else mValue = new T(value); }
+		void	setValue(T&& value)
+					{ if (mValue != nil) *mValue = std::move(value); else mValue = new T(std::move(value)); }
 		void	setValue(const OV<T>& value)
 					{
 						// Check situation
@@ -386,8 +416,12 @@ template <typename T> struct OV {
 
 		OV<T>&	operator=(const T& value)
 					{ setValue(value); return *this; }
+		OV<T>&	operator=(T&& value)
+					{ setValue(std::move(value)); return *this; }
 		OV<T>&	operator=(const OV<T>& value)
 					{ setValue(value); return *this; }
+		OV<T>&	operator=(OV<T>&& other)
+					{ std::swap(mValue, other.mValue); return *this; }
 
 		bool	operator==(const OV<T>& other) const
 					{ return (hasValue() == other.hasValue()) && (!hasValue() || (*mValue == *other.mValue)); }
@@ -7,8 +7,239 @@
 #include "CDictionary.h"
 #include "TBuffer.h"
 
+#include <math.h>
+
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: Local data
+
+// Days from 0000-03-01 (the start of the proleptic Gregorian era used by the calendar math below) to 2001-01-01
+static	const	SInt64	kDaysFromEraTo2001 = 730791;
+
+struct SRFC3339Cache {
+	// Methods
+	SRFC3339Cache() : mDay(0x7FFFFFFFFFFFFFFFLL), mSecond(0x7FFFFFFFFFFFFFFFLL) {}
+
+	// Properties
+	SInt64	mDay;
+	char	mDayChars[10];		// yyyy-MM-dd
+	SInt64	mSecond;
+	char	mSecondChars[19];	// yyyy-MM-ddTHH:mm:ss
+};
+
+static	thread_local	SRFC3339Cache	sRFC3339Cache;
+
+//----------------------------------------------------------------------------------------------------------------------
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - Local procs
+
+//----------------------------------------------------------------------------------------------------------------------
+static SInt64 sFloorDivide(SInt64 value, SInt64 divisor)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	return (value >= 0) ? value / divisor : -((-value + divisor - 1) / divisor);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+static void sGetCivilDate(SInt64 dayFrom2001, SInt64& year, UInt32& month, UInt32& day)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Split into 400 year eras starting on March 1 so leap days fall at the end of each year
+	SInt64	dayFromEra = dayFrom2001 + kDaysFromEraTo2001;
+	SInt64	era = sFloorDivide(dayFromEra, 146097);
+	UInt32	dayOfEra = (UInt32) (dayFromEra - era * 146097);
+	UInt32	yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+	UInt32	dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+	UInt32	monthFromMarch = (5 * dayOfYear + 2) / 153;
+
+	// Store
+	day = dayOfYear - (153 * monthFromMarch + 2) / 5 + 1;
+	month = (monthFromMarch < 10) ? monthFromMarch + 3 : monthFromMarch - 9;
+	year = (SInt64) yearOfEra + era * 400 + ((month <= 2) ? 1 : 0);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+static SInt64 sGetDayFrom2001(SInt64 year, UInt32 month, UInt32 day)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Inverse of sGetCivilDate()
+	year -= (month <= 2) ? 1 : 0;
+	SInt64	era = sFloorDivide(year, 400);
+	UInt32	yearOfEra = (UInt32) (year - era * 400);
+	UInt32	dayOfYear = (153 * ((month > 2) ? month - 3 : month + 9) + 2) / 5 + day - 1;
+	UInt32	dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+
+	return era * 146097 + (SInt64) dayOfEra - kDaysFromEraTo2001;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+static UInt32 sGetDaysInMonth(UInt32 year, UInt32 month)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Check month
+	if (month == 2)
+		// February
+		return (((year % 4) == 0) && (((year % 100) != 0) || ((year % 400) == 0))) ? 29 : 28;
+	else
+		// The rest
+		return ((month == 4) || (month == 6) || (month == 9) || (month == 11)) ? 30 : 31;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+static void sPutDigits(char* buffer, UInt32 value, UInt32 digitCount)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Write from the last digit back
+	for (UInt32 i = digitCount; i > 0; i--, value /= 10)
+		// Write digit
+		buffer[i - 1] = (char) ('0' + value % 10);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+static bool sGetDigits(const char* chars, UInt32 digitCount, UInt32& value)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Read digits
+	value = 0;
+	for (UInt32 i = 0; i < digitCount; i++) {
+		// Check digit
+		if ((chars[i] < '0') || (chars[i] > '9'))
+			return false;
+
+		// Update
+		value = value * 10 + (UInt32) (chars[i] - '0');
+	}
+
+	return true;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - SUniversalTime
+
+// MARK: Class methods
+
+//----------------------------------------------------------------------------------------------------------------------
+UInt32 SUniversalTime::getRFC3339Chars(UniversalTime time, char* buffer, UniversalTimeInterval timeZoneOffset)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Setup
+	SInt64	milliseconds = (SInt64) floor((time + timeZoneOffset) * 1000.0);
+	SInt64	second = sFloorDivide(milliseconds, 1000);
+
+	// Check if second is cached
+	if (second != sRFC3339Cache.mSecond) {
+		// Check if day is cached
+		SInt64	day = sFloorDivide(second, 86400);
+		if (day != sRFC3339Cache.mDay) {
+			// Compose day
+			SInt64	year;
+			UInt32	month, dayOfMonth;
+			sGetCivilDate(day, year, month, dayOfMonth);
+			if ((year < 0) || (year > 9999))
+				// Not representable
+				return 0;
+			sPutDigits(sRFC3339Cache.mDayChars, (UInt32) year, 4);
+			sRFC3339Cache.mDayChars[4] = '-';
+			sPutDigits(sRFC3339Cache.mDayChars + 5, month, 2);
+			sRFC3339Cache.mDayChars[7] = '-';
+			sPutDigits(sRFC3339Cache.mDayChars + 8, dayOfMonth, 2);
+			sRFC3339Cache.mDay = day;
+		}
+
+		// Compose second
+		UInt32	secondOfDay = (UInt32) (second - day * 86400);
+		::memcpy(sRFC3339Cache.mSecondChars, sRFC3339Cache.mDayChars, 10);
+		sRFC3339Cache.mSecondChars[10] = 'T';
+		sPutDigits(sRFC3339Cache.mSecondChars + 11, secondOfDay / 3600, 2);
+		sRFC3339Cache.mSecondChars[13] = ':';
+		sPutDigits(sRFC3339Cache.mSecondChars + 14, secondOfDay / 60 % 60, 2);
+		sRFC3339Cache.mSecondChars[16] = ':';
+		sPutDigits(sRFC3339Cache.mSecondChars + 17, secondOfDay % 60, 2);
+		sRFC3339Cache.mSecond = second;
+	}
+
+	// Compose
+	::memcpy(buffer, sRFC3339Cache.mSecondChars, 19);
+	buffer[19] = '.';
+	sPutDigits(buffer + 20, (UInt32) (milliseconds - second * 1000), 3);
+
+	// Check time zone offset
+	SInt32	offsetMinutes = (SInt32) floor(timeZoneOffset / 60.0 + 0.5);
+	if (offsetMinutes == 0) {
+		// UTC
+		buffer[23] = 'Z';
+
+		return 24;
+	} else {
+		// Offset
+		UInt32	offsetMinutesAbsolute = (UInt32) abs(offsetMinutes);
+		buffer[23] = (offsetMinutes > 0) ? '+' : '-';
+		sPutDigits(buffer + 24, offsetMinutesAbsolute / 60 * 100 + offsetMinutesAbsolute % 60, 4);
+
+		return 28;
+	}
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+OV<UniversalTime> SUniversalTime::getFromRFC3339Chars(const char* chars, UInt32 charCount)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Check length and separators
+	if ((charCount < 20) || (chars[4] != '-') || (chars[7] != '-') ||
+			((chars[10] != 'T') && (chars[10] != 't') && (chars[10] != ' ')) || (chars[13] != ':') ||
+			(chars[16] != ':'))
+		return OV<UniversalTime>();
+
+	// Read date and time
+	UInt32	year, month, day, hour, minute, second;
+	if (!sGetDigits(chars, 4, year) || !sGetDigits(chars + 5, 2, month) || !sGetDigits(chars + 8, 2, day) ||
+			!sGetDigits(chars + 11, 2, hour) || !sGetDigits(chars + 14, 2, minute) ||
+			!sGetDigits(chars + 17, 2, second) || (month < 1) || (month > 12) || (day < 1) ||
+			(day > sGetDaysInMonth(year, month)) || (hour > 23) || (minute > 59) || (second > 60))
+		return OV<UniversalTime>();
+
+	// Read fractional seconds
+	UInt32			index = 19;
+	Float64			fraction = 0.0;
+	if (chars[index] == '.') {
+		// Read digits
+		Float64	scale = 0.1;
+		for (index++; (index < charCount) && (chars[index] >= '0') && (chars[index] <= '9'); index++, scale /= 10.0)
+			// Update
+			fraction += (chars[index] - '0') * scale;
+		if (index == 20)
+			// No digits
+			return OV<UniversalTime>();
+	}
+
+	// Read time zone offset
+	if (index >= charCount)
+		return OV<UniversalTime>();
+	SInt32	offsetSeconds = 0;
+	if ((chars[index] == 'Z') || (chars[index] == 'z')) {
+		// UTC
+		if ((index + 1) != charCount)
+			return OV<UniversalTime>();
+	} else if ((chars[index] == '+') || (chars[index] == '-')) {
+		// Offset with or without a colon
+		UInt32	offsetHours, offsetMinutes;
+		UInt32	minuteIndex = ((index + 3) < charCount) && (chars[index + 3] == ':') ? index + 4 : index + 3;
+		if (((minuteIndex + 2) != charCount) || !sGetDigits(chars + index + 1, 2, offsetHours) ||
+				!sGetDigits(chars + minuteIndex, 2, offsetMinutes) || (offsetHours > 23) || (offsetMinutes > 59))
+			return OV<UniversalTime>();
+		offsetSeconds = (SInt32) (offsetHours * 3600 + offsetMinutes * 60) * ((chars[index] == '-') ? -1 : 1);
+	} else
+		// Unknown
+		return OV<UniversalTime>();
+
+	return OV<UniversalTime>(
+			(UniversalTime) (sGetDayFrom2001(year, month, day) * 86400 + hour * 3600 + minute * 60 + second -
+					offsetSeconds) + fraction);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
 //----------------------------------------------------------------------------------------------------------------------
-// MARK: SGregorianDate::Components
+// MARK: - SGregorianDate::Components
 
 // MARK: Lifecycle methods
 
@@ -37,13 +37,31 @@ const	UniversalTimeInterval	kUniversalTimeInterval1970To2001	= 978307200.0;
 struct SUniversalTime {
 	// Methods
 	public:
-								// Class methods
-		static	UniversalTime	getCurrent();
-		static	void			setCurrent(UniversalTime time);
+									// Class methods
+		static	UniversalTime		getCurrent();
+		static	void				setCurrent(UniversalTime time);
 
 #if defined(TARGET_OS_MACOS)
-		static	UniversalTime	get(const UTCDateTime& utcDateTime);
+		static	UniversalTime		get(const UTCDateTime& utcDateTime);
 #endif
+
+									// Writes time as RFC 3339 "yyyy-MM-ddTHH:mm:ss.SSS" followed by "Z" when
+									//	timeZoneOffset is 0 and "+hhmm" or "-hhmm" otherwise.  At most
+									//	kRFC3339MaxCharCount chars are written with no terminator, and the count is
+									//	returned.  Returns 0 for years outside 0000 through 9999, which RFC 3339
+									//	cannot represent.  The calendar math is done directly, and the date and time
+									//	through the second are cached per thread, so no locale or time zone lookup is
+									//	done.
+		static	UInt32				getRFC3339Chars(UniversalTime time, char* buffer,
+											UniversalTimeInterval timeZoneOffset = 0.0);
+									// Reads RFC 3339 "yyyy-MM-ddTHH:mm:ss" with optional fractional seconds, followed
+									//	by "Z", "+hh:mm", "-hh:mm", "+hhmm" or "-hhmm".  Days past the end of the
+									//	month, leap years included, are rejected.
+		static	OV<UniversalTime>	getFromRFC3339Chars(const char* chars, UInt32 charCount);
+
+	// Properties
+	public:
+		static	const	UInt32		kRFC3339MaxCharCount = 28;
 };
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,113 @@
+//----------------------------------------------------------------------------------------------------------------------
+//	CParallel.cpp			©2026 Stevo Brock	All rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+
+#include "CParallel.h"
+
+#include "CCoreServices.h"
+
+#include <atomic>
+
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: CParallelBatch
+
+class CParallelBatch {
+	// Methods
+	public:
+						// Lifecycle methods
+						CParallelBatch(const SRange64& range, UInt64 grainSize, CParallel::ForProc forProc,
+								void* userData, UInt32 participantCount) :
+							mEnd(range.getStart() + range.getLength()), mGrainSize(grainSize),
+									mParticipantCount(participantCount), mForProc(forProc), mUserData(userData),
+									mNextIndex(range.getStart()), mRemainingCount(range.getLength())
+							{}
+
+						// Instance methods
+				void	performChunks()
+							{
+								// Claim chunks until there are none left
+								UInt64	start = mNextIndex.load(std::memory_order_relaxed);
+								while (start < mEnd) {
+									// Take a share of what remains, but never less than the grain size
+									UInt64	remainingCount = mEnd - start;
+									UInt64	length =
+													std::min<UInt64>(remainingCount,
+															std::max<UInt64>(mGrainSize,
+																	remainingCount / (mParticipantCount * 2)));
+									if (!mNextIndex.compare_exchange_weak(start, start + length,
+											std::memory_order_relaxed))
+										// Someone else claimed first, start has been updated
+										continue;
+
+									// Perform
+									mForProc(SRange64(start, length), mUserData);
+
+									// Check if this was the last outstanding chunk
+									if (mRemainingCount.fetch_sub(length, std::memory_order_acq_rel) == length)
+										// Done
+										mSemaphore.signal();
+
+									// Next
+									start = mNextIndex.load(std::memory_order_relaxed);
+								}
+							}
+				void	waitUntilCompleted() const
+							{ mSemaphore.waitFor(); }
+
+						// Class methods
+		static	void	perform(CParallelBatch* parallelBatch)
+							{ parallelBatch->performChunks(); }
+
+	// Properties
+	private:
+		UInt64					mEnd;
+		UInt64					mGrainSize;
+		UInt32					mParticipantCount;
+		CParallel::ForProc		mForProc;
+		void*					mUserData;
+
+		std::atomic<UInt64>		mNextIndex;
+		std::atomic<UInt64>		mRemainingCount;
+		CSemaphore				mSemaphore;
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - CParallel
+
+// MARK: Class methods
+
+//----------------------------------------------------------------------------------------------------------------------
+void CParallel::parallelFor(const SRange64& range, UInt64 grainSize, ForProc forProc, void* userData,
+		CWorkItemQueue& workItemQueue)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Setup
+	grainSize = std::max<UInt64>(grainSize, 1);
+	UInt64	chunkCount = (range.getLength() + grainSize - 1) / grainSize;
+	UInt32	participantCount =
+					(UInt32) std::min<UInt64>(chunkCount, CCoreServices::getTotalProcessorCoresCount());
+
+	// Check situation
+	if (participantCount <= 1) {
+		// Nothing to share
+		if (range.getLength() > 0)
+			// Perform
+			forProc(range, userData);
+
+		return;
+	}
+
+	// Submit work items.  They go through a Work Item Queue of our own so that deleting it on the way out cancels
+	//	any that have not started and waits for any that have, after which nothing refers to the batch.
+	CParallelBatch	parallelBatch(range, grainSize, forProc, userData, participantCount);
+	CWorkItemQueue	batchWorkItemQueue(workItemQueue);
+	for (UInt32 i = 1; i < participantCount; i++)
+		// Submit
+		batchWorkItemQueue.submit((CWorkItemQueue::SubmitProc) CParallelBatch::perform, &parallelBatch,
+				CWorkItem::kPriorityHigh);
+
+	// Help, then wait for chunks claimed by work items
+	parallelBatch.performChunks();
+	parallelBatch.waitUntilCompleted();
+}
@@ -0,0 +1,161 @@
+//----------------------------------------------------------------------------------------------------------------------
+//	CParallel.h			©2026 Stevo Brock	All rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include "CArray.h"
+#include "ConcurrencyPrimitives.h"
+#include "CWorkItemQueue.h"
+#include "TRange.h"
+
+/*!
+	CParallel splits a range of indexes into chunks and performs them on a Work Item Queue.
+
+	Chunks are claimed by whoever is free, largest first.  Each claim takes a share of what remains (but never less
+		than the grain size) so early chunks are large and the tail is split finely across everyone still working.
+	The calling thread claims chunks like any other participant and only blocks once nothing is left to claim, waiting
+		for chunks still being performed elsewhere.  Because of this, calling from a Work Item (including one performing
+		a chunk) cannot deadlock the Work Item Queue.
+	Work Items are added at high priority to a Work Item Queue targeting the given one, which is deleted before
+		returning.  Any that start after the range has been fully claimed simply return and any that have not started
+		by then are cancelled, even if the given Work Item Queue is cancelled or paused meanwhile.
+*/
+
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: CParallel
+
+class CParallel {
+	// Procs
+	public:
+		typedef	void	(*ForProc)(const SRange64& range, void* userData);
+
+	// Methods
+	public:
+								// Class methods
+		static	void			parallelFor(const SRange64& range, UInt64 grainSize, ForProc forProc,
+										void* userData = nil, CWorkItemQueue& workItemQueue = CWorkItemQueue::main());
+
+		template <typename T, typename U>
+		static	TNArray<U>		parallelMap(const TArray<T>& array, U (*mapProc)(const T& item, void* userData),
+										void* userData = nil, UInt64 grainSize = 1,
+										CWorkItemQueue& workItemQueue = CWorkItemQueue::main())
+									{
+										// Setup
+										CArray::ItemCount	count = array.getCount();
+										OV<U>*				values = new OV<U>[count];
+										MapInfo<T, U>		mapInfo(array, mapProc, userData, values);
+
+										// Map
+										parallelFor(SRange64(0, count), grainSize, (ForProc) MapInfo<T, U>::perform,
+												&mapInfo, workItemQueue);
+
+										// Collect in order
+										TNArray<U>	mappedArray;
+										for (CArray::ItemIndex i = 0; i < count; i++)
+											// Move value
+											mappedArray.emplace(std::move(*values[i]));
+
+										// Cleanup
+										DeleteArray(values);
+
+										return mappedArray;
+									}
+
+		template <typename T>
+		static	T				parallelReduce(const SRange64& range, UInt64 grainSize, const T& initialValue,
+										T (*rangeProc)(const SRange64& range, void* userData),
+										T (*reduceProc)(const T& value1, const T& value2, void* userData),
+										void* userData = nil, CWorkItemQueue& workItemQueue = CWorkItemQueue::main())
+									{
+										// Compute a value for each chunk
+										ReduceInfo<T>	reduceInfo(rangeProc, userData);
+										parallelFor(range, grainSize, (ForProc) ReduceInfo<T>::perform, &reduceInfo,
+												workItemQueue);
+
+										// Put chunk values back in range order so reduceProc need only be
+										//	associative
+										reduceInfo.mPartials.sort(ReduceInfo<T>::compare);
+
+										// Fold
+										T	value = initialValue;
+										for (typename TArray<typename ReduceInfo<T>::Partial>::Iterator iterator =
+														reduceInfo.mPartials.getIterator();
+												iterator; iterator++)
+											// Reduce
+											value = reduceProc(value, iterator->mValue, userData);
+
+										return value;
+									}
+
+	// MapInfo
+	private:
+		template <typename T, typename U> struct MapInfo {
+					// Lifecycle methods
+					MapInfo(const TArray<T>& array, U (*mapProc)(const T& item, void* userData), void* userData,
+							OV<U>* values) :
+						mArray(array), mMapProc(mapProc), mUserData(userData), mValues(values)
+						{}
+
+					// Class methods
+			static	void	perform(const SRange64& range, MapInfo<T, U>* mapInfo)
+								{
+									// Map items
+									for (UInt64 i = range.getStart(); i < range.getStart() + range.getLength(); i++)
+										// Map item
+										mapInfo->mValues[i].setValue(
+												mapInfo->mMapProc(mapInfo->mArray[(CArray::ItemIndex) i],
+														mapInfo->mUserData));
+								}
+
+			// Properties
+			const	TArray<T>&	mArray;
+					U			(*mMapProc)(const T& item, void* userData);
+					void*		mUserData;
+					OV<U>*		mValues;
+		};
+
+	// ReduceInfo
+	private:
+		template <typename T> struct ReduceInfo {
+			// Partial
+			struct Partial {
+				// Methods
+				Partial(UInt64 start, const T& value) : mStart(start), mValue(value) {}
+
+				// Properties
+				UInt64	mStart;
+				T		mValue;
+			};
+
+					// Lifecycle methods
+					ReduceInfo(T (*rangeProc)(const SRange64& range, void* userData), void* userData) :
+						mRangeProc(rangeProc), mUserData(userData)
+						{}
+
+					// Class methods
+			static	void	perform(const SRange64& range, ReduceInfo<T>* reduceInfo)
+								{
+									// Compute value outside the lock
+									T	value = reduceInfo->mRangeProc(range, reduceInfo->mUserData);
+
+									// Store
+									reduceInfo->mLock.lock();
+									reduceInfo->mPartials += Partial(range.getStart(), value);
+									reduceInfo->mLock.unlock();
+								}
+			static	bool	compare(const Partial& partial1, const Partial& partial2, void* userData)
+								{
+									// Unused
+									(void) userData;
+
+									return partial1.mStart < partial2.mStart;
+								}
+
+			// Properties
+			T				(*mRangeProc)(const SRange64& range, void* userData);
+			void*			mUserData;
+			CLock			mLock;
+			TNArray<Partial>	mPartials;
+		};
+};
@@ -15,7 +15,7 @@ class CThread {
 	public:
 #if defined(TARGET_OS_IOS) || defined(TARGET_OS_MACOS) || defined(TARGET_OS_TVOS) || defined(TARGET_OS_WATCHOS)
 		typedef	void*	Ref;
-#elif defined(TARGET_OS_WINDOWS)
+#elif defined(TARGET_OS_LINUX) || defined(TARGET_OS_WINDOWS)
 		typedef	unsigned long	Ref;
 #endif
 
@@ -47,8 +47,7 @@ class CThread {
 
 						void	start();
 						bool	isRunning() const;
-						void	waitUntilFinished() const
-									{ while (isRunning()) sleepFor(0.001); }
+						void	waitUntilFinished() const;
 
 								// Class methods
 		static			Ref		getCurrentRef();
@@ -58,6 +57,8 @@ class CThread {
 										return CString(getCurrentRef());
 #elif defined(TARGET_OS_WINDOWS)
 										return CString(getCurrentRef(), false);
+#elif defined(TARGET_OS_LINUX)
+										return CString((const void*) getCurrentRef());
 #endif
 									}
 		static			void	sleepFor(UniversalTimeInterval universalTimeInterval);
@@ -72,7 +73,13 @@ class CThread {
 
 	private:
 		static			void	runThreadProc(CThread& thread, void* userData)
-									{ thread.run(); }
+									{
+										// Subclasses carry their own state
+										(void) userData;
+
+										// Run
+										thread.run();
+									}
 
 	// Properties
 	private:
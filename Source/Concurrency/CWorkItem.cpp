@@ -5,27 +5,71 @@
 #include "CWorkItem.h"
 
 #include "ConcurrencyPrimitives.h"
+#include "CSlabAllocator.h"
 
 //----------------------------------------------------------------------------------------------------------------------
-// MARK: CWorkItem::Internals
+// MARK: FinishedProcInfo
 
-class CWorkItem::Internals {
+struct FinishedProcInfo : public CSlabAllocatable {
+	// Methods
+	FinishedProcInfo(CWorkItem::FinishedProc finishedProc, void* userData) :
+		mFinishedProc(finishedProc), mUserData(userData), mNextFinishedProcInfo(nil)
+		{}
+
+	// Class methods
+	static	void	callAll(FinishedProcInfo* finishedProcInfo, CWorkItem& workItem)
+						{
+							// Call and delete each
+							while (finishedProcInfo != nil) {
+								// Call and delete
+								FinishedProcInfo*	nextFinishedProcInfo = finishedProcInfo->mNextFinishedProcInfo;
+								finishedProcInfo->mFinishedProc(workItem, finishedProcInfo->mUserData);
+								Delete(finishedProcInfo);
+								finishedProcInfo = nextFinishedProcInfo;
+							}
+						}
+
+	// Properties
+	CWorkItem::FinishedProc	mFinishedProc;
+	void*					mUserData;
+	FinishedProcInfo*		mNextFinishedProcInfo;
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - CWorkItem::Internals
+
+class CWorkItem::Internals : public CSlabAllocatable {
 	public:
-		Internals(const CString& id, const OV<CString>& reference, CWorkItem::CompletedProc completedProc,
+		Internals(const OV<CString>& id, const OV<CString>& reference, CWorkItem::CompletedProc completedProc,
 				CWorkItem::CancelledProc cancelledProc, void* userData) :
 			mID(id), mReference(reference), mCompletedProc(completedProc), mCancelledProc(cancelledProc),
 					mUserData(userData),
-					mIsCancelled(false), mState(CWorkItem::kStateWaiting)
+					mIsCancelled(false), mIsDropped(false), mState(CWorkItem::kStateWaiting),
+					mFirstFinishedProcInfo(nil), mLastFinishedProcInfo(nil)
 			{}
+		~Internals()
+			{
+				// Cleanup finished proc infos that never got called
+				while (mFirstFinishedProcInfo != nil) {
+					// Unlink and delete
+					FinishedProcInfo*	finishedProcInfo = mFirstFinishedProcInfo;
+					mFirstFinishedProcInfo = finishedProcInfo->mNextFinishedProcInfo;
+					Delete(finishedProcInfo);
+				}
+			}
 
- 		CString						mID;
+ 		OV<CString>					mID;
  		OV<CString>					mReference;
  		CWorkItem::CompletedProc	mCompletedProc;
  		CWorkItem::CancelledProc	mCancelledProc;
  		void*						mUserData;
 
 		bool						mIsCancelled;
+		bool						mIsDropped;
 		CWorkItem::State			mState;
+		FinishedProcInfo*			mFirstFinishedProcInfo;
+		FinishedProcInfo*			mLastFinishedProcInfo;
 		CLock						mStateLock;
 };
 
@@ -36,7 +80,7 @@ class CWorkItem::Internals {
 // MARK: Lifecycle methods
 
 //----------------------------------------------------------------------------------------------------------------------
-CWorkItem::CWorkItem(const CString& id, const OV<CString>& reference, CompletedProc completedProc,
+CWorkItem::CWorkItem(const OV<CString>& id, const OV<CString>& reference, CompletedProc completedProc,
 		CancelledProc cancelledProc, void* userData)
 //----------------------------------------------------------------------------------------------------------------------
 {
@@ -56,7 +100,14 @@ CWorkItem::~CWorkItem()
 const CString& CWorkItem::getID() const
 //----------------------------------------------------------------------------------------------------------------------
 {
-	return mInternals->mID;
+	// Check if have ID.  Most work items are never asked, so the UUID is only generated here when needed.
+	mInternals->mStateLock.lock();
+	if (!mInternals->mID.hasValue())
+		// Generate
+		mInternals->mID.setValue(CUUID::makeVersion4().getBase64String());
+	mInternals->mStateLock.unlock();
+
+	return *mInternals->mID;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -116,17 +167,39 @@ bool CWorkItem::isCancelled() const
 	return mInternals->mIsCancelled;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+bool CWorkItem::isFinished() const
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Determine value
+	mInternals->mStateLock.lock();
+	bool	isFinished = mInternals->mIsDropped || (mInternals->mState == kStateCompleted);
+	mInternals->mStateLock.unlock();
+
+	return isFinished;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 void CWorkItem::transitionTo(State state)
 //----------------------------------------------------------------------------------------------------------------------
 {
 	// Update state
-	bool	didChangeState;
+	bool				didChangeState;
+	FinishedProcInfo*	finishedProcInfo = nil;
 	mInternals->mStateLock.lock();
-	if ((mInternals->mState == kStateWaiting) || (mInternals->mState == kStateActive)) {
+	if (!mInternals->mIsDropped &&
+			((mInternals->mState == kStateWaiting) || (mInternals->mState == kStateActive))) {
 		// Transition to new state
 		mInternals->mState = state;
 		didChangeState = true;
+
+		// Check if finished
+		if (state == kStateCompleted) {
+			// Take finished proc infos
+			finishedProcInfo = mInternals->mFirstFinishedProcInfo;
+			mInternals->mFirstFinishedProcInfo = nil;
+			mInternals->mLastFinishedProcInfo = nil;
+		}
 	} else
 		// Ignore - already in final state
 		didChangeState = false;
@@ -144,6 +217,9 @@ void CWorkItem::transitionTo(State state)
 				else
 					// Call subclass
 					completed();
+
+				// Call finished procs
+				FinishedProcInfo::callAll(finishedProcInfo, *this);
 				break;
 
 			default:
@@ -158,3 +234,49 @@ void CWorkItem::cancel()
 	// Update
 	mInternals->mIsCancelled = true;
 }
+
+//----------------------------------------------------------------------------------------------------------------------
+void CWorkItem::drop()
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Update state
+	FinishedProcInfo*	finishedProcInfo = nil;
+	mInternals->mStateLock.lock();
+	if (!mInternals->mIsDropped && (mInternals->mState == kStateWaiting)) {
+		// Drop
+		mInternals->mIsDropped = true;
+
+		// Take finished proc infos
+		finishedProcInfo = mInternals->mFirstFinishedProcInfo;
+		mInternals->mFirstFinishedProcInfo = nil;
+		mInternals->mLastFinishedProcInfo = nil;
+	}
+	mInternals->mStateLock.unlock();
+
+	// Call finished procs
+	FinishedProcInfo::callAll(finishedProcInfo, *this);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void CWorkItem::addFinishedProc(FinishedProc finishedProc, void* userData)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Check if already finished
+	mInternals->mStateLock.lock();
+	if (!mInternals->mIsDropped && (mInternals->mState != kStateCompleted)) {
+		// Add for later
+		FinishedProcInfo*	finishedProcInfo = new FinishedProcInfo(finishedProc, userData);
+		if (mInternals->mLastFinishedProcInfo != nil)
+			// Append
+			mInternals->mLastFinishedProcInfo->mNextFinishedProcInfo = finishedProcInfo;
+		else
+			// First
+			mInternals->mFirstFinishedProcInfo = finishedProcInfo;
+		mInternals->mLastFinishedProcInfo = finishedProcInfo;
+		mInternals->mStateLock.unlock();
+	} else {
+		// Call now
+		mInternals->mStateLock.unlock();
+		finishedProc(*this, userData);
+	}
+}
@@ -28,6 +28,7 @@ class CWorkItem : public CHashable {
 	typedef	void	(*CompletedProc)(const CWorkItem& workItem, void* userData);
 	typedef	void	(*CancelledProc)(const CWorkItem& workItem, void* userData);
 	typedef	void	(*Proc)(const I<CWorkItem>& workItem, void* userData);
+	typedef	void	(*FinishedProc)(CWorkItem& workItem, void* userData);
 
 	// Classes
 	private:
@@ -36,7 +37,7 @@ class CWorkItem : public CHashable {
 	// Methods
 	public:
 										// Lifecycle methods
-										CWorkItem(const CString& id = CUUID().getBase64String(),
+										CWorkItem(const OV<CString>& id = OV<CString>(),
 												const OV<CString>& reference = OV<CString>(),
 												CompletedProc completedProc = nil, CancelledProc cancelledProc = nil,
 												void* userData = nil);
@@ -51,7 +52,7 @@ class CWorkItem : public CHashable {
 											{ getID().hashInto(hashableHashCollector); }
 
 										// Instance methods
-				const	CString&		getID() const;
+				const	CString&		getID() const;		// Generated on first call if not provided
 				const	OV<CString>&	getReference() const;
 
 						State			getState() const;
@@ -59,6 +60,7 @@ class CWorkItem : public CHashable {
 						bool			isActive() const;
 						bool			isCompleted() const;
 						bool			isCancelled() const;
+						bool			isFinished() const;		// Completed or dropped after being cancelled
 
 										// Subclass methods
 		virtual			void			perform(const I<CWorkItem>& workItem) = 0;
@@ -66,6 +68,8 @@ class CWorkItem : public CHashable {
 										// Internal-use only methods
 						void			transitionTo(State state);
 						void			cancel();
+						void			drop();
+						void			addFinishedProc(FinishedProc finishedProc, void* userData);
 
 	protected:
 										// Subclass methods
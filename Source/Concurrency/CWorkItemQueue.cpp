@@ -7,19 +7,21 @@
 #include "CArray.h"
 #include "CCoreServices.h"
 #include "ConcurrencyPrimitives.h"
+#include "CSlabAllocator.h"
 #include "CThread.h"
 #include "TLockingArray.h"
 #include "TLockingValue.h"
+#include "TWorkStealingDeque.h"
 
 //----------------------------------------------------------------------------------------------------------------------
 // MARK: CProcWorkItem
 
-class CProcWorkItem : public CWorkItem {
+class CProcWorkItem : public CWorkItem, public CSlabAllocatable {
 	// Methods
 	public:
 				// Lifecycle methods
 				CProcWorkItem(Proc proc, void* userData, const OV<CString>& reference) :
-					CWorkItem(CUUID().getBase64String(), reference),
+					CWorkItem(OV<CString>(), reference),
 							mProc(proc), mUserData(userData) {}
 
 				// CWorkItem methods
@@ -36,42 +38,197 @@ class CProcWorkItem : public CWorkItem {
 //----------------------------------------------------------------------------------------------------------------------
 // MARK: - CWorkItemQueue::WorkItemInfo
 
-class CWorkItemQueue::WorkItemInfo : public CEquatable {
+class CWorkItemQueue::WorkItemInfo : public CSlabAllocatable {
+	// Types
 	public:
-				// Lifecycle methods
-				WorkItemInfo(Internals& owningWorkItemQueueInternals, const I<CWorkItem>& workItem,
-						CWorkItem::Priority priority) :
-					mOwningWorkItemQueueInternals(owningWorkItemQueueInternals), mWorkItem(workItem),
-							mPriority(priority), mIndex(WorkItemInfo::mNextIndex++)
-					{}
-				WorkItemInfo(const WorkItemInfo& other) :
-					mOwningWorkItemQueueInternals(other.mOwningWorkItemQueueInternals), mWorkItem(other.mWorkItem),
-							mPriority(other.mPriority), mIndex(other.mIndex)
-					{}
+		typedef	bool	(*IsMatchProc)(const WorkItemInfo& workItemInfo, void* userData);
 
-				// CEquatable methods
-		bool	operator==(const CEquatable& other) const
-					{ return this == &other; }
+	// List
+	//	Idle and active work item infos are kept in intrusive FIFO lists so adding, taking the first and removing any
+	//		given work item info are all constant time.
+	public:
+		class List {
+			public:
+								// Lifecycle methods
+								List() : mFirstWorkItemInfo(nil), mLastWorkItemInfo(nil), mCount(0) {}
+
+								// Instance methods
+				UInt32			getCount() const
+									{ return mCount; }
+				bool			isEmpty() const
+									{ return mCount == 0; }
+				WorkItemInfo*	getFirst() const
+									{ return mFirstWorkItemInfo; }
+
+				void			add(WorkItemInfo& workItemInfo)
+									{
+										// Link at end
+										workItemInfo.mPreviousWorkItemInfo = mLastWorkItemInfo;
+										workItemInfo.mNextWorkItemInfo = nil;
+										if (mLastWorkItemInfo != nil)
+											// Have last
+											mLastWorkItemInfo->mNextWorkItemInfo = &workItemInfo;
+										else
+											// Empty
+											mFirstWorkItemInfo = &workItemInfo;
+										mLastWorkItemInfo = &workItemInfo;
+										mCount++;
+									}
+				void			remove(WorkItemInfo& workItemInfo)
+									{
+										// Unlink
+										if (workItemInfo.mPreviousWorkItemInfo != nil)
+											// Have previous
+											workItemInfo.mPreviousWorkItemInfo->mNextWorkItemInfo =
+													workItemInfo.mNextWorkItemInfo;
+										else
+											// Is first
+											mFirstWorkItemInfo = workItemInfo.mNextWorkItemInfo;
+										if (workItemInfo.mNextWorkItemInfo != nil)
+											// Have next
+											workItemInfo.mNextWorkItemInfo->mPreviousWorkItemInfo =
+													workItemInfo.mPreviousWorkItemInfo;
+										else
+											// Is last
+											mLastWorkItemInfo = workItemInfo.mPreviousWorkItemInfo;
+										workItemInfo.mPreviousWorkItemInfo = nil;
+										workItemInfo.mNextWorkItemInfo = nil;
+										mCount--;
+									}
+				void			removeAll()
+									{
+										// Delete all
+										while (mFirstWorkItemInfo != nil) {
+											// Unlink and delete
+											WorkItemInfo*	workItemInfo = mFirstWorkItemInfo;
+											mFirstWorkItemInfo = workItemInfo->mNextWorkItemInfo;
+											Delete(workItemInfo);
+										}
+										mLastWorkItemInfo = nil;
+										mCount = 0;
+									}
 
-				// Instance methods
-		void	perform()
-					{ mWorkItem->perform(mWorkItem); }
+			// Properties
+			private:
+				WorkItemInfo*	mFirstWorkItemInfo;
+				WorkItemInfo*	mLastWorkItemInfo;
+				UInt32			mCount;
+		};
 
-		void	transitionTo(CWorkItem::State state)
-					{ mWorkItem->transitionTo(state); }
-		void	cancel()
-					{ mWorkItem->cancel(); }
+	// Methods
+	public:
+								// Lifecycle methods
+								WorkItemInfo(Internals& owningWorkItemQueueInternals, CWorkItem::Priority priority) :
+									mOwningWorkItemQueueInternals(owningWorkItemQueueInternals),
+											mPriority(priority), mIndex(0), mIsAdmitted(false),
+											mPendingDependenciesCount(0), mIsOrphaned(false),
+											mPreviousWorkItemInfo(nil), mNextWorkItemInfo(nil),
+											mNextInjectedWorkItemInfo(nil)
+									{}
+		virtual					~WorkItemInfo() {}
+
+								// Instance methods
+				void			perform()
+									{
+										// Perform, noting that this thread is inside a work item in case it waits
+										mCurrentPerformDepth++;
+										performWorkItem();
+										mCurrentPerformDepth--;
+									}
+
+								// Subclass methods
+		virtual	OR<CWorkItem>	getWorkItem() const = 0;
+		virtual	void			performWorkItem() = 0;
+		virtual	void			transitionTo(CWorkItem::State state) = 0;
+		virtual	void			cancel() = 0;
+		virtual	void			drop() = 0;
+		virtual	bool			isCancelled() const = 0;
 
 		// Properties
-				Internals&			mOwningWorkItemQueueInternals;
-				I<CWorkItem>		mWorkItem;
-				CWorkItem::Priority	mPriority;
-				UInt32				mIndex;
+				Internals&					mOwningWorkItemQueueInternals;
+				CWorkItem::Priority			mPriority;
+				UInt32						mIndex;
+				bool						mIsAdmitted;
+				std::atomic<UInt32>			mPendingDependenciesCount;
+				bool						mIsOrphaned;
+
+				WorkItemInfo*				mPreviousWorkItemInfo;
+				WorkItemInfo*				mNextWorkItemInfo;
+				WorkItemInfo*				mNextInjectedWorkItemInfo;
+
+		static	std::atomic<UInt32>			mNextIndex;
+		static	thread_local	UInt32		mCurrentPerformDepth;
+};
+
+std::atomic<UInt32>		CWorkItemQueue::WorkItemInfo::mNextIndex(0);
+thread_local	UInt32	CWorkItemQueue::WorkItemInfo::mCurrentPerformDepth = 0;
 
-		static	UInt32				mNextIndex;
+//----------------------------------------------------------------------------------------------------------------------
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - CWorkItemQueue::InstanceWorkItemInfo
+
+class CWorkItemQueue::InstanceWorkItemInfo : public WorkItemInfo {
+	public:
+						// Lifecycle methods
+						InstanceWorkItemInfo(Internals& owningWorkItemQueueInternals, const I<CWorkItem>& workItem,
+								CWorkItem::Priority priority) :
+							WorkItemInfo(owningWorkItemQueueInternals, priority), mWorkItem(workItem)
+							{}
+
+						// WorkItemInfo methods
+		OR<CWorkItem>	getWorkItem() const
+							{ return OR<CWorkItem>(*mWorkItem); }
+		void			performWorkItem()
+							{ mWorkItem->perform(mWorkItem); }
+		void			transitionTo(CWorkItem::State state)
+							{ mWorkItem->transitionTo(state); }
+		void			cancel()
+							{ mWorkItem->cancel(); }
+		void			drop()
+							{ mWorkItem->drop(); }
+		bool			isCancelled() const
+							{ return mWorkItem->isCancelled(); }
+
+	// Properties
+	private:
+		I<CWorkItem>	mWorkItem;
 };
 
-UInt32	CWorkItemQueue::WorkItemInfo::mNextIndex = 0;
+//----------------------------------------------------------------------------------------------------------------------
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - CWorkItemQueue::ProcWorkItemInfo
+//	ProcWorkItemInfo is the whole record for a work item added with submit().  There is no CWorkItem behind it so
+//		nothing else is allocated, and state transitions have nobody to inform.
+
+class CWorkItemQueue::ProcWorkItemInfo : public WorkItemInfo {
+	public:
+						// Lifecycle methods
+						ProcWorkItemInfo(Internals& owningWorkItemQueueInternals, SubmitProc submitProc,
+								void* userData, CWorkItem::Priority priority) :
+							WorkItemInfo(owningWorkItemQueueInternals, priority),
+									mSubmitProc(submitProc), mUserData(userData), mIsCancelled(false)
+							{}
+
+						// WorkItemInfo methods
+		OR<CWorkItem>	getWorkItem() const
+							{ return OR<CWorkItem>(); }
+		void			performWorkItem()
+							{ mSubmitProc(mUserData); }
+		void			transitionTo(CWorkItem::State state)
+							{ (void) state; }
+		void			cancel()
+							{ mIsCancelled = true; }
+		void			drop()
+							{}
+		bool			isCancelled() const
+							{ return mIsCancelled; }
+
+	// Properties
+	private:
+		SubmitProc	mSubmitProc;
+		void*		mUserData;
+		bool		mIsCancelled;
+};
 
 //----------------------------------------------------------------------------------------------------------------------
 //----------------------------------------------------------------------------------------------------------------------
@@ -79,26 +236,25 @@ UInt32	CWorkItemQueue::WorkItemInfo::mNextIndex = 0;
 
 class CWorkItemQueue::WorkItemThread : public CThread {
 	public:
-		typedef	void	(*WorkItemInfoCompleteProc)(const R<WorkItemInfo>& workItemInfo,
-								WorkItemThread& workItemThread);
+		typedef	void	(*WorkItemInfoCompleteProc)(WorkItemInfo& workItemInfo, WorkItemThread& workItemThread);
 
 				WorkItemThread(const CString& name, WorkItemInfoCompleteProc workItemInfoCompleteProc) :
 					CThread(name),
-							mWorkItemInfoCompleteProc(workItemInfoCompleteProc)
+							mNextIdleWorkItemThread(nil), mWorkItemInfoCompleteProc(workItemInfoCompleteProc),
+							mWorkItemInfo(nil)
 					{ start(); }
 
 		void	run()
 					{
 						// Run forever
 						while (true) {
-							// Check for work item info
-							if (!mWorkItemInfo.hasValue())
+							// Wait for work item info.  A signal may be left over from a work item info that was
+							//	handed over while we were still finishing the previous one.
+							WorkItemInfo*	workItemInfo;
+							while ((workItemInfo = mWorkItemInfo.exchange(nil)) == nil)
 								// Wait
 								mSemaphore.waitFor();
 
-							// Setup
-							const	R<WorkItemInfo>	workItemInfo(*mWorkItemInfo);
-
 							// Note active
 							workItemInfo->transitionTo(CWorkItem::kStateActive);
 
@@ -108,28 +264,55 @@ class CWorkItemQueue::WorkItemThread : public CThread {
 							// Note completed
 							workItemInfo->transitionTo(CWorkItem::kStateCompleted);
 
-							// Reset
-							mWorkItemInfo.removeValue();
-
 							// Call proc
-							mWorkItemInfoCompleteProc(workItemInfo, *this);
+							mWorkItemInfoCompleteProc(*workItemInfo, *this);
 						}
 					}
-		void	process(const R<WorkItemInfo>& workItemInfo)
+		void	process(WorkItemInfo& workItemInfo)
 					{
 						// Store
-						mWorkItemInfo.setValue(workItemInfo);
+						mWorkItemInfo = &workItemInfo;
 
 						// Trigger
 						mSemaphore.signal();
 					}
 
 	// Properties
+	public:
+		WorkItemThread*				mNextIdleWorkItemThread;
+
 	private:
 		WorkItemInfoCompleteProc	mWorkItemInfoCompleteProc;
 		CSemaphore					mSemaphore;
 
-		OV<R<WorkItemInfo> >		mWorkItemInfo;
+		std::atomic<WorkItemInfo*>	mWorkItemInfo;
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - CWorkItemQueue::WorkStealingThread
+
+class CWorkItemQueue::WorkStealingThread : public CThread {
+	public:
+		typedef	void	(*RunProc)(WorkStealingThread& workStealingThread);
+
+				WorkStealingThread(const CString& name, UInt32 index, RunProc runProc) :
+					CThread(name),
+							mIndex(index), mIsSleeping(false), mRunProc(runProc)
+					{}
+
+		void	run()
+					{ mRunProc(*this); }
+
+	// Properties
+	public:
+		UInt32								mIndex;
+		TWorkStealingDeque<WorkItemInfo>	mWorkItemInfos[CWorkItem::kPriorityHigh + 1];
+		std::atomic<bool>					mIsSleeping;
+		CSemaphore							mSemaphore;
+
+	private:
+		RunProc								mRunProc;
 };
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -138,20 +321,61 @@ class CWorkItemQueue::WorkItemThread : public CThread {
 
 class CWorkItemQueue::Internals {
 	public:
+		typedef	bool	(*IsDoneProc)(void* userData);
+
 									Internals(CWorkItemQueue& workItemQueue, const OR<CItemsProgress>& itemsProgress,
 											UInt32 maximumConcurrentWorkItems,
 											OR<Internals> targetWorkItemQueueInternals = OR<Internals>()) :
 										mWorkItemQueue(workItemQueue), mItemsProgress(itemsProgress),
 												mIsPaused(false),
 												mTargetWorkItemQueueInternals(targetWorkItemQueueInternals),
-												mMaximumConcurrentWorkItems(maximumConcurrentWorkItems)
+												mMaximumConcurrentWorkItems(maximumConcurrentWorkItems),
+												mIdleWorkItemInfosCountDeep(0), mActiveWorkItemInfosCountDeep(0),
+												mIsNextWorkItemInfoValid(false)
 										{
-											if (mTargetWorkItemQueueInternals.hasReference())
+											// Check if have target
+											if (mTargetWorkItemQueueInternals.hasReference()) {
 												// Add as child
 												mTargetWorkItemQueueInternals->addChild(*this);
+
+												// Note if we or any target up the chain below the main work item
+												//	queue has a limit at all.  Helping waits run work items on top of
+												//	the pool, so only work items from unlimited chains may skip
+												//	dispatch.
+												mIsConstrainedDeep =
+														(mMaximumConcurrentWorkItems != (UInt32) ~0) ||
+														mTargetWorkItemQueueInternals->mIsConstrainedDeep;
+											} else
+												// Main work item queue
+												mIsConstrainedDeep = false;
 										}
 									~Internals()
 										{
+											// Orphan pending work items.  They are dropped and freed once their
+											//	dependencies finish, so we do not wait on work items in other queues.
+											mPendingWorkItemInfosLock.lock();
+											mWorkItemInfosLock.lock();
+											while (!mPendingWorkItemInfos.isEmpty()) {
+												// Orphan
+												WorkItemInfo*	workItemInfo = mPendingWorkItemInfos.getFirst();
+												mPendingWorkItemInfos.remove(*workItemInfo);
+												workItemInfo->cancel();
+												workItemInfo->mIsOrphaned = true;
+
+												// Update
+												if (mItemsProgress.hasReference())
+													mItemsProgress->addCompletedItemsCount(1);
+												mInFlightWorkItemsCount.subtract(1);
+											}
+											mWorkItemInfosLock.unlock();
+											mPendingWorkItemInfosLock.unlock();
+
+											// Cancel everything else and wait for any work items still held by the
+											//	scheduler or being performed.  They are freed along their usual paths
+											//	so our counts and those of our targets stay in step.
+											cancel(workItemInfoAlwaysMatches, nil);
+											wait();
+
 											// Check if have target
 											if (mTargetWorkItemQueueInternals.hasReference())
 												// Remove as child
@@ -159,91 +383,275 @@ class CWorkItemQueue::Internals {
 										}
 
 				void				addChild(Internals& childWorkItemQueueInternals)
-										{ mChildWorkItemQueueInternals +=
-												R<Internals>(childWorkItemQueueInternals); }
+										{
+											// Add
+											mChildWorkItemQueueInternals += R<Internals>(childWorkItemQueueInternals);
+											invalidateNextWorkItemInfoDeep();
+										}
 				void				removeChild(Internals& childWorkItemQueueInternals)
-										{ mChildWorkItemQueueInternals -=
-												R<Internals>(childWorkItemQueueInternals); }
+										{
+											// Remove
+											mChildWorkItemQueueInternals -= R<Internals>(childWorkItemQueueInternals);
+											invalidateNextWorkItemInfoDeep();
+										}
 
 				void				add(const I<CWorkItem>& workItem, CWorkItem::Priority priority)
 										{
-											// Add
-											mWorkItemInfosLock.lock();
-											mIdleWorkItemInfos += WorkItemInfo(*this, workItem, priority);
-											mWorkItemInfosLock.unlock();
+											// Update
+											if (mItemsProgress.hasReference())
+												mItemsProgress->addTotalItemsCount(1);
+											mInFlightWorkItemsCount.add(1);
+
+											// Queue
+											queue(*(new InstanceWorkItemInfo(*this, workItem, priority)));
+										}
+				void				submit(SubmitProc submitProc, void* userData, CWorkItem::Priority priority)
+										{
+											// Update
+											if (mItemsProgress.hasReference())
+												mItemsProgress->addTotalItemsCount(1);
+											mInFlightWorkItemsCount.add(1);
+
+											// Queue
+											queue(*(new ProcWorkItemInfo(*this, submitProc, userData, priority)));
+										}
+				void				add(const I<CWorkItem>& workItem, CWorkItem::Priority priority,
+											const TArray<I<CWorkItem> >& dependencies)
+										{
+											// Check if have dependencies
+											if (dependencies.isEmpty()) {
+												// Add
+												add(workItem, priority);
+
+												return;
+											}
 
 											// Update
 											if (mItemsProgress.hasReference())
 												mItemsProgress->addTotalItemsCount(1);
 											mInFlightWorkItemsCount.add(1);
+
+											// Hold aside until all dependencies have finished.  The extra count keeps
+											//	dependencies that have already finished from releasing it early.
+											WorkItemInfo*	workItemInfo =
+																	new InstanceWorkItemInfo(*this, workItem, priority);
+											workItemInfo->mPendingDependenciesCount = dependencies.getCount() + 1;
+											mWorkItemInfosLock.lock();
+											mPendingWorkItemInfos.add(*workItemInfo);
+											mWorkItemInfosLock.unlock();
+											for (TArray<I<CWorkItem> >::Iterator iterator = dependencies.getIterator();
+													iterator; iterator++)
+												// Add finished proc
+												(*iterator)->addFinishedProc(dependencyFinished, workItemInfo);
+											dependencyFinished(*workItem, workItemInfo);
+										}
+				void				queue(WorkItemInfo& workItemInfo)
+										{
+											// Check if can bypass dispatch
+											if ((mSchedulerMode == kSchedulerModeWorkStealing) &&
+													!mIsConstrainedDeep && !isPausedDeep()) {
+												// Add
+												mWorkItemInfosLock.lock();
+												mScheduledWorkItemInfos.add(workItemInfo);
+												mWorkItemInfosLock.unlock();
+
+												// Schedule
+												schedule(workItemInfo, true);
+
+												return;
+											}
+
+											// Add.  The index is assigned under the lock so indexes increase
+											//	monotonically within each list.
+											mWorkItemInfosLock.lock();
+											workItemInfo.mIndex = WorkItemInfo::mNextIndex++;
+											mIdleWorkItemInfos[workItemInfo.mPriority].add(workItemInfo);
+											mWorkItemInfosLock.unlock();
+											updateCountsDeep(1, 0);
 										}
-				void				cancel(TArray<WorkItemInfo>::IsMatchProc isMatchProc, void* userData)
+				void				release(WorkItemInfo& workItemInfo)
 										{
+											// Check if cancelled while pending
+											if (workItemInfo.isCancelled()) {
+												// Update
+												mWorkItemInfosLock.lock();
+												if (mItemsProgress.hasReference())
+													mItemsProgress->addCompletedItemsCount(1);
+												mInFlightWorkItemsCount.subtract(1);
+												checkEmpty();
+												mWorkItemInfosLock.unlock();
+
+												// Drop
+												workItemInfo.drop();
+
+												// Cleanup
+												WorkItemInfo*	workItemInfoToDelete = &workItemInfo;
+												Delete(workItemInfoToDelete);
+											} else
+												// Queue
+												queue(workItemInfo);
+										}
+				void				cancel(WorkItemInfo::IsMatchProc isMatchProc, void* userData)
+										{
+											// Setup
+											WorkItemInfo::List	cancelledWorkItemInfos;
+
 											// Update info
 											mWorkItemInfosLock.lock();
 
 											// Process active work item infos
-											for (TArray<WorkItemInfo>::Iterator iterator =
-															mActiveWorkItemInfos.getIterator();
-													iterator; iterator++) {
+											for (WorkItemInfo* workItemInfo = mActiveWorkItemInfos.getFirst();
+													workItemInfo != nil;
+													workItemInfo = workItemInfo->mNextWorkItemInfo) {
 												// Check for match
-												if (isMatchProc(*iterator, userData))
-													// Transition to cancelled.  We do not remove from the array as
+												if (isMatchProc(*workItemInfo, userData))
+													// Transition to cancelled.  We do not remove from the list as
 													//	by definition, this work item is in progress.
-													iterator->cancel();
+													workItemInfo->cancel();
 											}
 
-											// Process idle work item infos
-											for (CArray::ItemIndex i = mIdleWorkItemInfos.getCount(); i > 0; i--) {
-												// Get item
-												WorkItemInfo&	workItemInfo = mIdleWorkItemInfos[i - 1];
-
+											// Process scheduled work item infos
+											for (WorkItemInfo* workItemInfo = mScheduledWorkItemInfos.getFirst();
+													workItemInfo != nil;
+													workItemInfo = workItemInfo->mNextWorkItemInfo) {
 												// Check for match
-												if (isMatchProc(workItemInfo, userData)) {
-													// Transition to cancelled
-													workItemInfo.cancel();
+												if (isMatchProc(*workItemInfo, userData))
+													// Transition to cancelled.  The scheduler still holds it and
+													//	will skip performing it when taken.
+													workItemInfo->cancel();
+											}
 
-													// Remove
-													mIdleWorkItemInfos.removeAtIndex(i - 1);
+											// Process pending work item infos
+											for (WorkItemInfo* workItemInfo = mPendingWorkItemInfos.getFirst();
+													workItemInfo != nil;
+													workItemInfo = workItemInfo->mNextWorkItemInfo) {
+												// Check for match
+												if (isMatchProc(*workItemInfo, userData))
+													// Transition to cancelled.  It will be dropped once its
+													//	dependencies have finished.
+													workItemInfo->cancel();
+											}
 
-													// Update
-													if (mItemsProgress.hasReference())
-														mItemsProgress->addCompletedItemsCount(1);
-													mInFlightWorkItemsCount.subtract(1);
+											// Process idle work item infos
+											for (UInt32 i = 0; i < kPriorityCount; i++) {
+												// Iterate work item infos
+												WorkItemInfo*	workItemInfo = mIdleWorkItemInfos[i].getFirst();
+												while (workItemInfo != nil) {
+													// Setup
+													WorkItemInfo*	nextWorkItemInfo = workItemInfo->mNextWorkItemInfo;
+
+													// Check for match
+													if (isMatchProc(*workItemInfo, userData)) {
+														// Transition to cancelled
+														workItemInfo->cancel();
+
+														// Remove
+														mIdleWorkItemInfos[i].remove(*workItemInfo);
+														cancelledWorkItemInfos.add(*workItemInfo);
+
+														// Update
+														if (mItemsProgress.hasReference())
+															mItemsProgress->addCompletedItemsCount(1);
+														mInFlightWorkItemsCount.subtract(1);
+													}
+
+													// Next
+													workItemInfo = nextWorkItemInfo;
 												}
 											}
 
 											// Check empty
 											checkEmpty();
 
+											// Update counts.  This is done before unlocking so no dispatch can take a
+											//	cached next work item info that we have removed.
+											if (!cancelledWorkItemInfos.isEmpty())
+												// Update counts
+												updateCountsDeep(-(SInt32) cancelledWorkItemInfos.getCount(), 0);
+
 											// All done
 											mWorkItemInfosLock.unlock();
+
+											// Check if removed any
+											if (!cancelledWorkItemInfos.isEmpty()) {
+												// Drop
+												for (WorkItemInfo* workItemInfo = cancelledWorkItemInfos.getFirst();
+														workItemInfo != nil;
+														workItemInfo = workItemInfo->mNextWorkItemInfo)
+													// Drop
+													workItemInfo->drop();
+												cancelledWorkItemInfos.removeAll();
+											}
 										}
 
 				void				pause()
-										{ mIsPaused = true; }
+										{
+											// Pause
+											mIsPaused = true;
+											invalidateNextWorkItemInfoDeep();
+										}
 				void				resume()
-										{ mIsPaused = false; }
+										{
+											// Resume
+											mIsPaused = false;
+											invalidateNextWorkItemInfoDeep();
+										}
 				void				wait()
-										{ mInFlightWorkItemsCount.wait(); }
-
-				UInt32				getActiveWorkItemInfosCountDeep()
 										{
-											// Setup
-											UInt32	count = 0;
+											// Setup.  A work stealing thread waits on its own semaphore so newly
+											//	scheduled work items wake it as well.
+											CSemaphore			semaphore;
+											WorkStealingThread*	workStealingThread = mCurrentWorkStealingThread;
+											R<CSemaphore>		waitSemaphore(
+																		(workStealingThread != nil) ?
+																				workStealingThread->mSemaphore :
+																				semaphore);
+
+											// Check if anything in flight.  This is checked under the lock so that
+											//	whoever finished the last work item is done with us.
+											mWorkItemInfosLock.lock();
+											if (*mInFlightWorkItemsCount == 0) {
+												// Nothing to wait for
+												mWorkItemInfosLock.unlock();
+
+												return;
+											}
+
+											// Register to be signaled when empty
+											mEmptySemaphores += waitSemaphore;
+											mWorkItemInfosLock.unlock();
 
-											// Add our active work items
+											// Help until empty
+											helpUntil(isEmpty, this, *waitSemaphore);
+
+											// Unregister
 											mWorkItemInfosLock.lock();
-											count += mActiveWorkItemInfos.getCount();
+											mEmptySemaphores -= waitSemaphore;
 											mWorkItemInfosLock.unlock();
+										}
 
-											// Add active work items from all child work item queues
-											mChildWorkItemQueueInternals.apply(
-													(TNLockingArray<R<Internals> >::ApplyProc)
-															getActiveWorkItemInfosCountDeep,
-													&count);
+				void				updateCountsDeep(SInt32 idleDelta, SInt32 activeDelta)
+										{
+											// Update our counts
+											mIdleWorkItemInfosCountDeep += (UInt32) idleDelta;
+											mActiveWorkItemInfosCountDeep += (UInt32) activeDelta;
+											mIsNextWorkItemInfoValid = false;
+
+											// Check if have target
+											if (mTargetWorkItemQueueInternals.hasReference())
+												// Update target counts
+												mTargetWorkItemQueueInternals->updateCountsDeep(idleDelta,
+														activeDelta);
+										}
+				void				invalidateNextWorkItemInfoDeep()
+										{
+											// Invalidate ours
+											mIsNextWorkItemInfoValid = false;
 
-											return count;
+											// Check if have target
+											if (mTargetWorkItemQueueInternals.hasReference())
+												// Invalidate target
+												mTargetWorkItemQueueInternals->invalidateNextWorkItemInfoDeep();
 										}
 
 				OR<WorkItemInfo>	getNextWorkItemInfo()
@@ -253,42 +661,104 @@ class CWorkItemQueue::Internals {
 												// Paused
 												return OR<WorkItemInfo>();
 
-											// Check if have headroom
-											if (getActiveWorkItemInfosCountDeep() >= mMaximumConcurrentWorkItems)
+											// Check if have anything to do
+											if (mIdleWorkItemInfosCountDeep == 0)
+												// Nothing idle here or in any child work item queue
+												return OR<WorkItemInfo>();
+
+											// Check if have headroom.  The main work item queue also has the slots
+											//	lent by work items waiting inside wait() or waitUntilFinished().
+											UInt32	maximumConcurrentWorkItems = mMaximumConcurrentWorkItems;
+											if (!mTargetWorkItemQueueInternals.hasReference())
+												// Main work item queue
+												maximumConcurrentWorkItems += mLentSlotsCount;
+											if (mActiveWorkItemInfosCountDeep >= maximumConcurrentWorkItems)
 												// No more headroom
 												return OR<WorkItemInfo>();
 
-											// Get our next work item info
+											// Check if nothing here or below has changed since last time.  Dispatch
+											//	is serialized by mWorkItemThreadsLock, so only the valid flag can change
+											//	under us.  It is set before looking so any change made while looking
+											//	clears it again.  This way a dispatch only revisits the work item queues
+											//	along the path of the last change and their direct children.
+											if (mIsNextWorkItemInfoValid.exchange(true))
+												// Unchanged
+												return mNextWorkItemInfo;
+
+											// Get our next work item info.  Each list is in index order, so the
+											//	first item of the highest priority non-empty list is our next.
+											OR<WorkItemInfo>	workItemInfo;
 											mWorkItemInfosLock.lock();
-											mIdleWorkItemInfos.sort(workItemInfoCompare);
-											OR<WorkItemInfo>	workItemInfo =
-																		!mIdleWorkItemInfos.isEmpty() ?
-																				OR<WorkItemInfo>(
-																						mIdleWorkItemInfos[0]) :
-																				OR<WorkItemInfo>();
+											for (UInt32 i = kPriorityCount; i > 0; i--) {
+												// Check list
+												if (!mIdleWorkItemInfos[i - 1].isEmpty()) {
+													// Found
+													workItemInfo =
+															OR<WorkItemInfo>(*mIdleWorkItemInfos[i - 1].getFirst());
+													break;
+												}
+											}
 											mWorkItemInfosLock.unlock();
 
 											// Check any child work item queues
-											mChildWorkItemQueueInternals.apply(
-													(TNLockingArray<R<Internals> >::ApplyProc) getNextWorkItemInfo,
-													&workItemInfo);
+											mChildWorkItemQueueInternals.apply(getNextWorkItemInfo, &workItemInfo);
+											mNextWorkItemInfo = workItemInfo;
 
 											return workItemInfo;
 										}
+				bool				isPausedDeep() const
+										{ return mIsPaused ||
+												(mTargetWorkItemQueueInternals.hasReference() &&
+														mTargetWorkItemQueueInternals->isPausedDeep()); }
+
+				bool				moveScheduledToActive(WorkItemInfo& workItemInfo)
+										{
+											// Update info
+											mWorkItemInfosLock.lock();
+											mScheduledWorkItemInfos.remove(workItemInfo);
+
+											// Check if paused since scheduled.  Cancelled work items still go
+											//	through so they are dropped right away.
+											if (isPausedDeep() && !workItemInfo.isCancelled()) {
+												// Move to idle for dispatch upon resume
+												workItemInfo.mIndex = WorkItemInfo::mNextIndex++;
+												mIdleWorkItemInfos[workItemInfo.mPriority].add(workItemInfo);
+												mWorkItemInfosLock.unlock();
+												updateCountsDeep(1, 0);
+
+												return false;
+											}
+
+											// Move to active
+											mActiveWorkItemInfos.add(workItemInfo);
+											mWorkItemInfosLock.unlock();
+											updateCountsDeep(0, 1);
+
+											return true;
+										}
 				void				moveToActive(WorkItemInfo& workItemInfo)
 										{
 											// Move from idle to active
 											mWorkItemInfosLock.lock();
-											mIdleWorkItemInfos.move(workItemInfo, mActiveWorkItemInfos);
+											mIdleWorkItemInfos[workItemInfo.mPriority].remove(workItemInfo);
+											mActiveWorkItemInfos.add(workItemInfo);
 											mWorkItemInfosLock.unlock();
+
+											// Update counts
+											updateCountsDeep(-1, 1);
 										}
 				void				removeFromActive(WorkItemInfo& workItemInfo)
 										{
+											// Update counts
+											updateCountsDeep(0, -1);
+
 											// Update info
 											mWorkItemInfosLock.lock();
 
 											// Remove from active
-											mActiveWorkItemInfos -= workItemInfo;
+											WorkItemInfo*	workItemInfoToDelete = &workItemInfo;
+											mActiveWorkItemInfos.remove(*workItemInfoToDelete);
+											Delete(workItemInfoToDelete);
 
 											// Update
 											if (mItemsProgress.hasReference())
@@ -305,19 +775,57 @@ class CWorkItemQueue::Internals {
 				void				checkEmpty()
 										{
 											// Check if no in-flight work items
-											if (*mInFlightWorkItemsCount == 0)
+											if (*mInFlightWorkItemsCount == 0) {
+												// Wake anyone waiting
+												for (TArray<R<CSemaphore> >::Iterator iterator =
+																mEmptySemaphores.getIterator();
+														iterator; iterator++)
+													// Signal
+													(*iterator)->signal();
+
 												// Empty
 												mWorkItemQueue.noteEmpty();
+											}
 										}
 
 		static	void				processWorkItems()
 										{
+											// Check scheduler mode
+											if (mSchedulerMode == kSchedulerModeWorkStealing) {
+												// Check if have anything waiting for dispatch
+												if (mMainWorkItemQueueInternals->mIdleWorkItemInfosCountDeep == 0)
+													// Nothing to do
+													return;
+
+												// Admit as many work items as limits allow
+												mWorkItemThreadsLock.lock();
+												while (true) {
+													// Get next work item info
+													OR<WorkItemInfo>	workItemInfo =
+																				mMainWorkItemQueueInternals->
+																						getNextWorkItemInfo();
+													if (!workItemInfo.hasReference())
+														// No more work items
+														break;
+
+													// Move from idle to active and hand to the pool
+													workItemInfo->mOwningWorkItemQueueInternals.moveToActive(
+															*workItemInfo);
+													workItemInfo->mIsAdmitted = true;
+													schedule(*workItemInfo, false);
+												}
+												mWorkItemThreadsLock.unlock();
+
+												return;
+											}
+
 											// Check if can do another workItem
 											mWorkItemThreadsLock.lock();
 
 											// Continue until we run out of threads
-											while (mActiveWorkItemThreads.getCount() <
-													mMainWorkItemQueueInternals->mMaximumConcurrentWorkItems) {
+											while (mActiveWorkItemThreadsCount <
+													(mMainWorkItemQueueInternals->mMaximumConcurrentWorkItems +
+															mLentSlotsCount)) {
 												// Get next work item info
 												OR<WorkItemInfo>	workItemInfo =
 																			mMainWorkItemQueueInternals->
@@ -330,27 +838,23 @@ class CWorkItemQueue::Internals {
 												workItemInfo->mOwningWorkItemQueueInternals.moveToActive(*workItemInfo);
 
 												// Find thread
-												if (mIdleWorkItemThreads.getCount() > 0) {
+												WorkItemThread*	workItemThread = mFirstIdleWorkItemThread;
+												if (workItemThread != nil)
 													// Resume an idle thread
-													I<WorkItemThread>&	workItemThread = mIdleWorkItemThreads[0];
-													mIdleWorkItemThreads.move(workItemThread, mActiveWorkItemThreads);
-
-													// Process work item info
-													workItemThread->process(R<WorkItemInfo>(*workItemInfo));
-												} else {
-													// Create new active thread
-													UInt32	threadNumber = mActiveWorkItemThreads.getCount() + 1;
+													mFirstIdleWorkItemThread = workItemThread->mNextIdleWorkItemThread;
+												else {
+													// Create new thread.  Work item threads wait on their semaphores
+													//	for the life of the process, so they are never deleted.
 													CString	threadName =
 																	CString(OSSTR("CWorkItemQueue #")) +
-																			CString(threadNumber);
-													I<WorkItemThread>	workItemThread(
-																				new WorkItemThread(threadName,
-																						workItemInfoComplete));
-													mActiveWorkItemThreads += workItemThread;
-
-													// Process work item info
-													workItemThread->process(R<WorkItemInfo>(*workItemInfo));
+																			CString(mActiveWorkItemThreadsCount + 1);
+													workItemThread = new WorkItemThread(threadName,
+															workItemInfoComplete);
 												}
+												mActiveWorkItemThreadsCount++;
+
+												// Process work item info
+												workItemThread->process(*workItemInfo);
 
 												// Get next work item info
 												workItemInfo = mMainWorkItemQueueInternals->getNextWorkItemInfo();
@@ -358,22 +862,68 @@ class CWorkItemQueue::Internals {
 											mWorkItemThreadsLock.unlock();
 										}
 
-		static	bool				workItemMatches(const I<WorkItemInfo>& workItemInfo, I<CWorkItem>* workItem)
-										{ return workItemInfo->mWorkItem == *workItem; }
-		static	bool				workItemInfoHasID(const WorkItemInfo& workItemInfo, TSet<CString>* workItemIDs)
-										{ return workItemIDs->contains(workItemInfo.mWorkItem->getID()); }
-		static	bool				workItemInfoHasReference(const WorkItemInfo& workItemInfo,
-											TSet<CString>* workitemReferences)
-										{ return workItemInfo.mWorkItem->getReference().hasValue() &&
-												workitemReferences->contains(*workItemInfo.mWorkItem->getReference()); }
+		static	void				setSchedulerMode(SchedulerMode schedulerMode)
+										{
+											// Check if changing
+											mWorkItemThreadsLock.lock();
+											if (schedulerMode != mSchedulerMode) {
+												// Must switch before anything has been dispatched
+												AssertFailIf((mActiveWorkItemThreadsCount > 0) ||
+														(mFirstIdleWorkItemThread != nil) ||
+														!mWorkStealingThreads.isEmpty());
+
+												// Check scheduler mode
+												if (schedulerMode == kSchedulerModeWorkStealing) {
+													// Create threads
+													UInt32	count =
+																	mMainWorkItemQueueInternals->
+																			mMaximumConcurrentWorkItems;
+													for (UInt32 i = 0; i < count; i++)
+														// Create thread
+														mWorkStealingThreads +=
+																I<WorkStealingThread>(
+																		new WorkStealingThread(
+																				CString(OSSTR("CWorkItemQueue #")) +
+																						CString(i + 1),
+																				i, runWorkStealingThread));
+
+													// Start threads once all exist since each one looks at the others
+													for (TArray<I<WorkStealingThread> >::Iterator iterator =
+																	mWorkStealingThreads.getIterator();
+															iterator; iterator++)
+														// Start
+														(*iterator)->start();
+												}
+
+												// Store
+												mSchedulerMode = schedulerMode;
+											}
+											mWorkItemThreadsLock.unlock();
+										}
+
+		static	bool				workItemMatches(const WorkItemInfo& workItemInfo, void* userData)
+										{ return workItemInfo.getWorkItem().hasReference() &&
+												(&(*workItemInfo.getWorkItem()) ==
+														&(**((const I<CWorkItem>*) userData))); }
+		static	bool				workItemInfoHasID(const WorkItemInfo& workItemInfo, void* userData)
+										{ return workItemInfo.getWorkItem().hasReference() &&
+												((const TSet<CString>*) userData)->contains(
+														workItemInfo.getWorkItem()->getID()); }
+		static	bool				workItemInfoHasReference(const WorkItemInfo& workItemInfo, void* userData)
+										{ return workItemInfo.getWorkItem().hasReference() &&
+												workItemInfo.getWorkItem()->getReference().hasValue() &&
+												((const TSet<CString>*) userData)->contains(
+														*workItemInfo.getWorkItem()->getReference()); }
 		static	bool				workItemInfoAlwaysMatches(const WorkItemInfo& workItemInfo, void* userData)
-										{ return true; }
+										{
+											// Everything matches
+											(void) workItemInfo;
+											(void) userData;
+
+											return true;
+										}
 
 	private:
-		static	void				getActiveWorkItemInfosCountDeep(R<Internals>& workItemQueueInternals,
-											void* userData)
-										{ *((UInt32*) userData) +=
-												workItemQueueInternals->getActiveWorkItemInfosCountDeep(); }
 		static	void				getNextWorkItemInfo(R<Internals>& workItemQueueInternals, void* userData)
 										{
 											// Setup
@@ -393,45 +943,388 @@ class CWorkItemQueue::Internals {
 												workItemInfo = childWorkItemInfo;
 										}
 
-		static	bool				workItemInfoCompare(const WorkItemInfo& workItemInfo1,
-											const WorkItemInfo& workItemInfo2, void* userData)
-										{
-											// Sort in this order:
-											//	Priority
-											//	Index
-											if (workItemInfo1.mPriority > workItemInfo2.mPriority)
-												// Work item 1 has a higher priority
-												return true;
-											else if (workItemInfo1.mPriority < workItemInfo2.mPriority)
-												// Work item 2 has a higher priority
-												return false;
-											else
-												// Use index
-												return workItemInfo1.mIndex < workItemInfo2.mIndex;
-										}
-		static	void				workItemInfoComplete(const R<WorkItemInfo>& workItemInfo,
+		static	void				workItemInfoComplete(WorkItemInfo& workItemInfo,
 											WorkItemThread& workItemThread)
 										{
 											// Transition work item info to complete
-											workItemInfo->mOwningWorkItemQueueInternals.removeFromActive(*workItemInfo);
+											workItemInfo.mOwningWorkItemQueueInternals.removeFromActive(workItemInfo);
 
 											// Transition thread to idle
 											mWorkItemThreadsLock.lock();
-											I<WorkItemThread>&	workItemThreadInstance =
-																		*mActiveWorkItemThreads.getFirst(
-																				(TArray<I<WorkItemThread> >::
-																								IsMatchProc)
-																						I<WorkItemThread>::
-																								doesInstanceMatch,
-																				&workItemThread);
-											mActiveWorkItemThreads.move(workItemThreadInstance, mIdleWorkItemThreads);
+											workItemThread.mNextIdleWorkItemThread = mFirstIdleWorkItemThread;
+											mFirstIdleWorkItemThread = &workItemThread;
+											mActiveWorkItemThreadsCount--;
+											mWorkItemThreadsLock.unlock();
+
+											// Process work items
+											processWorkItems();
+										}
+
+		static	void				schedule(WorkItemInfo& workItemInfo, bool preferCurrentThread)
+										{
+											// Check if can use the current thread's deque
+											WorkStealingThread*	workStealingThread = mCurrentWorkStealingThread;
+											if (preferCurrentThread && (workStealingThread != nil))
+												// Push onto our own deque
+												workStealingThread->mWorkItemInfos[workItemInfo.mPriority].push(
+														&workItemInfo);
+											else {
+												// Add to injection queue
+												WorkItemInfo*&	lastInjectedWorkItemInfo =
+																		mLastInjectedWorkItemInfos[
+																				workItemInfo.mPriority];
+												mInjectedWorkItemInfosLock.lock();
+												if (lastInjectedWorkItemInfo != nil)
+													// Append
+													lastInjectedWorkItemInfo->mNextInjectedWorkItemInfo =
+															&workItemInfo;
+												else
+													// Empty
+													mFirstInjectedWorkItemInfos[workItemInfo.mPriority] =
+															&workItemInfo;
+												lastInjectedWorkItemInfo = &workItemInfo;
+												mInjectedWorkItemInfosCount++;
+												mInjectedWorkItemInfosLock.unlock();
+											}
+
+											// Wake a sleeping thread if there is one.  The fence pairs with the one
+											//	in runWorkStealingThread() so either we see it sleeping or it sees
+											//	this work item.
+											std::atomic_thread_fence(std::memory_order_seq_cst);
+											if (mSleepingWorkStealingThreadsCount.load() == 0)
+												// None sleeping
+												return;
+											for (TArray<I<WorkStealingThread> >::Iterator iterator =
+															mWorkStealingThreads.getIterator();
+													iterator; iterator++) {
+												// Try to claim this thread for waking
+												bool	isSleeping = true;
+												if ((*iterator)->mIsSleeping.compare_exchange_strong(isSleeping,
+														false)) {
+													// Wake
+													mSleepingWorkStealingThreadsCount--;
+													(*iterator)->mSemaphore.signal();
+													break;
+												}
+											}
+										}
+		static	WorkItemInfo*		getNextScheduledWorkItemInfo(WorkStealingThread* workStealingThread)
+										{
+											// Setup.  Threads outside the pool have no deque of their own.
+											UInt32	count = mWorkStealingThreads.getCount();
+											UInt32	index =
+															(workStealingThread != nil) ?
+																	workStealingThread->mIndex : 0;
+											UInt32	firstOffset = (workStealingThread != nil) ? 1 : 0;
+
+											// Look in priority order
+											for (UInt32 priority = kPriorityCount; priority > 0; priority--) {
+												// Check our own deque first
+												WorkItemInfo*	workItemInfo =
+																		(workStealingThread != nil) ?
+																				workStealingThread->mWorkItemInfos[
+																						priority - 1].pop() :
+																				nil;
+												if (workItemInfo != nil)
+													// Found
+													return workItemInfo;
+
+												// Check the injection queue
+												if (mInjectedWorkItemInfosCount > 0) {
+													// Take first
+													mInjectedWorkItemInfosLock.lock();
+													workItemInfo = mFirstInjectedWorkItemInfos[priority - 1];
+													if (workItemInfo != nil) {
+														// Unlink
+														mFirstInjectedWorkItemInfos[priority - 1] =
+																workItemInfo->mNextInjectedWorkItemInfo;
+														if (mFirstInjectedWorkItemInfos[priority - 1] == nil)
+															// Now empty
+															mLastInjectedWorkItemInfos[priority - 1] = nil;
+														workItemInfo->mNextInjectedWorkItemInfo = nil;
+														mInjectedWorkItemInfosCount--;
+													}
+													mInjectedWorkItemInfosLock.unlock();
+													if (workItemInfo != nil)
+														// Found
+														return workItemInfo;
+												}
+
+												// Try to steal, starting with the next thread over
+												for (UInt32 i = firstOffset; i < count; i++) {
+													// Steal
+													workItemInfo =
+															mWorkStealingThreads[(index + i) % count]->
+																	mWorkItemInfos[priority - 1].steal();
+													if (workItemInfo != nil)
+														// Found
+														return workItemInfo;
+												}
+											}
+
+											return nil;
+										}
+		static	void				performScheduled(WorkItemInfo& workItemInfo)
+										{
+											// Setup
+											Internals&	internals = workItemInfo.mOwningWorkItemQueueInternals;
+
+											// Check if was admitted through dispatch
+											if (!workItemInfo.mIsAdmitted &&
+													!internals.moveScheduledToActive(workItemInfo))
+												// Paused since it was scheduled.  It will be dispatched on resume.
+												return;
+
+											// Check if cancelled while waiting
+											if (!workItemInfo.isCancelled()) {
+												// Perform
+												workItemInfo.transitionTo(CWorkItem::kStateActive);
+												workItemInfo.perform();
+												workItemInfo.transitionTo(CWorkItem::kStateCompleted);
+											} else
+												// Drop
+												workItemInfo.drop();
+
+											// Done
+											internals.removeFromActive(workItemInfo);
+
+											// Admit any work items now within limits
+											processWorkItems();
+										}
+		static	void				runWorkStealingThread(WorkStealingThread& workStealingThread)
+										{
+											// Setup
+											mCurrentWorkStealingThread = &workStealingThread;
+
+											// Run forever
+											while (true) {
+												// Get next work item info
+												WorkItemInfo*	workItemInfo =
+																		getNextScheduledWorkItemInfo(
+																				&workStealingThread);
+												if (workItemInfo != nil) {
+													// Perform
+													performScheduled(*workItemInfo);
+													continue;
+												}
+
+												// Note sleeping, then check once more so work scheduled in the
+												//	meantime is not missed
+												workStealingThread.mIsSleeping = true;
+												mSleepingWorkStealingThreadsCount++;
+												std::atomic_thread_fence(std::memory_order_seq_cst);
+												workItemInfo = getNextScheduledWorkItemInfo(&workStealingThread);
+												if (workItemInfo == nil)
+													// Wait
+													workStealingThread.mSemaphore.waitFor();
+
+												// Note no longer sleeping unless whoever woke us already did
+												bool	isSleeping = true;
+												if (workStealingThread.mIsSleeping.compare_exchange_strong(isSleeping,
+														false))
+													// Still marked
+													mSleepingWorkStealingThreadsCount--;
+
+												// Check if have work item info
+												if (workItemInfo != nil)
+													// Perform
+													performScheduled(*workItemInfo);
+											}
+										}
+
+	public:
+		static	void				waitUntilFinished(const I<CWorkItem>& workItem)
+										{
+											// Check if already finished
+											if (workItem->isFinished())
+												// Nothing to wait for
+												return;
+
+											// Check if work stealing thread
+											WorkStealingThread*	workStealingThread = mCurrentWorkStealingThread;
+											if (workStealingThread != nil) {
+												// Wait on our own semaphore so newly scheduled work items wake us too.
+												//	Pool threads are never destroyed.
+												workItem->addFinishedProc(signalSemaphore,
+														&workStealingThread->mSemaphore);
+												helpUntil(isFinished, (void*) &workItem,
+														workStealingThread->mSemaphore);
+											} else {
+												// The finished proc may run after we have returned, so it holds its
+												//	own reference to the semaphore
+												I<CSemaphore>	semaphore(new CSemaphore());
+												workItem->addFinishedProc(signalSemaphoreInstance,
+														new I<CSemaphore>(semaphore));
+												helpUntil(isFinished, (void*) &workItem, *semaphore);
+											}
+										}
+
+	private:
+		static	void				dependencyFinished(CWorkItem& workItem, void* userData)
+										{
+											// Setup
+											WorkItemInfo*	workItemInfo = (WorkItemInfo*) userData;
+											(void) workItem;
+
+											// Check if was the last one
+											if (--workItemInfo->mPendingDependenciesCount > 0)
+												// Still waiting
+												return;
+
+											// No longer pending unless our work item queue has been deleted.  Holding
+											//	the lock keeps it from being deleted until we are back in flight there.
+											mPendingWorkItemInfosLock.lock();
+											bool	isOrphaned = workItemInfo->mIsOrphaned;
+											if (!isOrphaned) {
+												// Remove from pending
+												Internals&	internals = workItemInfo->mOwningWorkItemQueueInternals;
+												internals.mWorkItemInfosLock.lock();
+												internals.mPendingWorkItemInfos.remove(*workItemInfo);
+												internals.mWorkItemInfosLock.unlock();
+											}
+											mPendingWorkItemInfosLock.unlock();
+
+											// Check if orphaned
+											if (isOrphaned) {
+												// Drop
+												workItemInfo->drop();
+												Delete(workItemInfo);
+
+												return;
+											}
+
+											// Release
+											workItemInfo->mOwningWorkItemQueueInternals.release(*workItemInfo);
+
+											// Process work items
+											processWorkItems();
+										}
+
+		static	bool				performNext()
+										{
+											// Check scheduler mode
+											if (mSchedulerMode == kSchedulerModeWorkStealing) {
+												// Take next scheduled work item info
+												WorkItemInfo*	workItemInfo =
+																		getNextScheduledWorkItemInfo(
+																				mCurrentWorkStealingThread);
+												if (workItemInfo == nil)
+													// Nothing to take
+													return false;
+
+												// Perform
+												performScheduled(*workItemInfo);
+
+												return true;
+											}
+
+											// Take next work item info if within limits
+											mWorkItemThreadsLock.lock();
+											OR<WorkItemInfo>	workItemInfo =
+																		mMainWorkItemQueueInternals->
+																				getNextWorkItemInfo();
+											if (workItemInfo.hasReference())
+												// Move from idle to active
+												workItemInfo->mOwningWorkItemQueueInternals.moveToActive(
+														*workItemInfo);
 											mWorkItemThreadsLock.unlock();
+											if (!workItemInfo.hasReference())
+												// Nothing to take
+												return false;
+
+											// Perform
+											workItemInfo->transitionTo(CWorkItem::kStateActive);
+											workItemInfo->perform();
+											workItemInfo->transitionTo(CWorkItem::kStateCompleted);
+
+											// Done
+											workItemInfo->mOwningWorkItemQueueInternals.removeFromActive(
+													*workItemInfo);
 
 											// Process work items
 											processWorkItems();
+
+											return true;
+										}
+		static	void				helpUntil(IsDoneProc isDoneProc, void* userData, CSemaphore& semaphore)
+										{
+											// Setup
+											WorkStealingThread*	workStealingThread = mCurrentWorkStealingThread;
+											bool				isLendingSlot =
+																		WorkItemInfo::mCurrentPerformDepth > 0;
+
+											// Check if waiting inside a work item
+											if (isLendingSlot) {
+												// Lend its slot so what we are waiting on can be dispatched
+												mLentSlotsCount++;
+												processWorkItems();
+											}
+
+											// Perform other work items until done
+											while (!isDoneProc(userData)) {
+												// Try to perform one
+												if (performNext())
+													// Check again
+													continue;
+
+												// Check if work stealing thread
+												if (workStealingThread != nil) {
+													// Note sleeping so newly scheduled work items wake us too, then
+													//	check once more
+													workStealingThread->mIsSleeping = true;
+													mSleepingWorkStealingThreadsCount++;
+													std::atomic_thread_fence(std::memory_order_seq_cst);
+													WorkItemInfo*	workItemInfo =
+																			getNextScheduledWorkItemInfo(
+																					workStealingThread);
+													if ((workItemInfo == nil) && !isDoneProc(userData))
+														// Wait
+														semaphore.waitFor();
+
+													// Note no longer sleeping unless whoever woke us already did
+													bool	isSleeping = true;
+													if (workStealingThread->mIsSleeping.compare_exchange_strong(
+															isSleeping, false))
+														// Still marked
+														mSleepingWorkStealingThreadsCount--;
+
+													// Check if have work item info
+													if (workItemInfo != nil)
+														// Perform
+														performScheduled(*workItemInfo);
+												} else
+													// Wait
+													semaphore.waitFor();
+											}
+
+											// Check if lent slot
+											if (isLendingSlot)
+												// Take it back
+												mLentSlotsCount--;
+										}
+
+		static	bool				isEmpty(void* userData)
+										{ return *((Internals*) userData)->mInFlightWorkItemsCount == 0; }
+		static	bool				isFinished(void* userData)
+										{ return (*((const I<CWorkItem>*) userData))->isFinished(); }
+		static	void				signalSemaphore(CWorkItem& workItem, void* userData)
+										{
+											// Signal
+											(void) workItem;
+											((CSemaphore*) userData)->signal();
+										}
+		static	void				signalSemaphoreInstance(CWorkItem& workItem, void* userData)
+										{
+											// Signal and release our reference
+											I<CSemaphore>*	semaphore = (I<CSemaphore>*) userData;
+											(void) workItem;
+											(*semaphore)->signal();
+											Delete(semaphore);
 										}
 
 	public:
+		static	const	UInt32					kPriorityCount = CWorkItem::kPriorityHigh + 1;
+
 		static	OR<Internals>					mMainWorkItemQueueInternals;
 				TLockingNumeric<UInt32>			mInFlightWorkItemsCount;
 
@@ -446,20 +1339,56 @@ class CWorkItemQueue::Internals {
 
 				TNLockingArray<R<Internals> >	mChildWorkItemQueueInternals;
 
-				TNArray<WorkItemInfo>			mActiveWorkItemInfos;
-				TNArray<WorkItemInfo>			mIdleWorkItemInfos;
-				CLock							mWorkItemInfosLock;
+				bool							mIsConstrainedDeep;
 
-		static	TNArray<I<WorkItemThread> >		mActiveWorkItemThreads;
-		static	TNArray<I<WorkItemThread> >		mIdleWorkItemThreads;
+				WorkItemInfo::List				mActiveWorkItemInfos;
+				WorkItemInfo::List				mScheduledWorkItemInfos;
+				WorkItemInfo::List				mPendingWorkItemInfos;
+				WorkItemInfo::List				mIdleWorkItemInfos[kPriorityCount];
+				CLock							mWorkItemInfosLock;
+				std::atomic<UInt32>				mIdleWorkItemInfosCountDeep;
+				std::atomic<UInt32>				mActiveWorkItemInfosCountDeep;
+				std::atomic<bool>				mIsNextWorkItemInfoValid;
+				OR<WorkItemInfo>				mNextWorkItemInfo;
+				TNArray<R<CSemaphore> >			mEmptySemaphores;
+
+		static	WorkItemThread*					mFirstIdleWorkItemThread;
+		static	UInt32							mActiveWorkItemThreadsCount;
 		static	CLock							mWorkItemThreadsLock;
+		static	CLock							mPendingWorkItemInfosLock;
+		static	std::atomic<UInt32>				mLentSlotsCount;
+
+		static	SchedulerMode					mSchedulerMode;
+		static	TNArray<I<WorkStealingThread> >&	mWorkStealingThreads;
+		static	WorkItemInfo*					mFirstInjectedWorkItemInfos[kPriorityCount];
+		static	WorkItemInfo*					mLastInjectedWorkItemInfos[kPriorityCount];
+		static	CLock							mInjectedWorkItemInfosLock;
+		static	std::atomic<UInt32>				mInjectedWorkItemInfosCount;
+		static	std::atomic<UInt32>				mSleepingWorkStealingThreadsCount;
+		static	thread_local	WorkStealingThread*	mCurrentWorkStealingThread;
 };
 
 OR<CWorkItemQueue::Internals>				CWorkItemQueue::Internals::mMainWorkItemQueueInternals;
 
-TNArray<I<CWorkItemQueue::WorkItemThread> >	CWorkItemQueue::Internals::mActiveWorkItemThreads;
-TNArray<I<CWorkItemQueue::WorkItemThread> >	CWorkItemQueue::Internals::mIdleWorkItemThreads;
+CWorkItemQueue::WorkItemThread*				CWorkItemQueue::Internals::mFirstIdleWorkItemThread = nil;
+UInt32										CWorkItemQueue::Internals::mActiveWorkItemThreadsCount = 0;
 CLock										CWorkItemQueue::Internals::mWorkItemThreadsLock;
+CLock										CWorkItemQueue::Internals::mPendingWorkItemInfosLock;
+std::atomic<UInt32>							CWorkItemQueue::Internals::mLentSlotsCount(0);
+
+CWorkItemQueue::SchedulerMode				CWorkItemQueue::Internals::mSchedulerMode =
+													CWorkItemQueue::kSchedulerModeShared;
+// The pool threads run for the life of the process, so never tear them down during static destruction
+TNArray<I<CWorkItemQueue::WorkStealingThread> >&	CWorkItemQueue::Internals::mWorkStealingThreads =
+															*new TNArray<I<CWorkItemQueue::WorkStealingThread> >();
+CWorkItemQueue::WorkItemInfo*				CWorkItemQueue::Internals::mFirstInjectedWorkItemInfos[kPriorityCount] =
+													{nil};
+CWorkItemQueue::WorkItemInfo*				CWorkItemQueue::Internals::mLastInjectedWorkItemInfos[kPriorityCount] =
+													{nil};
+CLock										CWorkItemQueue::Internals::mInjectedWorkItemInfosLock;
+std::atomic<UInt32>							CWorkItemQueue::Internals::mInjectedWorkItemInfosCount(0);
+std::atomic<UInt32>							CWorkItemQueue::Internals::mSleepingWorkStealingThreadsCount(0);
+thread_local	CWorkItemQueue::WorkStealingThread*	CWorkItemQueue::Internals::mCurrentWorkStealingThread = nil;
 
 //----------------------------------------------------------------------------------------------------------------------
 //----------------------------------------------------------------------------------------------------------------------
@@ -487,6 +1416,25 @@ CWorkItemQueue& CWorkItemQueue::main()
 	return *sMainWorkItemQueue;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+void CWorkItemQueue::setSchedulerMode(SchedulerMode schedulerMode)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Ensure main work item queue exists as it determines the thread count
+	main();
+
+	// Set
+	Internals::setSchedulerMode(schedulerMode);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void CWorkItemQueue::waitUntilFinished(const I<CWorkItem>& workItem)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Wait
+	Internals::waitUntilFinished(workItem);
+}
+
 // MARK: Lifecycle methods
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -562,12 +1510,57 @@ I<CWorkItem> CWorkItemQueue::add(CWorkItem::Proc proc, void* userData, const OV<
 	return workItem;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+void CWorkItemQueue::add(const I<CWorkItem>& workItem, const TArray<I<CWorkItem> >& dependencies,
+		CWorkItem::Priority priority)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Add
+	mInternals->add(workItem, priority, dependencies);
+
+	// Process work items
+	Internals::processWorkItems();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+I<CWorkItem> CWorkItemQueue::add(CWorkItem::Proc proc, void* userData, const TArray<I<CWorkItem> >& dependencies,
+		const OV<CString>& reference, CWorkItem::Priority priority)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Setup
+	I<CWorkItem>	workItem(new CProcWorkItem(proc, userData, reference));
+
+	// Add
+	add(workItem, dependencies, priority);
+
+	return workItem;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+I<CWorkItem> CWorkItemQueue::then(const I<CWorkItem>& workItem, CWorkItem::Proc proc, void* userData,
+		const OV<CString>& reference, CWorkItem::Priority priority)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	return add(proc, userData, TNArray<I<CWorkItem> >(workItem), reference, priority);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void CWorkItemQueue::submit(SubmitProc submitProc, void* userData, CWorkItem::Priority priority)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Submit
+	mInternals->submit(submitProc, userData, priority);
+
+	// Process work items
+	Internals::processWorkItems();
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 void CWorkItemQueue::cancel(const I<CWorkItem>& workItem)
 //----------------------------------------------------------------------------------------------------------------------
 {
 	// Cancel
-	mInternals->cancel((TArray<WorkItemInfo>::IsMatchProc) Internals::workItemMatches, (void*) &workItem);
+	mInternals->cancel(Internals::workItemMatches, (void*) &workItem);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -577,7 +1570,7 @@ void CWorkItemQueue::cancel(const TSet<CString>& workItemIDs)
 	// Check if have any
 	if (!workItemIDs.isEmpty())
 		// Cancel
-		mInternals->cancel((TArray<WorkItemInfo>::IsMatchProc) Internals::workItemInfoHasID, (void*) &workItemIDs);
+		mInternals->cancel(Internals::workItemInfoHasID, (void*) &workItemIDs);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -587,8 +1580,7 @@ void CWorkItemQueue::cancelAll(const TSet<CString>& workItemReferences)
 	// Check if have any
 	if (!workItemReferences.isEmpty())
 		// Cancel
-		mInternals->cancel((TArray<WorkItemInfo>::IsMatchProc) Internals::workItemInfoHasReference,
-				(void*) &workItemReferences);
+		mInternals->cancel(Internals::workItemInfoHasReference, (void*) &workItemReferences);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -598,7 +1590,7 @@ void CWorkItemQueue::cancelAll()
 	// Check if have any
 	if (*mInternals->mInFlightWorkItemsCount > 0)
 		// Cancel
-		mInternals->cancel((TArray<WorkItemInfo>::IsMatchProc) Internals::workItemInfoAlwaysMatches, nil);
+		mInternals->cancel(Internals::workItemInfoAlwaysMatches, nil);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
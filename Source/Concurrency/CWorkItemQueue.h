@@ -66,6 +66,49 @@
 		will perform the Work Item created first.
 
 
+	Scheduler Mode
+
+	By default, the Main Work Item Queue hands one Work Item at a time to one thread under a single dispatch lock.
+		Calling setSchedulerMode(kSchedulerModeWorkStealing) before any Work Items are added switches to a fixed pool
+		of threads, each with its own per-priority deques, plus a shared injection queue for Work Items added from
+		other threads.  A Work Item added from a pool thread is pushed onto that thread's own deque and idle threads
+		steal from busy ones.  This applies when its Work Item Queue and every target up the chain allow at least as
+		many concurrent Work Items as the Main Work Item Queue.  Work Items in more limited Work Item Queues still go
+		through the regular dispatch, which then injects each admitted Work Item.  Pause and cancel are checked again
+		when a Work Item is taken.  Priority is honored as each thread looks for work in priority order.  Creation
+		order is only strict for Work Items that go through the regular dispatch.
+
+
+	Dependencies and Waiting
+
+	A Work Item can be added along with other Work Items it depends on.  It is held aside, still counting as in flight
+		for wait(), until every dependency has finished and is then queued as usual.  A dependency has finished once
+		it has been performed or, if cancelled, dropped from its Work Item Queue, so a cancelled dependency does not
+		prevent its dependents from running.  Dependencies may be in any Work Item Queue but must not form a cycle.
+		A Work Item dropped this way gets no completed() or cancelled() call, while one cancelled after becoming
+		active still completes as usual.
+		then() is shorthand for adding a Work Item that depends on a single other Work Item.
+	Deleting a Work Item Queue cancels its Work Items and waits for any already being performed.  Work Items still
+		waiting on dependencies are not waited for and are dropped once their dependencies have finished.
+	wait() and waitUntilFinished() do not simply block.  While waiting, the calling thread performs other pending Work
+		Items (respecting all limits) and only blocks once there is nothing it can take.  When called from within a
+		Work Item, the Work Item being performed lends its slot to the Main Work Item Queue for the duration so that
+		the Work Items being waited on can be dispatched even when every thread is waiting.  Waiting on a Work Item
+		that can only run after the caller's own Work Item finishes (e.g. in the same serial Work Item Queue) will
+		never return.
+	TWorkItemFuture wraps a Work Item that produces a value.
+
+
+	Lightweight Work Items
+
+	submit() adds a proc as a Work Item without creating a Work Item object.  The Work Item Queue keeps a single small
+		record for it, taken from the per-thread slab allocator, so submitting is cheap enough for very fine-grained
+		work.  In exchange, there is nothing to hold on to: no ID, no reference, no state callbacks, no dependencies
+		and no way to cancel it alone.  It still counts for wait(), progress and all concurrency limits, and pause(),
+		resume() and cancelAll() apply to it as usual.
+	Work Items created without an ID do not generate one until getID() is first called.
+
+
 	maximumConcurrentWorkItems
 		 Positive numbers indicate desired concurrency.  i.e. 2 means max concurrency of 2.
 		 Negative numbers indicate processor cores to not request.  i.e. -2 means max concurrency of total processor
@@ -77,11 +120,25 @@
 // MARK: CWorkItemQueue
 
 class CWorkItemQueue {
+	// Enums
+	public:
+		enum SchedulerMode {
+			kSchedulerModeShared,
+			kSchedulerModeWorkStealing,
+		};
+
+	// Procs
+	public:
+		typedef	void	(*SubmitProc)(void* userData);
+
 	// Classes
 	private:
 		class Internals;
 		class WorkItemInfo;
+		class InstanceWorkItemInfo;
+		class ProcWorkItemInfo;
 		class WorkItemThread;
+		class WorkStealingThread;
 
 	// Methods
 	public:
@@ -98,6 +155,16 @@ class CWorkItemQueue {
 										CWorkItem::Priority priority = CWorkItem::kPriorityNormal);
 				I<CWorkItem>	add(CWorkItem::Proc proc, void* userData, const OV<CString>& reference = OV<CString>(),
 										CWorkItem::Priority priority = CWorkItem::kPriorityNormal);
+				void			add(const I<CWorkItem>& workItem, const TArray<I<CWorkItem> >& dependencies,
+										CWorkItem::Priority priority = CWorkItem::kPriorityNormal);
+				I<CWorkItem>	add(CWorkItem::Proc proc, void* userData, const TArray<I<CWorkItem> >& dependencies,
+										const OV<CString>& reference = OV<CString>(),
+										CWorkItem::Priority priority = CWorkItem::kPriorityNormal);
+				I<CWorkItem>	then(const I<CWorkItem>& workItem, CWorkItem::Proc proc, void* userData,
+										const OV<CString>& reference = OV<CString>(),
+										CWorkItem::Priority priority = CWorkItem::kPriorityNormal);
+				void			submit(SubmitProc submitProc, void* userData,
+										CWorkItem::Priority priority = CWorkItem::kPriorityNormal);
 
 				void			cancel(const I<CWorkItem>& workItem);
 				void			cancel(const TSet<CString>& workItemIDs);
@@ -111,6 +178,8 @@ class CWorkItemQueue {
 
 								// Class methods
 		static	CWorkItemQueue&	main();
+		static	void			setSchedulerMode(SchedulerMode schedulerMode);
+		static	void			waitUntilFinished(const I<CWorkItem>& workItem);
 
 	protected:
 								// Subclass methods
@@ -121,3 +190,65 @@ class CWorkItemQueue {
 	private:
 		Internals*	mInternals;
 };
+
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - TWorkItemFuture
+
+template <typename T> class TWorkItemFuture {
+	// Procs
+	public:
+		typedef	T	(*ValueProc)(void* userData);
+
+	// ValueWorkItem
+	private:
+		class ValueWorkItem : public CWorkItem {
+			public:
+								// Lifecycle methods
+								ValueWorkItem(ValueProc valueProc, void* userData) :
+									CWorkItem(), mValueProc(valueProc), mUserData(userData)
+									{}
+
+								// CWorkItem methods
+						void	perform(const I<CWorkItem>& workItem)
+									{ mValue.setValue(mValueProc(mUserData)); }
+
+			// Properties
+			public:
+				OV<T>	mValue;
+
+			private:
+				ValueProc	mValueProc;
+				void*		mUserData;
+		};
+
+	// Methods
+	public:
+										// Lifecycle methods
+										TWorkItemFuture(CWorkItemQueue& workItemQueue, ValueProc valueProc,
+												void* userData = nil,
+												const TArray<I<CWorkItem> >& dependencies = TNArray<I<CWorkItem> >(),
+												CWorkItem::Priority priority = CWorkItem::kPriorityNormal) :
+											mValueWorkItem(new ValueWorkItem(valueProc, userData)),
+													mWorkItem(mValueWorkItem)
+											{ workItemQueue.add(mWorkItem, dependencies, priority); }
+
+										// Instance methods
+				const	I<CWorkItem>&	getWorkItem() const
+											{ return mWorkItem; }
+
+						bool			isReady() const
+											{ return mWorkItem->isFinished(); }
+				const	OV<T>&			wait() const
+											{
+												// Wait.  There is no value if the work item was cancelled before it
+												//	could be performed.
+												CWorkItemQueue::waitUntilFinished(mWorkItem);
+
+												return mValueWorkItem->mValue;
+											}
+
+	// Properties
+	private:
+		ValueWorkItem*	mValueWorkItem;
+		I<CWorkItem>	mWorkItem;
+};
@@ -0,0 +1,144 @@
+//----------------------------------------------------------------------------------------------------------------------
+//	TWorkStealingDeque.h			©2026 Stevo Brock	All rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include "PlatformDefinitions.h"
+
+#include <atomic>
+
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: TWorkStealingDeque
+//	TWorkStealingDeque is a Chase-Lev deque of item pointers.  A single owning thread pushes and pops at the bottom
+//		without locking, and any number of other threads steal from the top with a single compare-and-swap.  The
+//		buffer grows as needed.  Outgrown buffers may still be read by a concurrent steal() so they are kept until the
+//		deque is destroyed.
+
+template <typename T> class TWorkStealingDeque {
+	// Buffer
+	private:
+		struct Buffer {
+							// Lifecycle methods
+							Buffer(SInt64 capacity, Buffer* previousBuffer) :
+								mCapacity(capacity), mMask(capacity - 1), mItems(new std::atomic<T*>[capacity]),
+										mPreviousBuffer(previousBuffer)
+								{}
+							~Buffer()
+								{ DeleteArray(mItems); }
+
+							// Instance methods
+					T*		get(SInt64 index) const
+								{ return mItems[index & mMask].load(std::memory_order_relaxed); }
+					void	set(SInt64 index, T* item)
+								{ mItems[index & mMask].store(item, std::memory_order_relaxed); }
+
+			// Properties
+					SInt64				mCapacity;
+					SInt64				mMask;
+					std::atomic<T*>*	mItems;
+					Buffer*				mPreviousBuffer;
+		};
+
+	// Methods
+	public:
+					// Lifecycle methods
+					TWorkStealingDeque(UInt32 initialCapacity = 256) :
+						mTop(0), mBottom(0), mBuffer(new Buffer(initialCapacity, nil))
+						{}
+					~TWorkStealingDeque()
+						{
+							// Cleanup
+							Buffer*	buffer = mBuffer.load(std::memory_order_relaxed);
+							while (buffer != nil) {
+								// Delete and move to previous
+								Buffer*	previousBuffer = buffer->mPreviousBuffer;
+								Delete(buffer);
+								buffer = previousBuffer;
+							}
+						}
+
+					// Instance methods
+			bool	isEmpty() const
+						{ return mBottom.load(std::memory_order_relaxed) <= mTop.load(std::memory_order_relaxed); }
+
+			void	push(T* item)
+						{
+							// Owner only.  Grow if full.
+							SInt64	bottom = mBottom.load(std::memory_order_relaxed);
+							SInt64	top = mTop.load(std::memory_order_acquire);
+							Buffer*	buffer = mBuffer.load(std::memory_order_relaxed);
+							if ((bottom - top) > (buffer->mCapacity - 1)) {
+								// Grow
+								Buffer*	grownBuffer = new Buffer(buffer->mCapacity * 2, buffer);
+								for (SInt64 i = top; i < bottom; i++)
+									// Copy item
+									grownBuffer->set(i, buffer->get(i));
+								mBuffer.store(grownBuffer, std::memory_order_release);
+								buffer = grownBuffer;
+							}
+
+							// Store and publish
+							buffer->set(bottom, item);
+							std::atomic_thread_fence(std::memory_order_release);
+							mBottom.store(bottom + 1, std::memory_order_relaxed);
+						}
+			T*		pop()
+						{
+							// Owner only.  Reserve the bottom item.
+							SInt64	bottom = mBottom.load(std::memory_order_relaxed) - 1;
+							Buffer*	buffer = mBuffer.load(std::memory_order_relaxed);
+							mBottom.store(bottom, std::memory_order_relaxed);
+							std::atomic_thread_fence(std::memory_order_seq_cst);
+							SInt64	top = mTop.load(std::memory_order_relaxed);
+
+							// Check situation
+							if (top > bottom) {
+								// Empty
+								mBottom.store(bottom + 1, std::memory_order_relaxed);
+
+								return nil;
+							}
+
+							// Get item
+							T*	item = buffer->get(bottom);
+							if (top == bottom) {
+								// Last item, race against stealers for it
+								if (!mTop.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+										std::memory_order_relaxed))
+									// Lost
+									item = nil;
+								mBottom.store(bottom + 1, std::memory_order_relaxed);
+							}
+
+							return item;
+						}
+			T*		steal()
+						{
+							// Any thread
+							SInt64	top = mTop.load(std::memory_order_acquire);
+							std::atomic_thread_fence(std::memory_order_seq_cst);
+							SInt64	bottom = mBottom.load(std::memory_order_acquire);
+							if (top >= bottom)
+								// Empty
+								return nil;
+
+							// Get item and claim it
+							T*	item = mBuffer.load(std::memory_order_acquire)->get(top);
+
+							return mTop.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+											std::memory_order_relaxed) ?
+									item : nil;
+						}
+
+	private:
+					// Lifecycle methods
+					TWorkStealingDeque(const TWorkStealingDeque& other);
+					TWorkStealingDeque&	operator=(const TWorkStealingDeque& other);
+
+	// Properties
+	private:
+		std::atomic<SInt64>		mTop;
+		std::atomic<SInt64>		mBottom;
+		std::atomic<Buffer*>	mBuffer;
+};
@@ -5,7 +5,43 @@
 #include "CFileWriter.h"
 
 //----------------------------------------------------------------------------------------------------------------------
-// MARK: CFileWriter
+// MARK: Local data
+
+struct SWriteBase64Info {
+			// Lifecycle methods
+			SWriteBase64Info(const CFileWriter& fileWriter) : mFileWriter(fileWriter) {}
+
+	// Properties
+	const	CFileWriter&	mFileWriter;
+			OV<SError>		mError;
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - Local proc declarations
+
+static	void	sWriteBase64Characters(const char* characters, UInt32 characterCount, void* userData);
+
+//----------------------------------------------------------------------------------------------------------------------
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - CFileWriter
+
+// MARK: Instance methods
+
+//----------------------------------------------------------------------------------------------------------------------
+OV<SError> CFileWriter::writeBase64(const CData& data, bool prettyPrint) const
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Setup
+	SWriteBase64Info		writeBase64Info(*this);
+	CData::Base64Encoder	base64Encoder(sWriteBase64Characters, &writeBase64Info, prettyPrint);
+
+	// Encode straight to the file
+	base64Encoder.add(data);
+	base64Encoder.finish();
+
+	return writeBase64Info.mError;
+}
 
 // MARK: Class methods
 
@@ -26,3 +62,19 @@ OV<SError> CFileWriter::write(const CFile& file, const CData& data)
 
 	return fileWriter.close();
 }
+
+//----------------------------------------------------------------------------------------------------------------------
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - Local proc definitions
+
+//----------------------------------------------------------------------------------------------------------------------
+void sWriteBase64Characters(const char* characters, UInt32 characterCount, void* userData)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Setup
+	SWriteBase64Info&	writeBase64Info = *((SWriteBase64Info*) userData);
+
+	// Write unless already failed
+	if (!writeBase64Info.mError.hasValue())
+		writeBase64Info.mError = writeBase64Info.mFileWriter.write(characters, characterCount);
+}
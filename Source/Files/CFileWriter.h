@@ -43,6 +43,8 @@ class CFileWriter {
 						OV<SError>		write(const void* buffer, UInt64 byteCount) const;
 						OV<SError>		write(const CData& data) const
 											{ return write(*data.getUInt8Buffer(), data.getByteCount()); }
+						OV<SError>		write(const CData::Builder& dataBuilder) const;
+						OV<SError>		writeBase64(const CData& data, bool prettyPrint = false) const;
 						OV<SError>		write(const CString& string) const
 											{ return write(string.getUTF8Data()); }
 						OV<SError>		write(SInt8 value) const
@@ -383,7 +383,7 @@ SAudio::Format CAACAudioCodec::composeAudioFormat(const Info& info)
 //----------------------------------------------------------------------------------------------------------------------
 I<CDecodeAudioCodec> CAACAudioCodec::create(const Info& info,
 		const I<CRandomAccessDataSource>& randomAccessDataSource,
-		const TArray<SMedia::PacketAndLocation>& packetAndLocations)
+		const TVArray<SMedia::PacketAndLocation>& packetAndLocations)
 //----------------------------------------------------------------------------------------------------------------------
 {
 	return I<CDecodeAudioCodec>(
@@ -58,7 +58,7 @@ class CAACAudioCodec {
 		static	SAudio::Format			composeAudioFormat(const Info& info);
 		static	I<CDecodeAudioCodec>	create(const Info& info,
 												const I<CRandomAccessDataSource>& randomAccessDataSource,
-												const TArray<SMedia::PacketAndLocation>& packetAndLocations);
+												const TVArray<SMedia::PacketAndLocation>& packetAndLocations);
 
 	// Properties
 	public:
@@ -110,7 +110,8 @@ class CDecodeAudioCodec : public CAudioCodec {
 																				mCurrentPosition) / mFrameByteCount);
 														if (frameCount > 0) {
 															// Read frames
-															TBuffer<UInt8>	buffer(frameCount * mFrameByteCount);
+															TBuffer<UInt8>	buffer(frameCount * mFrameByteCount,
+																					TBuffer<UInt8>::kAllocationPooled);
 
 															OV<SError>	error =
 																				mRandomAccessDataSource->read(
@@ -181,7 +182,7 @@ class CDecodeAudioCodec : public CAudioCodec {
 				// Lifecycle methods
 				PacketSourceInfo(const SAudio::Format& audioFormat, UInt64 frameCount,
 						const I<CRandomAccessDataSource>& randomAccessDataSource,
-						const TArray<SMedia::PacketAndLocation>& mediaPacketAndLocations) :
+						const TVArray<SMedia::PacketAndLocation>& mediaPacketAndLocations) :
 					SourceInfo(audioFormat, frameCount),
 							mRandomAccessDataSource(randomAccessDataSource),
 							mMediaPacketAndLocations(mediaPacketAndLocations)
@@ -195,7 +196,7 @@ class CDecodeAudioCodec : public CAudioCodec {
 			// Properties
 			protected:
 				I<CRandomAccessDataSource>			mRandomAccessDataSource;
-				TArray<SMedia::PacketAndLocation>	mMediaPacketAndLocations;
+				TVArray<SMedia::PacketAndLocation>	mMediaPacketAndLocations;
 		};
 
 	// Methods
@@ -4,6 +4,7 @@
 
 #include "CAudioFrames.h"
 
+#include "CBufferPool.h"
 #include "SError.h"
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -15,7 +16,7 @@ class CAudioFrames::Internals {
 				UInt32 bytesPerFramePerSegment) :
 			mSegmentCount(segmentCount), mSegmentByteCount(segmentByteCount), mAllocatedFrameCount(allocatedFrameCount),
 					mCurrentFrameCount(0), mBytesPerFramePerSegment(bytesPerFramePerSegment),
-					mOwnsBuffer(true), mBuffer(::calloc(1, (size_t) segmentCount * segmentByteCount)),
+					mOwnsBuffer(true), mBuffer(CBufferPool::allocate((size_t) segmentCount * segmentByteCount)),
 					mBufferByteCount(segmentCount * segmentByteCount)
 			{}
 		Internals(UInt32 segmentCount, UInt32 segmentByteCount, UInt32 allocatedFrameCount,
@@ -24,6 +25,13 @@ class CAudioFrames::Internals {
 					mCurrentFrameCount(0), mBytesPerFramePerSegment(bytesPerFramePerSegment),
 					mOwnsBuffer(false), mBuffer(buffer), mBufferByteCount(segmentCount * segmentByteCount)
 			{}
+		~Internals()
+			{
+				// Check if own buffer
+				if (mOwnsBuffer)
+					// Return to pool
+					CBufferPool::deallocate(mBuffer);
+			}
 
 		UInt32	mSegmentCount;
 		UInt32	mSegmentByteCount;
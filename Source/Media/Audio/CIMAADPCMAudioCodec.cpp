@@ -415,7 +415,7 @@ OV<SError> CDVIIntelIMAADPCMDecodeAudioCodec::decodeInto(CAudioFrames& audioFram
 	CAudioFrames::Info	writeInfo = audioFrames.getWriteInfo();
 	UInt32				remainingFrames = writeInfo.getFrameCount();
 	SInt16*				bufferPtr = (SInt16*) writeInfo.getSegments()[0];
-	TBuffer<UInt8>		packetBuffer(mBytesPerPacket);
+	TBuffer<UInt8>		packetBuffer(mBytesPerPacket, TBuffer<UInt8>::kAllocationPooled);
 	UInt32				decodedFrameCount = 0;
 	while (remainingFrames >= mFramesPerPacket) {
 		// Get next packet
@@ -113,7 +113,7 @@ TVResult<CMediaPacketSource::MediaPacketsAndBuffer> CSeekableUniformMediaPacketS
 {
 	// Add packets
 	UInt64					byteCountRemaining = maxByteCount;
-	TBuffer<UInt8>			buffer(maxByteCount);
+	TBuffer<UInt8>			buffer(maxByteCount, TBuffer<UInt8>::kAllocationPooled);
 	UInt8*					packetDataPtr = *buffer;
 	TNArray<SMedia::Packet>	mediaPackets;
 	while (mInternals->mNextPacketIndex < mInternals->mPacketCount) {
@@ -172,13 +172,13 @@ TVResult<SMedia::Packet> CSeekableUniformMediaPacketSource::readNextInto(TBuffer
 class CSeekableVaryingMediaPacketSource::Internals {
 	public:
 		Internals(const I<CRandomAccessDataSource>& randomAccessDataSource,
-				const TArray<SMedia::PacketAndLocation>& mediaPacketAndLocations) :
+				const TVArray<SMedia::PacketAndLocation>& mediaPacketAndLocations) :
 			mRandomAccessDataSource(randomAccessDataSource), mMediaPacketAndLocations(mediaPacketAndLocations),
 					mNextPacketIndex(0)
 			{}
 
 		I<CRandomAccessDataSource>			mRandomAccessDataSource;
-		TArray<SMedia::PacketAndLocation>	mMediaPacketAndLocations;
+		TVArray<SMedia::PacketAndLocation>	mMediaPacketAndLocations;
 		UInt32								mNextPacketIndex;
 };
 
@@ -191,7 +191,7 @@ class CSeekableVaryingMediaPacketSource::Internals {
 //----------------------------------------------------------------------------------------------------------------------
 CSeekableVaryingMediaPacketSource::CSeekableVaryingMediaPacketSource(
 		const I<CRandomAccessDataSource>& randomAccessDataSource,
-		const TArray<SMedia::PacketAndLocation>& mediaPacketAndLocations)
+		const TVArray<SMedia::PacketAndLocation>& mediaPacketAndLocations)
 //----------------------------------------------------------------------------------------------------------------------
 {
 	mInternals = new Internals(randomAccessDataSource, mediaPacketAndLocations);
@@ -212,7 +212,7 @@ UInt32 CSeekableVaryingMediaPacketSource::seekToDuration(UInt32 duration)
 {
 	// Find packet index
 	mInternals->mNextPacketIndex = 0;
-	for (TArray<SMedia::PacketAndLocation>::Iterator iterator = mInternals->mMediaPacketAndLocations.getIterator();
+	for (TVArray<SMedia::PacketAndLocation>::Iterator iterator = mInternals->mMediaPacketAndLocations.getIterator();
 			iterator; iterator++) {
 		// Check if can advance past this packet
 		if (duration >= iterator->getPacket().getDuration()) {
@@ -242,7 +242,7 @@ TVResult<SMedia::PacketData> CSeekableVaryingMediaPacketSource::readNext()
 	// Check if can read next packet
 	if (mInternals->mNextPacketIndex < mInternals->mMediaPacketAndLocations.getCount()) {
 		// Setup
-		SMedia::PacketAndLocation&	mediaPacketAndLocation =
+		const	SMedia::PacketAndLocation&	mediaPacketAndLocation =
 											mInternals->mMediaPacketAndLocations.getAt(mInternals->mNextPacketIndex);
 
 		// Copy packet data
@@ -267,12 +267,12 @@ TVResult<CMediaPacketSource::MediaPacketsAndBuffer> CSeekableVaryingMediaPacketS
 {
 	// Add packets
 	UInt64					byteCountRemaining = maxByteCount;
-	TBuffer<UInt8>			buffer(maxByteCount);
+	TBuffer<UInt8>			buffer(maxByteCount, TBuffer<UInt8>::kAllocationPooled);
 	UInt8*					packetDataPtr = *buffer;
 	TNArray<SMedia::Packet>	mediaPackets;
 	while (mInternals->mNextPacketIndex < mInternals->mMediaPacketAndLocations.getCount()) {
 		// Setup
-		SMedia::PacketAndLocation&	mediaPacketAndLocation =
+		const	SMedia::PacketAndLocation&	mediaPacketAndLocation =
 											mInternals->mMediaPacketAndLocations.getAt(mInternals->mNextPacketIndex);
 
 		// Check if have space
@@ -308,7 +308,7 @@ TVResult<SMedia::Packet> CSeekableVaryingMediaPacketSource::readNextInto(TBuffer
 	// Check if can read next packet
 	if (mInternals->mNextPacketIndex < mInternals->mMediaPacketAndLocations.getCount()) {
 		// Setup
-		SMedia::PacketAndLocation&	mediaPacketAndLocation =
+		const	SMedia::PacketAndLocation&	mediaPacketAndLocation =
 											mInternals->mMediaPacketAndLocations.getAt(mInternals->mNextPacketIndex);
 
 		// Copy packet data
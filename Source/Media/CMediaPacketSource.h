@@ -94,7 +94,7 @@ class CSeekableVaryingMediaPacketSource : public CMediaPacketSource {
 										// Lifecycle methods
 										CSeekableVaryingMediaPacketSource(
 												const I<CRandomAccessDataSource>& randomAccessDataSource,
-												const TArray<SMedia::PacketAndLocation>& mediaPacketAndLocations);
+												const TVArray<SMedia::PacketAndLocation>& mediaPacketAndLocations);
 										~CSeekableVaryingMediaPacketSource();
 
 										// CMediaPacketSource methods
@@ -293,7 +293,7 @@ I<SMediaSource::ImportResult> CMPEG4MediaFile::import(const SMediaSource::Import
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-TArray<SMedia::PacketAndLocation> CMPEG4MediaFile::composePacketAndLocations(const Internals& internals) const
+TVArray<SMedia::PacketAndLocation> CMPEG4MediaFile::composePacketAndLocations(const Internals& internals) const
 //----------------------------------------------------------------------------------------------------------------------
 {
 	// Setup
@@ -313,9 +313,15 @@ TArray<SMedia::PacketAndLocation> CMPEG4MediaFile::composePacketAndLocations(con
 	UInt32	currentBlockPacketIndex = 0;
 	UInt64	currentByteOffset = internals.getPacketGroupOffset(stcoBlockOffsetIndex);
 
+	// Reserve room for all packets
+	UInt32	sttsChunkCount = sttsAtomPayload.getChunkCount();
+	UInt32	packetCount = 0;
+	for (UInt32 sttsChunkIndex = 0; sttsChunkIndex < sttsChunkCount; sttsChunkIndex++)
+		// Add packet count
+		packetCount += sttsAtomPayload.getChunk(sttsChunkIndex).getPacketCount();
+
 	// Iterate all stts entries
-	UInt32								sttsChunkCount = sttsAtomPayload.getChunkCount();
-	TNArray<SMedia::PacketAndLocation>	packetAndLocations;
+	TVArray<SMedia::PacketAndLocation>	packetAndLocations(packetCount);
 	for (UInt32 sttsChunkIndex = 0; sttsChunkIndex < sttsChunkCount; sttsChunkIndex++) {
 		// Get packet info
 		const	SMPEG4::STTSAtomPayload::Chunk&	sttsChunk = sttsAtomPayload.getChunk(sttsChunkIndex);
@@ -397,7 +403,7 @@ TVResult<SMediaSource::Tracks::AudioTrack> CMPEG4MediaFile::composeAudioTrack(
 			SAudio::Format						audioFormat = CAACAudioCodec::composeAudioFormat(*info);
 
 			// Compose info
-			TArray<SMedia::PacketAndLocation>	mediaPacketAndLocations = composePacketAndLocations(internals);
+			TVArray<SMedia::PacketAndLocation>	mediaPacketAndLocations = composePacketAndLocations(internals);
 			UInt64								byteCount =
 														SMedia::PacketAndLocation::getTotalByteCount(
 																mediaPacketAndLocations);
@@ -450,7 +456,7 @@ TVResult<SMediaSource::Tracks::VideoTrack> CMPEG4MediaFile::composeVideoTrack(
 					TVResult<SMediaSource::Tracks::VideoTrack>(configurationData.getError()))
 
 			// Compose packet and locations
-			TArray<SMedia::PacketAndLocation>	mediaPacketAndLocations = composePacketAndLocations(internals);
+			TVArray<SMedia::PacketAndLocation>	mediaPacketAndLocations = composePacketAndLocations(internals);
 			Float32								frameRate =
 														(Float32) mediaPacketAndLocations.getCount() /
 																(Float32) duration;
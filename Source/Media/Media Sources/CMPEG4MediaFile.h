@@ -24,7 +24,7 @@ class CMPEG4MediaFile {
 
 															// Instance methods
 		virtual	I<SMediaSource::ImportResult>				import(const SMediaSource::ImportSetup& importSetup);
-				TArray<SMedia::PacketAndLocation>			composePacketAndLocations(const Internals& internals) const;
+				TVArray<SMedia::PacketAndLocation>			composePacketAndLocations(const Internals& internals) const;
 
 	protected:
 															// Instance methods
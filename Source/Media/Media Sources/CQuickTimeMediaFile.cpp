@@ -923,7 +923,7 @@ I<SMediaSource::ImportResult> CQuickTimeMediaFile::import(const SMediaSource::Im
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-TArray<SMedia::PacketAndLocation> CQuickTimeMediaFile::composePacketAndLocations(const Internals& internals,
+TVArray<SMedia::PacketAndLocation> CQuickTimeMediaFile::composePacketAndLocations(const Internals& internals,
 		const OV<UInt32>& framesPerPacket, const OV<UInt32>& bytesPerPacket) const
 //----------------------------------------------------------------------------------------------------------------------
 {
@@ -944,10 +944,17 @@ TArray<SMedia::PacketAndLocation> CQuickTimeMediaFile::composePacketAndLocations
 	UInt32	currentBlockPacketIndex = 0;
 	UInt64	currentByteOffset = internals.getPacketGroupOffset(stcoBlockOffsetIndex);
 
+	// Reserve room for all packets
+	UInt32	sttsChunkCount = sttsAtomPayload.getChunkCount();
+	UInt32	packetCount = 0;
+	for (UInt32 sttsChunkIndex = 0; sttsChunkIndex < sttsChunkCount; sttsChunkIndex++)
+		// Add packet count
+		packetCount += sttsAtomPayload.getChunk(sttsChunkIndex).getPacketCount();
+
 	// Iterate all stts entries
-	UInt32								sttsChunkCount = sttsAtomPayload.getChunkCount();
 	UInt32								currentFrameIndex = 0;
-	TNArray<SMedia::PacketAndLocation>	packetAndLocations;
+	TVArray<SMedia::PacketAndLocation>	packetAndLocations(
+												framesPerPacket.hasValue() ? packetCount / *framesPerPacket : packetCount);
 	for (UInt32 sttsChunkIndex = 0; sttsChunkIndex < sttsChunkCount; sttsChunkIndex++) {
 		// Get packet info
 		const	SQTsttsAtomPayload::Chunk&	sttsChunk = sttsAtomPayload.getChunk(sttsChunkIndex);
@@ -1123,7 +1130,7 @@ TVResult<SMediaSource::Tracks::AudioTrack> CQuickTimeMediaFile::composeAudioTrac
 						CCodec::unsupportedConfigurationError(CString(type, true)));
 
 			// Compose info
-			TArray<SMedia::PacketAndLocation>	mediaPacketAndLocations = composePacketAndLocations(internals);
+			TVArray<SMedia::PacketAndLocation>	mediaPacketAndLocations = composePacketAndLocations(internals);
 			UInt64								byteCount =
 														SMedia::PacketAndLocation::getTotalByteCount(
 																mediaPacketAndLocations);
@@ -1186,7 +1193,7 @@ TVResult<SMediaSource::Tracks::VideoTrack> CQuickTimeMediaFile::composeVideoTrac
 					TVResult<SMediaSource::Tracks::VideoTrack>(avcCAtomPayload.getError()));
 
 			// Compose packet and locations
-			TArray<SMedia::PacketAndLocation>	mediaPacketAndLocations = composePacketAndLocations(internals);
+			TVArray<SMedia::PacketAndLocation>	mediaPacketAndLocations = composePacketAndLocations(internals);
 			Float32								frameRate =
 														(Float32) mediaPacketAndLocations.getCount() /
 																(Float32) duration;
@@ -1275,7 +1282,7 @@ SMediaSource::Tracks::AudioTrack sComposePCMAudioTrackInfo(const CQuickTimeMedia
 			Float32								sampleRate = audioSampleDescription.getSampleRate();
 			UInt8								channels = (UInt8) audioSampleDescription.getChannelCount();
 			UInt32								bytesPerFrame = bits / 8 * channels;
-			TArray<SMedia::PacketAndLocation>	mediaPacketAndLocations =
+			TVArray<SMedia::PacketAndLocation>	mediaPacketAndLocations =
 														quickTimeMediaFile.composePacketAndLocations(internals,
 															OV<UInt32>(1), OV<UInt32>(bytesPerFrame));
 			SAudio::Format						audioFormat =
@@ -46,13 +46,13 @@ struct SMedia {
 									{ return mByteOffset; }
 
 								// Class methods
-		static			UInt64	getTotalByteCount(const TArray<PacketAndLocation>& packetAndLocations)
+		static			UInt64	getTotalByteCount(const TVArray<PacketAndLocation>& packetAndLocations)
 									{
 										// Setup
 										UInt64	byteCount = 0;
 
 										// Iterate
-										for (TArray<PacketAndLocation>::Iterator iterator =
+										for (TVArray<PacketAndLocation>::Iterator iterator =
 														packetAndLocations.getIterator();
 												iterator; iterator++)
 											// Update byte count
@@ -1020,7 +1020,7 @@ SVideo::Format CH264VideoCodec::composeVideoTrackFormat(const S2DSizeU16& frameS
 
 //----------------------------------------------------------------------------------------------------------------------
 I<CDecodeVideoCodec> CH264VideoCodec::create(const I<CRandomAccessDataSource>& randomAccessDataSource,
-		const TArray<SMedia::PacketAndLocation>& packetAndLocations, const CData& configurationData, UInt32 timeScale,
+		const TVArray<SMedia::PacketAndLocation>& packetAndLocations, const CData& configurationData, UInt32 timeScale,
 		const TNumberArray<UInt32>& keyframeIndexes)
 //----------------------------------------------------------------------------------------------------------------------
 {
@@ -17,7 +17,7 @@ class CH264VideoCodec {
 										// Class methods
 		static	SVideo::Format			composeVideoTrackFormat(const S2DSizeU16& frameSize, Float32 frameRate);
 		static	I<CDecodeVideoCodec>	create(const I<CRandomAccessDataSource>& randomAccessDataSource,
-												const TArray<SMedia::PacketAndLocation>& packetAndLocations,
+												const TVArray<SMedia::PacketAndLocation>& packetAndLocations,
 												const CData& configurationData, UInt32 timeScale,
 												const TNumberArray<UInt32>& keyframeIndexes);
 
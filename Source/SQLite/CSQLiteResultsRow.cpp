@@ -19,10 +19,18 @@ class CSQLiteResultsRow::Internals {
 				for (int i = 0; i < sqlite3_column_count(mStatement); i++) {
 					// Add to map
 					CString	columnName(sqlite3_column_name(mStatement, i));
-					mColumnNameMap.set(columnName, i);
+					mColumnNameMap.set(CString::Atom(columnName), SValue((SInt32) i));
 				}
 			}
 
+		SInt32	getColumnIndex(const CString::Atom& nameAtom) const
+					{
+						// Column names are keyed by atom so lookups match by pointer
+						OR<SValue>	index = mColumnNameMap[nameAtom];
+
+						return index.hasReference() ? index->getSInt32() : -1;
+					}
+
 		sqlite3_stmt*	mStatement;
 		CDictionary		mColumnNameMap;
 };
@@ -60,10 +68,9 @@ OV<SInt64> CSQLiteResultsRow::getInteger(const CSQLiteTableColumn& tableColumn)
 //----------------------------------------------------------------------------------------------------------------------
 {
 	// Preflight
-	const	CString&	name = tableColumn.getName();
 	AssertFailIf(tableColumn.getKind() != CSQLiteTableColumn::kKindInteger);
 
-	SInt32	index = mInternals->mColumnNameMap.getSInt32(name, -1);
+	SInt32	index = mInternals->getColumnIndex(tableColumn.getNameAtom());
 	AssertFailIf(index == -1);
 
 	return (sqlite3_column_type(mInternals->mStatement, index) != SQLITE_NULL) ?
@@ -75,10 +82,9 @@ OV<Float64> CSQLiteResultsRow::getReal(const CSQLiteTableColumn& tableColumn) co
 //----------------------------------------------------------------------------------------------------------------------
 {
 	// Preflight
-	const	CString&	name = tableColumn.getName();
 	AssertFailIf(tableColumn.getKind() != CSQLiteTableColumn::kKindReal);
 
-	SInt32	index = mInternals->mColumnNameMap.getSInt32(name, -1);
+	SInt32	index = mInternals->getColumnIndex(tableColumn.getNameAtom());
 	AssertFailIf(index == -1);
 
 	return (sqlite3_column_type(mInternals->mStatement, index) != SQLITE_NULL) ?
@@ -90,10 +96,9 @@ OV<CString> CSQLiteResultsRow::getText(const CSQLiteTableColumn& tableColumn) co
 //----------------------------------------------------------------------------------------------------------------------
 {
 	// Preflight
-	const	CString&	name = tableColumn.getName();
 	AssertFailIf(tableColumn.getKind() != CSQLiteTableColumn::kKindText);
 
-	SInt32	index = mInternals->mColumnNameMap.getSInt32(name, -1);
+	SInt32	index = mInternals->getColumnIndex(tableColumn.getNameAtom());
 	AssertFailIf(index == -1);
 
 	// Get value
@@ -107,10 +112,9 @@ OV<CData> CSQLiteResultsRow::getBlob(const CSQLiteTableColumn& tableColumn) cons
 //----------------------------------------------------------------------------------------------------------------------
 {
 	// Preflight
-	const	CString&	name = tableColumn.getName();
 	AssertFailIf(tableColumn.getKind() != CSQLiteTableColumn::kKindBlob);
 
-	SInt32	index = mInternals->mColumnNameMap.getSInt32(name, -1);
+	SInt32	index = mInternals->getColumnIndex(tableColumn.getNameAtom());
 	AssertFailIf(index == -1);
 
 	// Get value
@@ -166,105 +166,114 @@ class CSQLiteTable::Internals : public TReferenceCountableAutoDelete<Internals>
 													*iterator);
 									}
 
-		CString					getCreateString(const CSQLiteTableColumn& tableColumn)
+		void					appendCreateString(CString::Builder& stringBuilder,
+										const CSQLiteTableColumn& tableColumn)
 									{
 										// Compose column string
-										CString	string = tableColumn.getName() + CString::mSpace;
+										stringBuilder.append(tableColumn.getName()).append(" ");
 
 										switch (tableColumn.getKind()) {
 											case CSQLiteTableColumn::kKindInteger:
 												// Integer
-												string += CString(OSSTR("INTEGER"));
+												stringBuilder.append("INTEGER");
 												break;
 
 											case CSQLiteTableColumn::kKindReal:
 												// Real
-												string += CString(OSSTR("REAL"));
+												stringBuilder.append("REAL");
 												break;
 
 											case CSQLiteTableColumn::kKindText:
 											case CSQLiteTableColumn::kKindDateISO8601FractionalSecondsAutoSet:
 											case CSQLiteTableColumn::kKindDateISO8601FractionalSecondsAutoUpdate:
 												// Text
-												string += CString(OSSTR("TEXT"));
+												stringBuilder.append("TEXT");
 												break;
 
 											case CSQLiteTableColumn::kKindBlob:
 												// Blob
-												string += CString(OSSTR("BLOB"));
+												stringBuilder.append("BLOB");
 												break;
 										}
 
 										// Handle options
 										if (tableColumn.getOptions() & CSQLiteTableColumn::kOptionsPrimaryKey)
-											string += CString(OSSTR(" PRIMARY KEY"));
+											stringBuilder.append(" PRIMARY KEY");
 										if (tableColumn.getOptions() & CSQLiteTableColumn::kOptionsAutoIncrement)
-											string += CString(OSSTR(" AUTOINCREMENT"));
+											stringBuilder.append(" AUTOINCREMENT");
 										if (tableColumn.getOptions() & CSQLiteTableColumn::kOptionsNotNull)
-											string += CString(OSSTR(" NOT NULL"));
+											stringBuilder.append(" NOT NULL");
 										if (tableColumn.getOptions() & CSQLiteTableColumn::kOptionsUnique)
-											string += CString(OSSTR(" UNIQUE"));
+											stringBuilder.append(" UNIQUE");
 										if (tableColumn.getOptions() & CSQLiteTableColumn::kOptionsCheck)
-											string += CString(OSSTR(" CHECK"));
+											stringBuilder.append(" CHECK");
 
 										if (tableColumn.getDefaultValue().hasValue())
 											// Default
-											string +=
-													CString(OSSTR(" DEFAULT (")) +
-															tableColumn.getDefaultValue()->getString() +
-															CString(OSSTR(")"));
-
-										return string;
+											stringBuilder.append(" DEFAULT (")
+													.append(tableColumn.getDefaultValue()->getString()).append(")");
 									}
 		CString					getColumnNames(const TArray<CSQLiteTableColumn>& tableColumns)
 									{
 										// Setup
-										TNArray<CString>	strings;
+										CString::Builder	stringBuilder;
 										for (TArray<CSQLiteTableColumn>::Iterator iterator = tableColumns.getIterator();
 												iterator; iterator++) {
+											// Check if need separator
+											if (!iterator.isFirst())
+												// Add separator
+												stringBuilder.append(",");
+
 											// Add string
 											if ((*iterator == CSQLiteTableColumn::mAll) ||
 													(*iterator == CSQLiteTableColumn::mRowID))
 												// Non-complex
-												strings += iterator->getName();
+												stringBuilder.append(iterator->getName());
 											else
 												// Escape
-												strings +=
-															CString(OSSTR("`")) + iterator->getName() +
-																	CString(OSSTR("`"));
+												stringBuilder.append("`").append(iterator->getName()).append("`");
 										}
 
-										return CString(strings, CString(OSSTR(",")));
+										return stringBuilder.getString();
 									}
 		CString					getColumnNames(const TArray<TableColumnAndValue>& tableColumnAndValues)
 									{
 										// Setup
-										TNArray<CString>	strings;
+										CString::Builder	stringBuilder;
 										for (TArray<TableColumnAndValue>::Iterator iterator =
 														tableColumnAndValues.getIterator();
-												iterator; iterator++)
+												iterator; iterator++) {
+											// Check if need separator
+											if (!iterator.isFirst())
+												// Add separator
+												stringBuilder.append(",");
+
 											// Add string
-											strings +=
-													CString(OSSTR("`")) + iterator->getTableColumn().getName() +
-															CString(OSSTR("`"));
+											stringBuilder.append("`").append(iterator->getTableColumn().getName())
+													.append("`");
+										}
 
-										return CString(strings, CString(OSSTR(",")));
+										return stringBuilder.getString();
 									}
 		CString					getColumnNames(const TArray<CSQLiteTable::TableAndTableColumn>& tableAndTableColumns)
 									{
 										// Setup
-										TNArray<CString>	strings;
+										CString::Builder	stringBuilder;
 										for (TArray<CSQLiteTable::TableAndTableColumn>::Iterator iterator =
 														tableAndTableColumns.getIterator();
-												iterator; iterator++)
+												iterator; iterator++) {
+											// Check if need separator
+											if (!iterator.isFirst())
+												// Add separator
+												stringBuilder.append(",");
+
 											// Add string
-											strings +=
-													CString(OSSTR("`")) + iterator->getTable().getName() +
-															CString(OSSTR("`.`")) +
-															iterator->getTableColumn().getName() +
-															CString(OSSTR("`"));
+											stringBuilder.append("`").append(iterator->getTable().getName())
+													.append("`.`").append(iterator->getTableColumn().getName())
+													.append("`");
+										}
 
-										return CString(strings, CString(OSSTR(",")));
+										return stringBuilder.getString();
 									}
 		TArray<SSQLiteValue>	getValues(const TArray<TableColumnAndValue>& tableColumnAndValues)
 									{
@@ -278,6 +287,27 @@ class CSQLiteTable::Internals : public TReferenceCountableAutoDelete<Internals>
 
 										return values;
 									}
+		void					appendSelectStart(CString::Builder& statementBuilder, const CString& columnNames,
+										const OR<CSQLiteInnerJoin>& innerJoin)
+									{
+										// Append SELECT ... FROM ... [INNER JOIN ...]
+										statementBuilder.append("SELECT ").append(columnNames).append(" FROM `")
+												.append(mName).append("`");
+										if (innerJoin.hasReference())
+											// Append inner join
+											statementBuilder.append(innerJoin->getString());
+									}
+		void					appendSelectEnd(CString::Builder& statementBuilder, const OR<CSQLiteOrderBy>& orderBy,
+										const OR<CSQLiteLimit>& limit)
+									{
+										// Append [ORDER BY ...] [LIMIT ...]
+										if (orderBy.hasReference())
+											// Append order by
+											statementBuilder.append(orderBy->getString());
+										if (limit.hasReference())
+											// Append limit
+											statementBuilder.append(limit->getString());
+									}
 		OV<SError>				select(const CString& columnNames, const OR<CSQLiteInnerJoin>& innerJoin,
 										const OR<CSQLiteWhere>& where, const OR<CSQLiteOrderBy>& orderBy,
 										const OR<CSQLiteLimit>& limit, CSQLiteResultsRow::Proc resultsRowProc,
@@ -296,25 +326,15 @@ class CSQLiteTable::Internals : public TReferenceCountableAutoDelete<Internals>
 															valueGroups.getIterator();
 													iterator; iterator++) {
 												// Compose statement
-												CString	statement =
-																CString(OSSTR("SELECT ")) + columnNames +
-																		CString(OSSTR(" FROM `")) +
-																		mName + CString(OSSTR("`")) +
-																		(innerJoin.hasReference() ?
-																				innerJoin->getString() :
-																				CString::mEmpty) +
-																		iterator->getString() +
-																		(orderBy.hasReference() ?
-																				orderBy->getString() :
-																				CString::mEmpty) +
-																		(limit.hasReference() ?
-																				limit->getString() :
-																				CString::mEmpty);
-
+												CString::Builder	statementBuilder;
+												appendSelectStart(statementBuilder, columnNames, innerJoin);
+												statementBuilder.append(iterator->getString());
+												appendSelectEnd(statementBuilder, orderBy, limit);
 
 												// Perform
 												OV<SError>	error =
-																	mStatementPerformer.perform(statement,
+																	mStatementPerformer.perform(
+																			statementBuilder.getString(),
 																			iterator->getValues(), resultsRowProc,
 																			userData);
 												ReturnErrorIfError(error);
@@ -323,20 +343,12 @@ class CSQLiteTable::Internals : public TReferenceCountableAutoDelete<Internals>
 											return OV<SError>();
 										} else {
 											// No CSQLiteWhere
-											CString	statement =
-															CString(OSSTR("SELECT ")) + columnNames +
-																	CString(OSSTR(" FROM `")) +
-																	mName + CString(OSSTR("`")) +
-																	(innerJoin.hasReference() ?
-																			innerJoin->getString() :
-																			CString::mEmpty) +
-																	(orderBy.hasReference() ?
-																			orderBy->getString() :
-																			CString::mEmpty) +
-																	(limit.hasReference() ?
-																			limit->getString() : CString::mEmpty);
-
-											return mStatementPerformer.perform(statement, resultsRowProc, userData);
+											CString::Builder	statementBuilder;
+											appendSelectStart(statementBuilder, columnNames, innerJoin);
+											appendSelectEnd(statementBuilder, orderBy, limit);
+
+											return mStatementPerformer.perform(statementBuilder.getString(),
+													resultsRowProc, userData);
 										}
 									}
 
@@ -428,10 +440,13 @@ SInt32 CSQLiteTable::getVariableNumberLimit() const
 void CSQLiteTable::add(const CSQLiteTableColumn& tableColumn)
 //----------------------------------------------------------------------------------------------------------------------
 {
+	// Compose statement
+	CString::Builder	statementBuilder;
+	statementBuilder.append("ALTER TABLE `").append(mInternals->mName).append("` ADD COLUMN ");
+	mInternals->appendCreateString(statementBuilder, tableColumn);
+
 	// Perform
-	mInternals->mStatementPerformer.addToTransactionOrPerform(
-			CString(OSSTR("ALTER TABLE `")) + mInternals->mName + CString(OSSTR("` ADD COLUMN ")) +
-					mInternals->getCreateString(tableColumn));
+	mInternals->mStatementPerformer.addToTransactionOrPerform(statementBuilder.getString());
 
 	// Update
 	mInternals->mTableColumns += tableColumn;
@@ -464,52 +479,53 @@ void CSQLiteTable::create(bool ifNotExists) const
 //----------------------------------------------------------------------------------------------------------------------
 {
 	// Setup
-	TNArray<CString>	tableColumnInfos;
+	CString::Builder	statementBuilder;
+	statementBuilder.append("CREATE TABLE").append(ifNotExists ? " IF NOT EXISTS" : "").append(" `")
+			.append(mInternals->mName).append("` (");
+
+	// Iterate table columns
 	for (TArray<CSQLiteTableColumn>::Iterator iterator = mInternals->mTableColumns.getIterator(); iterator;
 			iterator++) {
+		// Check if need separator
+		if (!iterator.isFirst())
+			// Add separator
+			statementBuilder.append(", ");
+
 		// Start with create string
-		CString	tableColumnInfo = mInternals->getCreateString(*iterator);
+		mInternals->appendCreateString(statementBuilder, *iterator);
 
 		// Add references if applicable
 		OR<CSQLiteTableColumn::Reference>	tableColumnReference =
 													mInternals->mTableColumnReferenceMap[iterator->getName()];
 		if (tableColumnReference.hasReference())
 			// Add reference
-			tableColumnInfo +=
-					CString(OSSTR(" REFERENCES ")) +
-							tableColumnReference->getReferencedTable().getName() + CString(OSSTR("(")) +
-							tableColumnReference->getReferencedTableColumn().getName() +
-							CString(OSSTR(") ON UPDATE CASCADE"));
-
-		// Add
-		tableColumnInfos += tableColumnInfo;
+			statementBuilder.append(" REFERENCES ").append(tableColumnReference->getReferencedTable().getName())
+					.append("(").append(tableColumnReference->getReferencedTableColumn().getName())
+					.append(") ON UPDATE CASCADE");
 	}
 
 	// Create
-	CString	statement =
-					CString(OSSTR("CREATE TABLE")) + CString(ifNotExists ? OSSTR(" IF NOT EXISTS") : OSSTR("")) +
-							CString(OSSTR(" `")) + mInternals->mName + CString(OSSTR("` (")) +
-							CString(tableColumnInfos) + CString(OSSTR(")")) +
-							CString((mInternals->mOptions & kOptionsWithoutRowID) ?
-									OSSTR(" WITHOUT ROWID") : OSSTR(""));
-	mInternals->mStatementPerformer.addToTransactionOrPerform(statement);
+	statementBuilder.append(")").append((mInternals->mOptions & kOptionsWithoutRowID) ? " WITHOUT ROWID" : "");
+	mInternals->mStatementPerformer.addToTransactionOrPerform(statementBuilder.getString());
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 void CSQLiteTable::deleteRow(const CSQLiteWhere& where)
 //----------------------------------------------------------------------------------------------------------------------
 {
-	// Setup
-	CString	statement = CString(OSSTR("DELETE FROM `")) + mInternals->mName + CString(OSSTR("`"));
-
 	// Perform
 	TArray<CSQLiteWhere::ValueGroup>	valueGroups =
 												where.getValueGroups(
 														mInternals->mStatementPerformer.getVariableNumberLimit());
-	for (TArray<CSQLiteWhere::ValueGroup>::Iterator iterator = valueGroups.getIterator(); iterator; iterator++)
+	for (TArray<CSQLiteWhere::ValueGroup>::Iterator iterator = valueGroups.getIterator(); iterator; iterator++) {
+		// Compose statement
+		CString::Builder	statementBuilder;
+		statementBuilder.append("DELETE FROM `").append(mInternals->mName).append("`").append(iterator->getString());
+
 		// Add to transaction or perform
-		mInternals->mStatementPerformer.addToTransactionOrPerform(statement + iterator->getString(),
+		mInternals->mStatementPerformer.addToTransactionOrPerform(statementBuilder.getString(),
 				iterator->getValues());
+	}
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -523,15 +539,14 @@ void CSQLiteTable::deleteRows(const CSQLiteTableColumn& tableColumn, const TArra
 
 	// Iterate values chunks
 	for (TArray<TArray<SSQLiteValue> >::Iterator iterator = valuesChunks.getIterator(); iterator; iterator++) {
-		// Setup
-		CString	statement =
-					CString(OSSTR("DELETE FROM `")) + mInternals->mName + CString(OSSTR("` WHERE `")) +
-							tableColumn.getName() + CString(OSSTR("` IN (")) +
-							CString(TSArray<CString>(CString(OSSTR("?")), iterator->getCount()), CString(OSSTR(","))) +
-							CString(OSSTR(")"));
+		// Compose statement
+		CString::Builder	statementBuilder;
+		statementBuilder.append("DELETE FROM `").append(mInternals->mName).append("` WHERE `")
+				.append(tableColumn.getName()).append("` IN (").appendRepeated("?", iterator->getCount(), ",")
+				.append(")");
 
 		// Perform
-		mInternals->mStatementPerformer.addToTransactionOrPerform(statement, *iterator);
+		mInternals->mStatementPerformer.addToTransactionOrPerform(statementBuilder.getString(), *iterator);
 	}
 }
 
@@ -539,17 +554,24 @@ void CSQLiteTable::deleteRows(const CSQLiteTableColumn& tableColumn, const TArra
 void CSQLiteTable::drop(const CString& triggerName)
 //----------------------------------------------------------------------------------------------------------------------
 {
+	// Compose statement
+	CString::Builder	statementBuilder;
+	statementBuilder.append("DROP TRIGGER ").append(triggerName);
+
 	// Perform
-	mInternals->mStatementPerformer.addToTransactionOrPerform(CString(OSSTR("DROP TRIGGER ")) + triggerName);
+	mInternals->mStatementPerformer.addToTransactionOrPerform(statementBuilder.getString());
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 void CSQLiteTable::drop() const
 //----------------------------------------------------------------------------------------------------------------------
 {
+	// Compose statement
+	CString::Builder	statementBuilder;
+	statementBuilder.append("DROP TABLE `").append(mInternals->mName).append("`");
+
 	// Perform
-	mInternals->mStatementPerformer.addToTransactionOrPerform(
-			CString(OSSTR("DROP TABLE `")) + mInternals->mName + CString(OSSTR("`")));
+	mInternals->mStatementPerformer.addToTransactionOrPerform(statementBuilder.getString());
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -577,19 +599,15 @@ void CSQLiteTable::insertRow(const TArray<TableColumnAndValue>& tableColumnAndVa
 //----------------------------------------------------------------------------------------------------------------------
 {
 	// Setup
-	CString					statement =
-									CString(OSSTR("INSERT INTO `")) + mInternals->mName + CString(OSSTR("` (")) +
-											mInternals->getColumnNames(tableColumnAndValues) +
-											CString(OSSTR(") VALUES (")) +
-											CString(
-													TNArray<CString>(CString(OSSTR("?")),
-															tableColumnAndValues.getCount()),
-													CString(OSSTR(","))) +
-											CString(OSSTR(")"));
+	CString::Builder		statementBuilder;
+	statementBuilder.append("INSERT INTO `").append(mInternals->mName).append("` (")
+			.append(mInternals->getColumnNames(tableColumnAndValues)).append(") VALUES (")
+			.appendRepeated("?", tableColumnAndValues.getCount(), ",").append(")");
 	TArray<SSQLiteValue>	values = mInternals->getValues(tableColumnAndValues);
 
 	// Perform
-	mInternals->mStatementPerformer.addToTransactionOrPerform(statement, values, lastInsertRowIDProc, userData);
+	mInternals->mStatementPerformer.addToTransactionOrPerform(statementBuilder.getString(), values,
+			lastInsertRowIDProc, userData);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -609,20 +627,15 @@ void CSQLiteTable::insertOrReplaceRow(const TArray<TableColumnAndValue>& tableCo
 //----------------------------------------------------------------------------------------------------------------------
 {
 	// Setup
-	CString					statement =
-									CString(OSSTR("INSERT OR REPLACE INTO `")) + mInternals->mName +
-											CString(OSSTR("` (")) +
-											mInternals->getColumnNames(tableColumnAndValues) +
-											CString(OSSTR(") VALUES (")) +
-											CString(
-													TSArray<CString>(
-															CString(OSSTR("?")), tableColumnAndValues.getCount()),
-													CString(OSSTR(","))) +
-											CString(OSSTR(")"));
+	CString::Builder		statementBuilder;
+	statementBuilder.append("INSERT OR REPLACE INTO `").append(mInternals->mName).append("` (")
+			.append(mInternals->getColumnNames(tableColumnAndValues)).append(") VALUES (")
+			.appendRepeated("?", tableColumnAndValues.getCount(), ",").append(")");
 	TArray<SSQLiteValue>	values = mInternals->getValues(tableColumnAndValues);
 
 	// Perform
-	mInternals->mStatementPerformer.addToTransactionOrPerform(statement, values, lastInsertRowIDProc, userData);
+	mInternals->mStatementPerformer.addToTransactionOrPerform(statementBuilder.getString(), values,
+			lastInsertRowIDProc, userData);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -636,14 +649,13 @@ void CSQLiteTable::insertOrReplaceRows(const CSQLiteTableColumn& tableColumn, co
 
 	// Iterate values chunks
 	for (TArray<TArray<SSQLiteValue> >::Iterator iterator = valuesChunks.getIterator(); iterator; iterator++) {
-		// Setup
-		CString	statement =
-					CString(OSSTR("INSERT OR REPLACE INTO `")) + mInternals->mName + CString(OSSTR("` (`")) +
-							tableColumn.getName() + CString(OSSTR("`) VALUES ")) +
-							CString(TSArray<CString>(CString(OSSTR("(?)")), iterator->getCount()), CString(OSSTR(",")));
+		// Compose statement
+		CString::Builder	statementBuilder;
+		statementBuilder.append("INSERT OR REPLACE INTO `").append(mInternals->mName).append("` (`")
+				.append(tableColumn.getName()).append("`) VALUES ").appendRepeated("(?)", iterator->getCount(), ",");
 
 		// Perform
-		mInternals->mStatementPerformer.addToTransactionOrPerform(statement, *iterator);
+		mInternals->mStatementPerformer.addToTransactionOrPerform(statementBuilder.getString(), *iterator);
 	}
 }
 
@@ -660,15 +672,12 @@ OV<SError> CSQLiteTable::migrate(ResultsRowMigrationProc resultsRowMigrationProc
 	tempTable.create();
 
 	// Migrate content
-	Internals::MigrationInfo	migrationInfo(
-										CString(OSSTR("INSERT INTO `")) + tempTableName + CString(OSSTR("` (`")) +
-												mInternals->getColumnNames(mInternals->mTableColumns) +
-												CString(OSSTR(") VALUES (")) +
-												CString(
-														TSArray<CString>(CString(OSSTR("(?)")),
-																mInternals->mTableColumns.getCount()),
-														CString(OSSTR(","))),
-										*this, resultsRowMigrationProc, userData);
+	CString::Builder			statementBuilder;
+	statementBuilder.append("INSERT INTO `").append(tempTableName).append("` (`")
+			.append(mInternals->getColumnNames(mInternals->mTableColumns)).append(") VALUES (")
+			.appendRepeated("(?)", mInternals->mTableColumns.getCount(), ",");
+	CString						statement = statementBuilder.getString();
+	Internals::MigrationInfo	migrationInfo(statement, *this, resultsRowMigrationProc, userData);
 	mInternals->mStatementPerformer.performAsTransaction(
 			(CSQLiteStatementPerformer::TransactionProc) Internals::MigrationInfo::perform, &migrationInfo);
 	ReturnErrorIfError(migrationInfo.getError());
@@ -686,10 +695,13 @@ OV<SError> CSQLiteTable::migrate(ResultsRowMigrationProc resultsRowMigrationProc
 void CSQLiteTable::rename(const CString& name) const
 //----------------------------------------------------------------------------------------------------------------------
 {
+	// Compose statement
+	CString::Builder	statementBuilder;
+	statementBuilder.append("ALTER TABLE `").append(mInternals->mName).append("` RENAME TO `").append(name)
+			.append("`");
+
 	// Perform
-	mInternals->mStatementPerformer.addToTransactionOrPerform(
-			CString(OSSTR("ALTER TABLE `")) + mInternals->mName + CString(OSSTR("` RENAME TO `")) + name +
-					CString(OSSTR("`")));
+	mInternals->mStatementPerformer.addToTransactionOrPerform(statementBuilder.getString());
 
 	// Update
 	mInternals->mName = name;
@@ -815,11 +827,17 @@ void CSQLiteTable::update(const TArray<TableColumnAndValue>& tableColumnAndValue
 //----------------------------------------------------------------------------------------------------------------------
 {
 	// Setup
-	TNArray<CString>	tableColumnStrings;
-	for (UInt32 i = 0; i < tableColumnAndValues.getCount(); i++)
+	CString::Builder	setStringBuilder;
+	for (UInt32 i = 0; i < tableColumnAndValues.getCount(); i++) {
+		// Check if need separator
+		if (i > 0)
+			// Add separator
+			setStringBuilder.append(", ");
+
 		// Add string
-		tableColumnStrings +=
-				CString(OSSTR("`")) + tableColumnAndValues[i].getTableColumn().getName() + CString(OSSTR("` = ?"));
+		setStringBuilder.append("`").append(tableColumnAndValues[i].getTableColumn().getName()).append("` = ?");
+	}
+	CString				setString = setStringBuilder.getString();
 
 	// Iterate all groups in CSQLiteWhere
 	SInt32								groupSize =
@@ -828,13 +846,13 @@ void CSQLiteTable::update(const TArray<TableColumnAndValue>& tableColumnAndValue
 	TArray<CSQLiteWhere::ValueGroup>	valueGroups = where.getValueGroups(groupSize);
 	for (TArray<CSQLiteWhere::ValueGroup>::Iterator iterator = valueGroups.getIterator(); iterator++; iterator++) {
 		// Compose statement
-		CString					statement =
-										CString(OSSTR("UPDATE `")) + mInternals->mName + CString(OSSTR("` SET ")) +
-												CString(tableColumnStrings) + iterator->getString();
+		CString::Builder		statementBuilder;
+		statementBuilder.append("UPDATE `").append(mInternals->mName).append("` SET ").append(setString)
+				.append(iterator->getString());
 		TArray<SSQLiteValue>	values = mInternals->getValues(tableColumnAndValues) + iterator->getValues();
 
 		// Perform
-		mInternals->mStatementPerformer.addToTransactionOrPerform(statement, values);
+		mInternals->mStatementPerformer.addToTransactionOrPerform(statementBuilder.getString(), values);
 	}
 }
 
@@ -14,10 +14,10 @@ class CSQLiteTableColumn::Internals : public TReferenceCountableAutoDelete<Inter
 		Internals(const CString& name, CSQLiteTableColumn::Kind kind, CSQLiteTableColumn::Options options,
 				OV<SSQLiteValue> defaultValue = OV<SSQLiteValue>()) :
 			TReferenceCountableAutoDelete(),
-					mName(name), mKind(kind), mOptions(options), mDefaultValue(defaultValue)
+					mNameAtom(name), mKind(kind), mOptions(options), mDefaultValue(defaultValue)
 			{}
 
-		CString						mName;
+		CString::Atom				mNameAtom;
 		CSQLiteTableColumn::Kind	mKind;
 		CSQLiteTableColumn::Options	mOptions;
 		OV<SSQLiteValue>			mDefaultValue;
@@ -61,7 +61,14 @@ CSQLiteTableColumn::~CSQLiteTableColumn()
 const CString& CSQLiteTableColumn::getName() const
 //----------------------------------------------------------------------------------------------------------------------
 {
-	return mInternals->mName;
+	return mInternals->mNameAtom.getString();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+const CString::Atom& CSQLiteTableColumn::getNameAtom() const
+//----------------------------------------------------------------------------------------------------------------------
+{
+	return mInternals->mNameAtom;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
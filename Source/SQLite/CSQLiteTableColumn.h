@@ -90,10 +90,12 @@ class CSQLiteTableColumn : public CEquatable {
 
 											// CEquatable methods
 						bool				operator==(const CEquatable& other) const
-												{ return getName() == ((const CSQLiteTableColumn&) other).getName(); }
+												{ return getNameAtom() ==
+														((const CSQLiteTableColumn&) other).getNameAtom(); }
 
 											// Instance methods
 				const	CString&			getName() const;
+				const	CString::Atom&		getNameAtom() const;
 						Kind				getKind() const;
 						Options				getOptions() const;
 						OV<SSQLiteValue>	getDefaultValue() const;
@@ -17,35 +17,56 @@ static	CString	sVariablePlaceholder(OSSTR("##VARIABLEPLACEHOLDER##"));
 
 class CSQLiteWhere::Internals {
 	public:
-				Internals(const CString& string, const TArray<SSQLiteValue>& values) :
-					mString(string), mValues(values)
-					{}
-				Internals(const CString& string) : mString(string) {}
-
-		void	append(const CString& comparison, const SSQLiteValue& value)
-					{
-						// Check value type
-						if (value.getType() == SSQLiteValue::kTypeNull) {
-							// Value is NULL
-							if (comparison == CString(OSSTR("=")))
-								// IS NULL
-								mString += " IS NULL";
-							else if (comparison == CString(OSSTR("!=")))
-								// IS NOT NULL
-								mString += " IS NOT NULL";
-							else
-								// Unsupported NULL comparison
-								AssertFail();
-						} else if (value.getType() != SSQLiteValue::kTypeLastInsertRowID) {
-							// Actual value
-							mString += CString::mSpace + comparison + CString(OSSTR(" ?"));
-							mValues += TNArray<SSQLiteValue>(value);
-						} else
-							// Unsupported operation
-							AssertFail();
-					}
-
+									Internals(const TArray<SSQLiteValue>& values) :
+										mStringIsCurrent(false), mValues(values)
+										{}
+									Internals() : mStringIsCurrent(false) {}
+
+						void		append(const CString& comparison, const SSQLiteValue& value)
+										{
+											// Check value type
+											if (value.getType() == SSQLiteValue::kTypeNull) {
+												// Value is NULL
+												if (comparison == CString(OSSTR("=")))
+													// IS NULL
+													getStringBuilder().append(" IS NULL");
+												else if (comparison == CString(OSSTR("!=")))
+													// IS NOT NULL
+													getStringBuilder().append(" IS NOT NULL");
+												else
+													// Unsupported NULL comparison
+													AssertFail();
+											} else if (value.getType() != SSQLiteValue::kTypeLastInsertRowID) {
+												// Actual value
+												getStringBuilder().append(" ").append(comparison).append(" ?");
+												mValues += TNArray<SSQLiteValue>(value);
+											} else
+												// Unsupported operation
+												AssertFail();
+										}
+
+				CString::Builder&	getStringBuilder()
+										{
+											// Any materialized string is about to be stale
+											mStringIsCurrent = false;
+
+											return mStringBuilder;
+										}
+		const	CString&			getString()
+										{
+											// Check if need to materialize
+											if (!mStringIsCurrent) {
+												// Materialize
+												mString = mStringBuilder.getString();
+												mStringIsCurrent = true;
+											}
+
+											return mString;
+										}
+
+		CString::Builder				mStringBuilder;
 		CString							mString;
+		bool							mStringIsCurrent;
 		TNArray<TArray<SSQLiteValue> >	mValues;
 };
 
@@ -61,10 +82,9 @@ CSQLiteWhere::CSQLiteWhere(const CSQLiteTable& table, const CSQLiteTableColumn&
 //----------------------------------------------------------------------------------------------------------------------
 {
 	// Setup
-	mInternals =
-			new Internals(
-					CString(OSSTR(" WHERE `")) + table.getName() + CString(OSSTR("`.`")) + tableColumn.getName() +
-							CString(OSSTR("`")));
+	mInternals = new Internals();
+	mInternals->getStringBuilder().append(" WHERE `").append(table.getName()).append("`.`")
+			.append(tableColumn.getName()).append("`");
 	mInternals->append(comparison, value);
 }
 
@@ -73,10 +93,9 @@ CSQLiteWhere::CSQLiteWhere(const CSQLiteTable& table, const CSQLiteTableColumn&
 //----------------------------------------------------------------------------------------------------------------------
 {
 	// Setup
-	mInternals =
-			new Internals(
-					CString(OSSTR(" WHERE `")) + table.getName() + CString(OSSTR("`.`")) + tableColumn.getName() +
-							CString(OSSTR("`")));
+	mInternals = new Internals();
+	mInternals->getStringBuilder().append(" WHERE `").append(table.getName()).append("`.`")
+			.append(tableColumn.getName()).append("`");
 	mInternals->append(CString(OSSTR("=")), value);
 }
 
@@ -85,7 +104,8 @@ CSQLiteWhere::CSQLiteWhere(const CSQLiteTableColumn& tableColumn, const CString&
 //----------------------------------------------------------------------------------------------------------------------
 {
 	// Setup
-	mInternals = new Internals(CString(OSSTR(" WHERE `")) + tableColumn.getName() + CString(OSSTR("`")));
+	mInternals = new Internals();
+	mInternals->getStringBuilder().append(" WHERE `").append(tableColumn.getName()).append("`");
 	mInternals->append(comparison, value);
 }
 
@@ -94,7 +114,8 @@ CSQLiteWhere::CSQLiteWhere(const CSQLiteTableColumn& tableColumn, const SSQLiteV
 //----------------------------------------------------------------------------------------------------------------------
 {
 	// Setup
-	mInternals = new Internals(CString(OSSTR(" WHERE `")) + tableColumn.getName() + CString(OSSTR("`")));
+	mInternals = new Internals();
+	mInternals->getStringBuilder().append(" WHERE `").append(tableColumn.getName()).append("`");
 	mInternals->append(CString(OSSTR("=")), value);
 }
 
@@ -104,11 +125,9 @@ CSQLiteWhere::CSQLiteWhere(const CSQLiteTable& table, const CSQLiteTableColumn&
 //----------------------------------------------------------------------------------------------------------------------
 {
 	// Setup
-	mInternals =
-			new Internals(
-					CString(OSSTR(" WHERE `")) + table.getName() + CString(OSSTR("`.`")) + tableColumn.getName() +
-							CString(OSSTR("` IN (")) + sVariablePlaceholder + CString(OSSTR(")")),
-					values);
+	mInternals = new Internals(values);
+	mInternals->getStringBuilder().append(" WHERE `").append(table.getName()).append("`.`")
+			.append(tableColumn.getName()).append("` IN (").append(sVariablePlaceholder).append(")");
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -116,11 +135,9 @@ CSQLiteWhere::CSQLiteWhere(const CSQLiteTableColumn& tableColumn, const TArray<S
 //----------------------------------------------------------------------------------------------------------------------
 {
 	// Setup
-	mInternals =
-			new Internals(
-					CString(OSSTR(" WHERE `")) + tableColumn.getName() + CString(OSSTR("` IN (")) +
-							sVariablePlaceholder + CString(OSSTR(")")),
-					values);
+	mInternals = new Internals(values);
+	mInternals->getStringBuilder().append(" WHERE `").append(tableColumn.getName()).append("` IN (")
+			.append(sVariablePlaceholder).append(")");
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -136,7 +153,7 @@ CSQLiteWhere::~CSQLiteWhere()
 const CString& CSQLiteWhere::getString() const
 //----------------------------------------------------------------------------------------------------------------------
 {
-	return mInternals->mString;
+	return mInternals->getString();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -144,16 +161,17 @@ TArray<CSQLiteWhere::ValueGroup> CSQLiteWhere::getValueGroups(UInt32 groupSize)
 //----------------------------------------------------------------------------------------------------------------------
 {
 	// Setup
-	TNArray<ValueGroup>	valueGroups;
+	const	CString&			string = mInternals->getString();
+			TNArray<ValueGroup>	valueGroups;
 
 	// Check if need to group
-	if (!mInternals->mString.contains(sVariablePlaceholder)) {
+	if (!string.contains(sVariablePlaceholder)) {
 		// Single group
 		TNArray<SSQLiteValue>	values;
 		for (TArray<TArray<SSQLiteValue> >::Iterator iterator = mInternals->mValues.getIterator(); iterator; iterator++)
 			// Append
 			values += *iterator;
-		valueGroups += ValueGroup(mInternals->mString, values);
+		valueGroups += ValueGroup(string, values);
 	} else {
 		// Group
 		TNArray<SSQLiteValue>	preValueGroupValues;
@@ -179,27 +197,27 @@ TArray<CSQLiteWhere::ValueGroup> CSQLiteWhere::getValueGroups(UInt32 groupSize)
 		TNArray<SSQLiteValue>	allValues = preValueGroupValues + valueGroup + postValueGroupValues;
 		if (allValues.getCount() <= groupSize) {
 			// Can perform as a single group
-			CString	string =
-							mInternals->mString.replacingSubStrings(sVariablePlaceholder,
-									CString(
-											TSArray<CString>(CString(OSSTR("?")),
-													(UInt32) std::max<CArray::ItemCount>(allValues.getCount(), 1)),
-											CString(OSSTR(","))));
-			valueGroups += ValueGroup(string, allValues);
+			CString::Builder	placeholdersStringBuilder;
+			placeholdersStringBuilder.appendRepeated("?",
+					(UInt32) std::max<CArray::ItemCount>(allValues.getCount(), 1), ",");
+			valueGroups +=
+					ValueGroup(string.replacingSubStrings(sVariablePlaceholder, placeholdersStringBuilder.getString()),
+							allValues);
 		} else {
 			// Must perform in groups
 			TArray<TArray<SSQLiteValue> >	valuesChunks = TNArray<SSQLiteValue>::asChunksFrom(valueGroup, groupSize);
 			for (TArray<TArray<SSQLiteValue> >::Iterator iterator = valuesChunks.getIterator(); iterator; iterator++) {
 				// Setup
-				CString					string =
-												mInternals->mString.replacingSubStrings(sVariablePlaceholder,
-														CString(TSArray<CString>(CString(OSSTR("?")),
-																iterator->getCount()),
-														CString(OSSTR(","))));
+				CString::Builder		placeholdersStringBuilder;
+				placeholdersStringBuilder.appendRepeated("?", iterator->getCount(), ",");
 				TNArray<SSQLiteValue>	values = preValueGroupValues + *iterator + postValueGroupValues;
 
 				// Add ValueGroup
-				valueGroups += ValueGroup(string, values);
+				valueGroups +=
+						ValueGroup(
+								string.replacingSubStrings(sVariablePlaceholder,
+										placeholdersStringBuilder.getString()),
+								values);
 			}
 		}
 	}
@@ -213,9 +231,8 @@ CSQLiteWhere& CSQLiteWhere::addAnd(const CSQLiteTable& table, const CSQLiteTable
 //----------------------------------------------------------------------------------------------------------------------
 {
 	// Append
-	mInternals->mString +=
-			CString(OSSTR(" AND `")) + table.getName() + CString(OSSTR("`.`")) + tableColumn.getName() +
-					CString(OSSTR("`"));
+	mInternals->getStringBuilder().append(" AND `").append(table.getName()).append("`.`")
+			.append(tableColumn.getName()).append("`");
 	mInternals->append(comparison, value);
 
 	return *this;
@@ -227,7 +244,7 @@ CSQLiteWhere& CSQLiteWhere::addAnd(const CSQLiteTableColumn& tableColumn, const
 //----------------------------------------------------------------------------------------------------------------------
 {
 	// Append
-	mInternals->mString += CString(OSSTR(" AND `")) + tableColumn.getName() + CString(OSSTR("`"));
+	mInternals->getStringBuilder().append(" AND `").append(tableColumn.getName()).append("`");
 	mInternals->append(comparison, value);
 
 	return *this;
@@ -239,9 +256,8 @@ CSQLiteWhere& CSQLiteWhere::addAnd(const CSQLiteTable& table, const CSQLiteTable
 //----------------------------------------------------------------------------------------------------------------------
 {
 	// Append
-	mInternals->mString +=
-			CString(OSSTR(" AND `")) + table.getName() + CString(OSSTR("`.`")) + tableColumn.getName() +
-					CString(OSSTR("`")) + CString(OSSTR(" IN (")) + sVariablePlaceholder + CString(OSSTR(")"));
+	mInternals->getStringBuilder().append(" AND `").append(table.getName()).append("`.`")
+			.append(tableColumn.getName()).append("` IN (").append(sVariablePlaceholder).append(")");
 	mInternals->mValues = values;
 
 	return *this;
@@ -252,9 +268,8 @@ CSQLiteWhere& CSQLiteWhere::addAnd(const CSQLiteTableColumn& tableColumn, const
 //----------------------------------------------------------------------------------------------------------------------
 {
 	// Append
-	mInternals->mString +=
-			CString(OSSTR(" AND `")) + tableColumn.getName() + CString(OSSTR("`")) + CString(OSSTR(" IN (")) +
-					sVariablePlaceholder + CString(OSSTR(")"));
+	mInternals->getStringBuilder().append(" AND `").append(tableColumn.getName()).append("` IN (")
+			.append(sVariablePlaceholder).append(")");
 	mInternals->mValues = values;
 
 	return *this;
@@ -266,9 +281,8 @@ CSQLiteWhere& CSQLiteWhere::addOr(const CSQLiteTable& table, const CSQLiteTableC
 //----------------------------------------------------------------------------------------------------------------------
 {
 	// Append
-	mInternals->mString +=
-			CString(OSSTR(" OR `")) + table.getName() + CString(OSSTR("`.`")) + tableColumn.getName() +
-					CString(OSSTR("`"));
+	mInternals->getStringBuilder().append(" OR `").append(table.getName()).append("`.`")
+			.append(tableColumn.getName()).append("`");
 	mInternals->append(comparison, value);
 
 	return *this;
@@ -280,7 +294,7 @@ CSQLiteWhere& CSQLiteWhere::addOr(const CSQLiteTableColumn& tableColumn, const C
 //----------------------------------------------------------------------------------------------------------------------
 {
 	// Append
-	mInternals->mString += CString(OSSTR(" OR `")) + tableColumn.getName() + CString(OSSTR("`"));
+	mInternals->getStringBuilder().append(" OR `").append(tableColumn.getName()).append("`");
 	mInternals->append(comparison, value);
 
 	return *this;
@@ -4,10 +4,17 @@
 
 #include "CDataSource.h"
 
+#include "CArray.h"
 #include "CData.h"
 
 //----------------------------------------------------------------------------------------------------------------------
-// MARK: CRandomAccessDataSource
+// MARK: Local data
+
+static	const	UInt64	kFindWindowByteCount = 1024 * 1024;
+
+//----------------------------------------------------------------------------------------------------------------------
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - CRandomAccessDataSource
 
 // MARK: Properties
 
@@ -16,6 +23,88 @@ const	SError	CRandomAccessDataSource::mSetPosBeforeStartError(CString(OSSTR("CDa
 const	SError	CRandomAccessDataSource::mSetPosAfterEndError(CString(OSSTR("CDataSource")), 2,
 						CString(OSSTR("Data source set position after end")));
 
+// MARK: Instance methods
+
+//----------------------------------------------------------------------------------------------------------------------
+TVResult<OV<SRange64> > CRandomAccessDataSource::findData(const CData& data, UInt64 position)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Setup
+	UInt64	byteCount = getByteCount();
+	UInt64	subByteCount = data.getByteCount();
+	UInt64	windowByteCount = std::max<UInt64>(kFindWindowByteCount, subByteCount * 2);
+
+	// Search windows that overlap by one less than the data so no occurrence is split
+	while ((subByteCount > 0) && ((position + subByteCount) <= byteCount)) {
+		// Read window
+		UInt64			windowReadByteCount = std::min<UInt64>(windowByteCount, byteCount - position);
+		TVResult<CData>	windowData = readData(position, windowReadByteCount);
+		ReturnValueIfResultError(windowData, TVResult<OV<SRange64> >(windowData.getError()));
+
+		// Search window
+		OV<SRange64>	range = windowData->findSubData(data);
+		if (range.hasValue())
+			// Found
+			return TVResult<OV<SRange64> >(OV<SRange64>(SRange64(position + range->getStart(), range->getLength())));
+		else if ((position + windowReadByteCount) == byteCount)
+			// Searched to the end
+			break;
+
+		// Next window
+		position += windowReadByteCount - (subByteCount - 1);
+	}
+
+	return TVResult<OV<SRange64> >(OV<SRange64>());
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+TVResult<OV<CData::SubDataMatch> > CRandomAccessDataSource::findData(const TArray<CData>& datas, UInt64 position)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Setup
+	UInt64	byteCount = getByteCount();
+	UInt64	minimumSubByteCount = ~((UInt64) 0);
+	UInt64	maximumSubByteCount = 0;
+	for (TArray<CData>::Iterator iterator = datas.getIterator(); iterator; iterator++) {
+		// Skip empty
+		if (iterator->isEmpty())
+			continue;
+
+		// Update byte counts
+		minimumSubByteCount = std::min<UInt64>(minimumSubByteCount, iterator->getByteCount());
+		maximumSubByteCount = std::max<UInt64>(maximumSubByteCount, iterator->getByteCount());
+	}
+	UInt64	windowByteCount = std::max<UInt64>(kFindWindowByteCount, maximumSubByteCount * 2);
+
+	// Search windows that overlap by one less than the longest data so no occurrence is split
+	while ((maximumSubByteCount > 0) && ((position + minimumSubByteCount) <= byteCount)) {
+		// Read window
+		UInt64			windowReadByteCount = std::min<UInt64>(windowByteCount, byteCount - position);
+		TVResult<CData>	windowData = readData(position, windowReadByteCount);
+		ReturnValueIfResultError(windowData, TVResult<OV<CData::SubDataMatch> >(windowData.getError()));
+
+		// Search window.  A match in the overlap is only taken from the last window, as a longer data starting at
+		//	the same position may continue past this window.
+		bool						isLastWindow = (position + windowReadByteCount) == byteCount;
+		UInt64						nextPosition = position + windowReadByteCount - (maximumSubByteCount - 1);
+		OV<CData::SubDataMatch>		match = windowData->findSubData(datas);
+		if (match.hasValue() && (isLastWindow || ((position + match->getRange().getStart()) < nextPosition)))
+			// Found
+			return TVResult<OV<CData::SubDataMatch> >(
+					OV<CData::SubDataMatch>(
+							CData::SubDataMatch(match->getSubDataIndex(),
+									SRange64(position + match->getRange().getStart(), match->getRange().getLength()))));
+		else if (isLastWindow)
+			// Searched to the end
+			break;
+
+		// Next window
+		position = nextPosition;
+	}
+
+	return TVResult<OV<CData::SubDataMatch> >(OV<CData::SubDataMatch>());
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 //----------------------------------------------------------------------------------------------------------------------
 // MARK: - CDataDataSource::Internals
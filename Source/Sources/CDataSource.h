@@ -44,6 +44,12 @@ class CRandomAccessDataSource : public CDataSource {
 		virtual	TVResult<CData>					readData(UInt64 position, CData::ByteCount byteCount) = 0;
 		virtual	TVResult<TBuffer<const UInt8> >	readUInt8Buffer(UInt64 position, UInt64 byteCount) = 0;
 
+												// Finds data at or after position by reading in overlapping windows so
+												//	the whole source is never read at once.
+				TVResult<OV<SRange64> >			findData(const CData& data, UInt64 position = 0);
+				TVResult<OV<CData::SubDataMatch> >
+												findData(const TArray<CData>& datas, UInt64 position = 0);
+
 	// Properties
 	public:
 		static	const	SError	mSetPosBeforeStartError;
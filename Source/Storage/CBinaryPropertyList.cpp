@@ -255,10 +255,10 @@ TVResult<TArray<CDictionary> > CBPLReader::getArrayOfDictionaries(I<CBPLReader>&
 		ReturnValueIfResultError(dictionary, TVResult<TArray<CDictionary> >(dictionary.getError()));
 
 		// Add
-		array += *dictionary;
+		array += std::move(*dictionary);
 	}
 
-	return TVResult<TArray<CDictionary> >(array);
+	return TVResult<TArray<CDictionary> >(std::move(array));
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -275,10 +275,10 @@ TVResult<TArray<CString> > CBPLReader::getArrayOfStrings(const TBuffer<UInt64>&
 		ReturnValueIfResultError(string, TVResult<TArray<CString> >(string.getError()));
 
 		// Add
-		array += *string;
+		array += std::move(*string);
 	}
 
-	return TVResult<TArray<CString> >(array);
+	return TVResult<TArray<CString> >(std::move(array));
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -307,7 +307,7 @@ TVResult<CData> CBPLReader::getData(UInt64 objectIndex)
 	OV<SError>	error = read(data.getMutableBuffer(count), CString(OSSTR("reading data bytes")));
 	ReturnValueIfError(error, TVResult<CData>(*error));
 
-	return TVResult<CData>(data);
+	return TVResult<CData>(std::move(data));
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -358,10 +358,10 @@ TVResult<CDictionary> CBPLReader::getDictionary(I<CBPLReader>& bplReader, UInt64
 			ReturnValueIfResultError(value, TVResult<CDictionary>(value.getError()));
 
 			// Store
-			dictionary.set(*key, *value);
+			dictionary.set(*key, std::move(*value));
 		}
 
-		return TVResult<CDictionary>(dictionary);
+		return TVResult<CDictionary>(std::move(dictionary));
 	} else
 		// Use storage-backed dictionary
 		return TVResult<CDictionary>(
@@ -452,7 +452,7 @@ AssertFailUnimplemented();
 																	composeStandardDictionary);
 					ReturnValueIfResultError(array, TVResult<SValue>(array.getError()));
 
-					return TVResult<SValue>(*array);
+					return TVResult<SValue>(SValue(std::move(*array)));
 				}
 
 				case kMarkerTypeFloat32:
@@ -473,7 +473,7 @@ AssertFailUnimplemented();
 					TVResult<TArray<CString> >	array = getArrayOfStrings(*objectIndexes);
 					ReturnValueIfResultError(array, TVResult<SValue>(array.getError()));
 
-					return TVResult<SValue>(*array);
+					return TVResult<SValue>(SValue(std::move(*array)));
 				}
 			}
 		}
@@ -491,7 +491,7 @@ AssertFailUnimplemented();
 			TVResult<CData>	data = getData(objectIndex);
 			ReturnValueIfResultError(data, TVResult<SValue>(data.getError()));
 
-			return TVResult<SValue>(SValue(*data));
+			return TVResult<SValue>(SValue(std::move(*data)));
 			}
 
 		case kMarkerTypeDictionary: {
@@ -499,7 +499,7 @@ AssertFailUnimplemented();
 			TVResult<CDictionary>	dictionary = getDictionary(bplReader, objectIndex, composeStandardDictionary);
 			ReturnValueIfResultError(dictionary, TVResult<SValue>(dictionary.getError()));
 
-			return TVResult<SValue>(SValue(*dictionary));
+			return TVResult<SValue>(SValue(std::move(*dictionary)));
 			}
 
 		case kMarkerTypeFloat32: {
@@ -562,7 +562,7 @@ AssertFailUnimplemented();
 			TVResult<CString>	string = getString(objectIndex);
 			ReturnValueIfResultError(string, TVResult<SValue>(string.getError()));
 
-			return TVResult<SValue>(SValue(*string));
+			return TVResult<SValue>(SValue(std::move(*string)));
 			}
 
 		default:
@@ -915,16 +915,10 @@ class CBPLWriter {
 											return 8;
 									}
 
-		OV<SError>				write(const CFile& file)
+		OV<SError>				write(CData::Builder& dataBuilder)
 									{
-										// Open file for writing
-										CFileWriter	fileWriter(file);
-										OV<SError>	error = fileWriter.open(false, false, true);
-										ReturnErrorIfError(error);
-
-										// Write header
-										error = fileWriter.write(sBinaryPListV10Header);
-										ReturnErrorIfError(error);
+										// Add header
+										dataBuilder.append(sBinaryPListV10Header);
 
 										// Preprocess
 										PreprocessResult	preprocessResult = preprocess(mDictionary);
@@ -936,42 +930,55 @@ class CBPLWriter {
 
 										for (TSet<CString>::Iterator iterator = preprocessResult.getB().getIterator();
 												iterator; iterator++) {
-											// Write
-											TVResult<ObjectInfo>	result = write(fileWriter, *iterator);
+											// Add
+											TVResult<ObjectInfo>	result = add(dataBuilder, *iterator);
 											ReturnErrorIfResultError(result);
 
 											// Note index
 											mObjectIndexByString.set(*iterator, result->getA());
 										}
 
-										// Write objects
-										TVResult<ObjectInfo>	result = write(fileWriter, mDictionary);
+										// Add objects
+										TVResult<ObjectInfo>	result = add(dataBuilder, mDictionary);
 										ReturnErrorIfResultError(result);
 
 										// Get current state
 										UInt64	topObjectIndex = result->getA();
-										UInt8	objectOffsetByteCount = getIntegerByteCount(fileWriter.getPosition());
+										UInt8	objectOffsetByteCount = getIntegerByteCount(dataBuilder.getByteCount());
 										UInt64	totalObjectCount = mObjectInfos.getCount();
-										UInt64	objectOffsetTableOffset = fileWriter.getPosition();
+										UInt64	objectOffsetTableOffset = dataBuilder.getByteCount();
 
-										// Write object offsets
+										// Add object offsets
 										for (TArray<ObjectInfo>::Iterator iterator = mObjectInfos.getIterator();
 												iterator; iterator++) {
-											// Write offset
+											// Add offset
 											UInt64	swappedOffset = EndianU64_NtoB(iterator->getB());
-											error =
-													fileWriter.write(
-															(UInt8*) &swappedOffset + sizeof(UInt64) -
-																	objectOffsetByteCount,
-															objectOffsetByteCount);
-											ReturnErrorIfError(error);
+											dataBuilder.append((UInt8*) &swappedOffset + sizeof(UInt64) -
+													objectOffsetByteCount, objectOffsetByteCount);
 										}
 
-										// Write trailer
+										// Add trailer
 										SBinaryPListTrailer	trailer(objectOffsetByteCount, mObjectIndexByteCount,
 																	totalObjectCount, topObjectIndex,
 																	objectOffsetTableOffset);
-										error = fileWriter.write(&trailer, sizeof(SBinaryPListTrailer));
+										dataBuilder.append(&trailer, sizeof(SBinaryPListTrailer));
+
+										return OV<SError>();
+									}
+		OV<SError>				write(const CFile& file)
+									{
+										// Open file for writing
+										CFileWriter	fileWriter(file);
+										OV<SError>	error = fileWriter.open(false, false, true);
+										ReturnErrorIfError(error);
+
+										// Compose
+										CData::Builder	dataBuilder;
+										error = write(dataBuilder);
+										ReturnErrorIfError(error);
+
+										// Write
+										error = fileWriter.write(dataBuilder);
 										ReturnErrorIfError(error);
 
 										// Close
@@ -980,19 +987,17 @@ class CBPLWriter {
 
 										return OV<SError>();
 									}
-		OV<SError>				writeMarkerAndCount(CFileWriter& fileWriter, UInt8 marker, UInt64 count)
+		void					addMarkerAndCount(CData::Builder& dataBuilder, UInt8 marker, UInt64 count)
 									{
 										// Check count
-										if (count < 15) {
+										if (count < 15)
 											// Simple marker
-											OV<SError>	error = fileWriter.write((UInt8) (marker | count));
-											ReturnErrorIfError(error);
-										} else {
+											dataBuilder.append((UInt8) (marker | count));
+										else {
 											// Marker, then count
-											OV<SError>	error = fileWriter.write((UInt8) (marker | kMarkerCountMask));
-											ReturnErrorIfError(error);
+											dataBuilder.append((UInt8) (marker | kMarkerCountMask));
 
-											// Write count marker
+											// Add count marker
 											UInt8	countByteCount = getIntegerByteCount(count);
 											UInt8	countMarker;
 											switch (countByteCount) {
@@ -1001,21 +1006,15 @@ class CBPLWriter {
 												case 4:		countMarker = kMarkerTypeInteger4Bytes;	break;
 												default:	countMarker = kMarkerTypeInteger8Bytes;	break;
 											}
-											error = fileWriter.write(countMarker);
-											ReturnErrorIfError(error);
+											dataBuilder.append(countMarker);
 
-											// Write count
+											// Add count
 											UInt64	swwappedCount = EndianU64_NtoB(count);
-											error =
-													fileWriter.write(
-															(UInt8*) &swwappedCount + sizeof(UInt64) - countByteCount,
-															countByteCount);
-											ReturnErrorIfError(error);
+											dataBuilder.append((UInt8*) &swwappedCount + sizeof(UInt64) - countByteCount,
+													countByteCount);
 										}
-
-										return OV<SError>();
 									}
-		TVResult<ObjectInfo>	write(CFileWriter& fileWriter, const TArray<CDictionary>& array)
+		TVResult<ObjectInfo>	add(CData::Builder& dataBuilder, const TArray<CDictionary>& array)
 									{
 										// Setup
 										CData	indexesData(array.getCount() * mObjectIndexByteCount);
@@ -1024,7 +1023,7 @@ class CBPLWriter {
 										for (TArray<CDictionary>::Iterator iterator = array.getIterator(); iterator;
 												iterator++) {
 											// Add value
-											TVResult<ObjectInfo>	result = write(fileWriter, *iterator);
+											TVResult<ObjectInfo>	result = add(dataBuilder, *iterator);
 											ReturnResultIfResultError(result);
 
 											// Add info
@@ -1032,22 +1031,19 @@ class CBPLWriter {
 										}
 
 										// Get object info
-										ObjectInfo	objectInfo(mObjectInfos.getCount(), fileWriter.getPosition());
+										ObjectInfo	objectInfo(mObjectInfos.getCount(), dataBuilder.getByteCount());
 										mObjectInfos += objectInfo;
 
-										// Write marker and count
-										OV<SError>	error =
-															writeMarkerAndCount(fileWriter, kMarkerTypeArray,
+										// Add marker and count
+										addMarkerAndCount(dataBuilder, kMarkerTypeArray,
 																	array.getCount());
-										ReturnValueIfError(error, TVResult<ObjectInfo>(*error));
 
-										// Write indexes
-										error = fileWriter.write(indexesData);
-										ReturnValueIfError(error, TVResult<ObjectInfo>(*error));
+										// Add indexes
+										dataBuilder.append(indexesData);
 
 										return TVResult<ObjectInfo>(objectInfo);
 									}
-		TVResult<ObjectInfo>	write(CFileWriter& fileWriter, const TArray<CString>& array)
+		TVResult<ObjectInfo>	add(CData::Builder& dataBuilder, const TArray<CString>& array)
 									{
 										// Setup
 										CData	indexesData(array.getCount() * mObjectIndexByteCount);
@@ -1059,56 +1055,45 @@ class CBPLWriter {
 											addIndex(indexesData, mObjectIndexByString.getUInt64(*iterator));
 
 										// Get object info
-										ObjectInfo	objectInfo(mObjectInfos.getCount(), fileWriter.getPosition());
+										ObjectInfo	objectInfo(mObjectInfos.getCount(), dataBuilder.getByteCount());
 										mObjectInfos += objectInfo;
 
-										// Write marker and count
-										OV<SError>	error =
-															writeMarkerAndCount(fileWriter, kMarkerTypeArray,
+										// Add marker and count
+										addMarkerAndCount(dataBuilder, kMarkerTypeArray,
 																	array.getCount());
-										ReturnValueIfError(error, TVResult<ObjectInfo>(*error));
 
-										// Write indexes
-										error = fileWriter.write(indexesData);
-										ReturnValueIfError(error, TVResult<ObjectInfo>(*error));
+										// Add indexes
+										dataBuilder.append(indexesData);
 
 										return TVResult<ObjectInfo>(objectInfo);
 									}
-		TVResult<ObjectInfo>	write(CFileWriter& fileWriter, bool value)
+		TVResult<ObjectInfo>	add(CData::Builder& dataBuilder, bool value)
 									{
 										// Setup
-										ObjectInfo	objectInfo(mObjectInfos.getCount(), fileWriter.getPosition());
+										ObjectInfo	objectInfo(mObjectInfos.getCount(), dataBuilder.getByteCount());
 										mObjectInfos += objectInfo;
 
-										// Write
-										OV<SError>	error =
-															fileWriter.write(
-																	value ?
-																			kMarkerTypeBooleanTrue :
-																			kMarkerTypeBooleanFalse);
-										ReturnValueIfError(error, TVResult<ObjectInfo>(*error));
+										// Add
+										dataBuilder.append(value ? kMarkerTypeBooleanTrue : kMarkerTypeBooleanFalse);
 
 										return TVResult<ObjectInfo>(objectInfo);
 									}
-		TVResult<ObjectInfo>	write(CFileWriter& fileWriter, const CData& data)
+		TVResult<ObjectInfo>	add(CData::Builder& dataBuilder, const CData& data)
 									{
 										// Setup
-										ObjectInfo	objectInfo(mObjectInfos.getCount(), fileWriter.getPosition());
+										ObjectInfo	objectInfo(mObjectInfos.getCount(), dataBuilder.getByteCount());
 										mObjectInfos += objectInfo;
 
-										// Write marker and count
-										OV<SError>	error =
-															writeMarkerAndCount(fileWriter, kMarkerTypeData,
+										// Add marker and count
+										addMarkerAndCount(dataBuilder, kMarkerTypeData,
 																	data.getByteCount());
-										ReturnValueIfError(error, TVResult<ObjectInfo>(*error));
 
-										// Write data
-										error = fileWriter.write(data);
-										ReturnValueIfError(error, TVResult<ObjectInfo>(*error));
+										// Add data
+										dataBuilder.append(data);
 
 										return TVResult<ObjectInfo>(objectInfo);
 									}
-		TVResult<ObjectInfo>	write(CFileWriter& fileWriter, const CDictionary& dictionary)
+		TVResult<ObjectInfo>	add(CData::Builder& dataBuilder, const CDictionary& dictionary)
 									{
 										// Setup
 										CData	keyIndexesData(dictionary.getCount() * mObjectIndexByteCount);
@@ -1132,10 +1117,10 @@ class CBPLWriter {
 													case SValue::kTypeArrayOfDictionaries:
 														// Array of Dictionaries - only store if have at least 1 item
 														if (value.getArrayOfDictionaries().getCount() > 0) {
-															// Write
+															// Add
 															addIndex(keyIndexesData,
 																	mObjectIndexByString.getUInt64(iterator.getKey()));
-															result.setValue(write(fileWriter,
+															result.setValue(add(dataBuilder,
 																	value.getArrayOfDictionaries()));
 															break;
 														} else
@@ -1145,10 +1130,10 @@ class CBPLWriter {
 													case SValue::kTypeArrayOfStrings:
 														// Array of Strings - only store if have at least 1 item
 														if (value.getArrayOfStrings().getCount() > 0) {
-															// Write
+															// Add
 															addIndex(keyIndexesData,
 																	mObjectIndexByString.getUInt64(iterator.getKey()));
-															result.setValue(write(fileWriter,
+															result.setValue(add(dataBuilder,
 																	value.getArrayOfStrings()));
 															break;
 														} else
@@ -1159,35 +1144,35 @@ class CBPLWriter {
 														// Bool
 														addIndex(keyIndexesData,
 																mObjectIndexByString.getUInt64(iterator.getKey()));
-														result.setValue(write(fileWriter, value.getBool()));
+														result.setValue(add(dataBuilder, value.getBool()));
 														break;
 
 													case SValue::kTypeData:
 														// Data
 														addIndex(keyIndexesData,
 																mObjectIndexByString.getUInt64(iterator.getKey()));
-														result.setValue(write(fileWriter, value.getData()));
+														result.setValue(add(dataBuilder, value.getData()));
 														break;
 
 													case SValue::kTypeDictionary:
 														// Dictionary
 														addIndex(keyIndexesData,
 																mObjectIndexByString.getUInt64(iterator.getKey()));
-														result.setValue(write(fileWriter, value.getDictionary()));
+														result.setValue(add(dataBuilder, value.getDictionary()));
 														break;
 
 													case SValue::kTypeFloat32:
 														// FLoat32
 														addIndex(keyIndexesData,
 																mObjectIndexByString.getUInt64(iterator.getKey()));
-														result.setValue(write(fileWriter, value.getFloat32()));
+														result.setValue(add(dataBuilder, value.getFloat32()));
 														break;
 
 													case SValue::kTypeFloat64:
 														// Float64
 														addIndex(keyIndexesData,
 																mObjectIndexByString.getUInt64(iterator.getKey()));
-														result.setValue(write(fileWriter, value.getFloat64()));
+														result.setValue(add(dataBuilder, value.getFloat64()));
 														break;
 
 													case SValue::kTypeSInt8:
@@ -1202,7 +1187,7 @@ class CBPLWriter {
 														addIndex(keyIndexesData,
 																mObjectIndexByString.getUInt64(iterator.getKey()));
 														result.setValue(
-																write(fileWriter, value.getUInt64(),
+																add(dataBuilder, value.getUInt64(),
 																		getIntegerByteCount(value.getUInt64())));
 														break;
 
@@ -1218,61 +1203,54 @@ class CBPLWriter {
 										}
 
 										// Get object info
-										ObjectInfo	objectInfo(mObjectInfos.getCount(), fileWriter.getPosition());
+										ObjectInfo	objectInfo(mObjectInfos.getCount(), dataBuilder.getByteCount());
 										mObjectInfos += objectInfo;
 
-										// Write marker and count
-										OV<SError>	error =
-															writeMarkerAndCount(fileWriter, kMarkerTypeDictionary,
-																	keyIndexesData.getByteCount() /
-																			mObjectIndexByteCount);
-										ReturnValueIfError(error, TVResult<ObjectInfo>(*error));
+										// Add marker and count
+										addMarkerAndCount(dataBuilder, kMarkerTypeDictionary,
+												keyIndexesData.getByteCount() / mObjectIndexByteCount);
 
-										// Write key indexes and value indexes
-										error = fileWriter.write(keyIndexesData + valueIndexesData);
-										ReturnValueIfError(error, TVResult<ObjectInfo>(*error));
+										// Add key indexes and value indexes
+										dataBuilder.append(keyIndexesData);
+										dataBuilder.append(valueIndexesData);
 
 										return TVResult<ObjectInfo>(objectInfo);
 									}
-		TVResult<ObjectInfo>	write(CFileWriter& fileWriter, Float32 value)
+		TVResult<ObjectInfo>	add(CData::Builder& dataBuilder, Float32 value)
 									{
 										// Setup
-										ObjectInfo	objectInfo(mObjectInfos.getCount(), fileWriter.getPosition());
+										ObjectInfo	objectInfo(mObjectInfos.getCount(), dataBuilder.getByteCount());
 										mObjectInfos += objectInfo;
 
-										// Write marker
-										OV<SError>	error = fileWriter.write(kMarkerTypeFloat32);
-										ReturnValueIfError(error, TVResult<ObjectInfo>(*error));
+										// Add marker
+										dataBuilder.append(kMarkerTypeFloat32);
 
-										// Write value
-										error = fileWriter.write(EndianF32_NtoB(value));
-										ReturnValueIfError(error, TVResult<ObjectInfo>(*error));
+										// Add value
+										dataBuilder.append(EndianF32_NtoB(value));
 
 										return TVResult<ObjectInfo>(objectInfo);
 									}
-		TVResult<ObjectInfo>	write(CFileWriter& fileWriter, Float64 value)
+		TVResult<ObjectInfo>	add(CData::Builder& dataBuilder, Float64 value)
 									{
 										// Setup
-										ObjectInfo	objectInfo(mObjectInfos.getCount(), fileWriter.getPosition());
+										ObjectInfo	objectInfo(mObjectInfos.getCount(), dataBuilder.getByteCount());
 										mObjectInfos += objectInfo;
 
-										// Write marker
-										OV<SError>	error = fileWriter.write(kMarkerTypeFloat64);
-										ReturnValueIfError(error, TVResult<ObjectInfo>(*error));
+										// Add marker
+										dataBuilder.append(kMarkerTypeFloat64);
 
-										// Write value
-										error = fileWriter.write(EndianF64_NtoB(value));
-										ReturnValueIfError(error, TVResult<ObjectInfo>(*error));
+										// Add value
+										dataBuilder.append(EndianF64_NtoB(value));
 
 										return TVResult<ObjectInfo>(objectInfo);
 									}
-		TVResult<ObjectInfo>	write(CFileWriter& fileWriter, UInt64 value, UInt8 byteCount)
+		TVResult<ObjectInfo>	add(CData::Builder& dataBuilder, UInt64 value, UInt8 byteCount)
 									{
 										// Setup
-										ObjectInfo	objectInfo(mObjectInfos.getCount(), fileWriter.getPosition());
+										ObjectInfo	objectInfo(mObjectInfos.getCount(), dataBuilder.getByteCount());
 										mObjectInfos += objectInfo;
 
-										// Write marker
+										// Add marker
 										UInt8	marker;
 										switch (byteCount) {
 											case 1:		marker = kMarkerTypeInteger1Byte;	break;
@@ -1280,22 +1258,18 @@ class CBPLWriter {
 											case 4:		marker = kMarkerTypeInteger4Bytes;	break;
 											default:	marker = kMarkerTypeInteger8Bytes;	break;
 										}
-										OV<SError>	error = fileWriter.write(marker);
-										ReturnValueIfError(error, TVResult<ObjectInfo>(*error));
+										dataBuilder.append(marker);
 
-										// Write value
+										// Add value
 										UInt64	swappedValue = EndianU64_NtoB(value);
-										error =
-												fileWriter.write((UInt8*) &swappedValue + sizeof(UInt64) - byteCount,
-														byteCount);
-										ReturnValueIfError(error, TVResult<ObjectInfo>(*error));
+										dataBuilder.append((UInt8*) &swappedValue + sizeof(UInt64) - byteCount, byteCount);
 
 										return TVResult<ObjectInfo>(objectInfo);
 									}
-		TVResult<ObjectInfo>	write(CFileWriter& fileWriter, const CString& string)
+		TVResult<ObjectInfo>	add(CData::Builder& dataBuilder, const CString& string)
 									{
 										// Setup
-										ObjectInfo	objectInfo(mObjectInfos.getCount(), fileWriter.getPosition());
+										ObjectInfo	objectInfo(mObjectInfos.getCount(), dataBuilder.getByteCount());
 										mObjectInfos += objectInfo;
 
 										// Compose string info
@@ -1310,15 +1284,11 @@ class CBPLWriter {
 											data = string.getData(CString::kEncodingUTF16BE);
 										}
 
-										// Write marker + count
-										OV<SError>	error =
-															writeMarkerAndCount(fileWriter, marker,
-																	data->getByteCount());
-										ReturnValueIfError(error, TVResult<ObjectInfo>(*error));
+										// Add marker + count
+										addMarkerAndCount(dataBuilder, marker, data->getByteCount());
 
-										// Write data
-										error = fileWriter.write(*data);
-										ReturnValueIfError(error, TVResult<ObjectInfo>(*error));
+										// Add data
+										dataBuilder.append(*data);
 
 										return TVResult<ObjectInfo>(objectInfo);
 									}
@@ -1344,6 +1314,20 @@ TVResult<CDictionary> CBinaryPropertyList::dictionaryFrom(const I<CRandomAccessD
 	return CBPLReader::getDictionary(randomAccessDataSource, composeStandardDictionary);
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+TVResult<CData> CBinaryPropertyList::dataFrom(const CDictionary& dictionary)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Setup
+	CData::Builder	dataBuilder;
+
+	// Compose
+	OV<SError>	error = CBPLWriter(dictionary).write(dataBuilder);
+	ReturnValueIfError(error, TVResult<CData>(*error));
+
+	return TVResult<CData>(dataBuilder.getData());
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 OV<SError> CBinaryPropertyList::write(const CDictionary& dictionary, const CFile& file)
 //----------------------------------------------------------------------------------------------------------------------
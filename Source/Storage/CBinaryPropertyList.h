@@ -18,5 +18,6 @@ class CBinaryPropertyList {
 										// Class methods
 		static	TVResult<CDictionary>	dictionaryFrom(const I<CRandomAccessDataSource>& randomAccessDataSource,
 												bool composeStandardDictionary = false);
+		static	TVResult<CData>			dataFrom(const CDictionary& dictionary);
 		static	OV<SError>				write(const CDictionary& dictionary, const CFile& file);
 };
@@ -4,6 +4,7 @@
 
 #include "CJSON.h"
 
+#include "CSlabAllocator.h"
 #include "SError.h"
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -17,15 +18,18 @@ static	SError	sInvalidTokenError(sErrorDomain, 2, CString(OSSTR("Invalid Token")
 //----------------------------------------------------------------------------------------------------------------------
 // MARK: - Local method declarations
 
-static	OV<SError>						sAddArrayOfDictionaries(CData& data, const TArray<CDictionary>& array);
-static	OV<SError>						sAddArrayOfStrings(CData& data, const TArray<CString>& array);
-static	OV<SError>						sAddDictionary(CData& data, const CDictionary& dictionary);
-static	void							sAddString(CData& data, const CString& string);
-
-static	TVResult<TArray<CDictionary> >	sReadArrayOfDictionaries(const SInt8*& charPtr);
-static	TVResult<CDictionary>			sReadDictionary(const SInt8*& charPtr);
-static	TVResult<CString>				sReadString(const SInt8*& charPtr);
-static	TVResult<SValue>				sReadValue(const SInt8*& charPtr);
+static	OV<SError>						sAddArrayOfDictionaries(CData::Builder& dataBuilder,
+												const TArray<CDictionary>& array);
+static	OV<SError>						sAddArrayOfStrings(CData::Builder& dataBuilder, const TArray<CString>& array);
+static	OV<SError>						sAddDictionary(CData::Builder& dataBuilder, const CDictionary& dictionary);
+static	void							sAddString(CData::Builder& dataBuilder, const CString& string);
+
+static	TVResult<TArray<CDictionary> >	sReadArrayOfDictionaries(const SInt8*& charPtr,
+												CSlabAllocator::Arena& arena);
+static	TVResult<CDictionary>			sReadDictionary(const SInt8*& charPtr, CSlabAllocator::Arena& arena);
+static	TVResult<SValue>				sReadNumber(const char* charPtr, const char* endCharPtr, bool isFloat);
+static	TVResult<CString>				sReadString(const SInt8*& charPtr, CSlabAllocator::Arena& arena);
+static	TVResult<SValue>				sReadValue(const SInt8*& charPtr, CSlabAllocator::Arena& arena);
 static	void							sSkipWhitespace(const SInt8*& charPtr);
 static	OV<SError>						sValidateToken(const SInt8*& charPtr, char token, bool advance = false);
 
@@ -40,13 +44,13 @@ TVResult<CData> CJSON::dataFrom(const TArray<CDictionary>& array)
 //----------------------------------------------------------------------------------------------------------------------
 {
 	// Setup
-	CData	data;
+	CData::Builder	dataBuilder;
 
 	// Add array
-	OV<SError>	error = sAddArrayOfDictionaries(data, array);
+	OV<SError>	error = sAddArrayOfDictionaries(dataBuilder, array);
 	ReturnValueIfError(error, TVResult<CData>(*error));
 
-	return TVResult<CData>(data);
+	return TVResult<CData>(dataBuilder.getData());
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -54,33 +58,35 @@ TVResult<CData> CJSON::dataFrom(const CDictionary& dictionary)
 //----------------------------------------------------------------------------------------------------------------------
 {
 	// Setup
-	CData	data;
+	CData::Builder	dataBuilder;
 
 	// Add dictionary
-	OV<SError>	error = sAddDictionary(data, dictionary);
+	OV<SError>	error = sAddDictionary(dataBuilder, dictionary);
 	ReturnValueIfError(error, TVResult<CData>(*error));
 
-	return TVResult<CData>(data);
+	return TVResult<CData>(dataBuilder.getData());
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 TVResult<TArray<CDictionary> > CJSON::arrayOfDictionariesFrom(const CData& data)
 //----------------------------------------------------------------------------------------------------------------------
 {
-	// Setup
-	const SInt8*	ptr = *data.getSInt8Buffer();
+	// Setup.  The arena holds scratch space for unescaping strings until we are done.
+	const	SInt8*					ptr = *data.getSInt8Buffer();
+			CSlabAllocator::Arena	arena;
 
-	return sReadArrayOfDictionaries(ptr);
+	return sReadArrayOfDictionaries(ptr, arena);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 TVResult<CDictionary> CJSON::dictionaryFrom(const CData& data)
 //----------------------------------------------------------------------------------------------------------------------
 {
-	// Setup
-	const SInt8*	ptr = *data.getSInt8Buffer();
+	// Setup.  The arena holds scratch space for unescaping strings until we are done.
+	const	SInt8*					ptr = *data.getSInt8Buffer();
+			CSlabAllocator::Arena	arena;
 
-	return sReadDictionary(ptr);
+	return sReadDictionary(ptr, arena);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -88,90 +94,93 @@ TVResult<CDictionary> CJSON::dictionaryFrom(const CData& data)
 // MARK: Local method definitions
 
 //----------------------------------------------------------------------------------------------------------------------
-OV<SError> sAddArrayOfDictionaries(CData& data, const TArray<CDictionary>& array)
+OV<SError> sAddArrayOfDictionaries(CData::Builder& dataBuilder, const TArray<CDictionary>& array)
 //----------------------------------------------------------------------------------------------------------------------
 {
 	// Start
-	data.append("[", 1);
+	dataBuilder.append("[", 1);
 
 	// Iterate array
 	for (TArray<CDictionary>::Iterator iterator = array.getIterator(); iterator; iterator++) {
 		// Check if first
 		if (!iterator.isFirst())
 			// Add comma
-			data.append(",", 1);
+			dataBuilder.append(",", 1);
 
 		// Add value
-		sAddDictionary(data, *iterator);
+		sAddDictionary(dataBuilder, *iterator);
 	}
 
 	// End
-	data.append("]", 1);
+	dataBuilder.append("]", 1);
 
 	return OV<SError>();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-OV<SError> sAddArrayOfStrings(CData& data, const TArray<CString>& array)
+OV<SError> sAddArrayOfStrings(CData::Builder& dataBuilder, const TArray<CString>& array)
 //----------------------------------------------------------------------------------------------------------------------
 {
 	// Start
-	data.append("[", 1);
+	dataBuilder.append("[", 1);
 
 	// Iterate array
 	for (TArray<CString>::Iterator iterator = array.getIterator(); iterator; iterator++) {
 		// Check if first
 		if (!iterator.isFirst())
 			// Add comma
-			data.append(",", 1);
+			dataBuilder.append(",", 1);
 
 		// Add value
-		sAddString(data, *iterator);
+		sAddString(dataBuilder, *iterator);
 	}
 
 	// End
-	data.append("]", 1);
+	dataBuilder.append("]", 1);
 
 	return OV<SError>();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-OV<SError> sAddDictionary(CData& data, const CDictionary& dictionary)
+OV<SError> sAddDictionary(CData::Builder& dataBuilder, const CDictionary& dictionary)
 //----------------------------------------------------------------------------------------------------------------------
 {
+	// Setup
+	char	chars[SNumber::kFloatMaxCharCount];
+
 	// Start
-	data.append("{", 1);
+	dataBuilder.append("{", 1);
 
 	// Iterate dictionary
 	for (CDictionary::Iterator iterator = dictionary.getIterator(); iterator; iterator++) {
 		// Check if first
 		if (!iterator.isFirst())
 			// Add comma
-			data.append(",", 1);
+			dataBuilder.append(",", 1);
 
 		// Add key
-		sAddString(data, iterator.getKey());
+		sAddString(dataBuilder, iterator.getKey());
 
 		// Add colon
-		data.append(":", 1);
+		dataBuilder.append(":", 1);
 
 		// Add value
 		OV<SError>	error;
 		switch (iterator.getValue().getType()) {
 			case SValue::kTypeEmpty:
 				// Empty (null)
-				data.append("null", 4);
+				dataBuilder.append("null", 4);
 				break;
 
 			case SValue::kTypeArrayOfDictionaries:
 				// Array of dictionaries
-				error = sAddArrayOfDictionaries(data, iterator.getValue().getArrayOfDictionaries());
+				error = sAddArrayOfDictionaries(dataBuilder, iterator.getValue().getArrayOfDictionaries());
 				ReturnErrorIfError(error);
 				break;
 
 			case SValue::kTypeArrayOfStrings:
 				// Array of strings
-				error = sAddArrayOfStrings(data, iterator.getValue().getArrayOfStrings());
+				error = sAddArrayOfStrings(dataBuilder, iterator.getValue().getArrayOfStrings());
 				ReturnErrorIfError(error);
 				break;
 
@@ -179,71 +188,71 @@ OV<SError> sAddDictionary(CData& data, const CDictionary& dictionary)
 				// Add bool
 				if (iterator.getValue().getBool())
 					// True
-					data.append("true", 4);
+					dataBuilder.append("true", 4);
 				else
 					// False
-					data.append("false", 5);
+					dataBuilder.append("false", 5);
 				break;
 
 			case SValue::kTypeDictionary:
 				// Add dictionary
-				error = sAddDictionary(data, iterator.getValue().getDictionary());
+				error = sAddDictionary(dataBuilder, iterator.getValue().getDictionary());
 				ReturnErrorIfError(error);
 				break;
 
 			case SValue::kTypeString:
 				// String
-				sAddString(data, iterator.getValue().getString());
+				sAddString(dataBuilder, iterator.getValue().getString());
 				break;
 
 			case SValue::kTypeFloat32:
 				// Float32
-				data += CString(iterator.getValue().getFloat32()).getUTF8Data();
+				dataBuilder.append(chars, SNumber::getChars(iterator.getValue().getFloat32(), chars));
 				break;
 
 			case SValue::kTypeFloat64:
 				// Float64
-				data += CString(iterator.getValue().getFloat64()).getUTF8Data();
+				dataBuilder.append(chars, SNumber::getChars(iterator.getValue().getFloat64(), chars));
 				break;
 
 			case SValue::kTypeSInt8:
 				// SInt8
-				data += CString(iterator.getValue().getSInt8()).getUTF8Data();
+				dataBuilder.append(chars, SNumber::getChars((SInt64) iterator.getValue().getSInt8(), chars));
 				break;
 
 			case SValue::kTypeSInt16:
 				// SInt16
-				data += CString(iterator.getValue().getSInt16()).getUTF8Data();
+				dataBuilder.append(chars, SNumber::getChars((SInt64) iterator.getValue().getSInt16(), chars));
 				break;
 
 			case SValue::kTypeSInt32:
 				// SInt32
-				data += CString(iterator.getValue().getSInt32()).getUTF8Data();
+				dataBuilder.append(chars, SNumber::getChars((SInt64) iterator.getValue().getSInt32(), chars));
 				break;
 
 			case SValue::kTypeSInt64:
 				// SInt64
-				data += CString(iterator.getValue().getSInt64()).getUTF8Data();
+				dataBuilder.append(chars, SNumber::getChars((SInt64) iterator.getValue().getSInt64(), chars));
 				break;
 
 			case SValue::kTypeUInt8:
 				// UInt8
-				data += CString(iterator.getValue().getUInt8()).getUTF8Data();
+				dataBuilder.append(chars, SNumber::getChars((UInt64) iterator.getValue().getUInt8(), chars));
 				break;
 
 			case SValue::kTypeUInt16:
 				// UInt16
-				data += CString(iterator.getValue().getUInt16()).getUTF8Data();
+				dataBuilder.append(chars, SNumber::getChars((UInt64) iterator.getValue().getUInt16(), chars));
 				break;
 
 			case SValue::kTypeUInt32:
 				// UInt32
-				data += CString(iterator.getValue().getUInt32()).getUTF8Data();
+				dataBuilder.append(chars, SNumber::getChars((UInt64) iterator.getValue().getUInt32(), chars));
 				break;
 
 			case SValue::kTypeUInt64:
 				// UInt64
-				data += CString(iterator.getValue().getUInt64()).getUTF8Data();
+				dataBuilder.append(chars, SNumber::getChars((UInt64) iterator.getValue().getUInt64(), chars));
 				break;
 
 			case SValue::kTypeData:
@@ -254,17 +263,17 @@ OV<SError> sAddDictionary(CData& data, const CDictionary& dictionary)
 	}
 
 	// End
-	data.append("}", 1);
+	dataBuilder.append("}", 1);
 
 	return OV<SError>();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-void sAddString(CData& data, const CString& string)
+void sAddString(CData::Builder& dataBuilder, const CString& string)
 //----------------------------------------------------------------------------------------------------------------------
 {
-	data.append("\"", 1);
-	data +=
+	dataBuilder.append("\"", 1);
+	dataBuilder.append(
 			string
 					.replacingSubStrings(CString(OSSTR("\\")), CString(OSSTR("\\\\")))
 					.replacingSubStrings(CString(OSSTR("\t")), CString(OSSTR("\\t")))
@@ -274,12 +283,12 @@ void sAddString(CData& data, const CString& string)
 					.replacingSubStrings(CString(OSSTR("\b")), CString(OSSTR("\\b")))
 					.replacingSubStrings(CString(OSSTR("/")), CString(OSSTR("\\/")))
 					.replacingSubStrings(CString(OSSTR("\"")), CString(OSSTR("\\\"")))
-					.getUTF8Data();
-	data.append("\"", 1);
+					.getUTF8Data());
+	dataBuilder.append("\"", 1);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-TVResult<TArray<CDictionary> > sReadArrayOfDictionaries(const SInt8*& charPtr)
+TVResult<TArray<CDictionary> > sReadArrayOfDictionaries(const SInt8*& charPtr, CSlabAllocator::Arena& arena)
 //----------------------------------------------------------------------------------------------------------------------
 {
 	// Validate start token
@@ -290,9 +299,9 @@ TVResult<TArray<CDictionary> > sReadArrayOfDictionaries(const SInt8*& charPtr)
 	TNArray<CDictionary>	array;
 	while (true) {
 		// Read dictionary
-		TVResult<CDictionary>	result = sReadDictionary(charPtr);
+		TVResult<CDictionary>	result = sReadDictionary(charPtr, arena);
 		ReturnValueIfResultError(result, TVResult<TArray<CDictionary> >(result.getError()));
-		array += *result;
+		array += std::move(*result);
 
 		// Skip whitespace
 		sSkipWhitespace(charPtr);
@@ -311,7 +320,7 @@ TVResult<TArray<CDictionary> > sReadArrayOfDictionaries(const SInt8*& charPtr)
 			// Skip whitespace
 			sSkipWhitespace(charPtr);
 
-			return TVResult<TArray<CDictionary> >(array);
+			return TVResult<TArray<CDictionary> >(std::move(array));
 		} else
 			// Invalid token
 			return TVResult<TArray<CDictionary> >(sInvalidTokenError);
@@ -319,7 +328,7 @@ TVResult<TArray<CDictionary> > sReadArrayOfDictionaries(const SInt8*& charPtr)
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-TVResult<CDictionary> sReadDictionary(const SInt8*& charPtr)
+TVResult<CDictionary> sReadDictionary(const SInt8*& charPtr, CSlabAllocator::Arena& arena)
 //----------------------------------------------------------------------------------------------------------------------
 {
 	// Validate start token
@@ -335,7 +344,7 @@ TVResult<CDictionary> sReadDictionary(const SInt8*& charPtr)
 		// Inspect token
 		if (*charPtr == '\"') {
 			// Read key
-			TVResult<CString>	keyResult = sReadString(charPtr);
+			TVResult<CString>	keyResult = sReadString(charPtr, arena);
 			ReturnValueIfResultError(keyResult, TVResult<CDictionary>(keyResult.getError()));
 
 			// Skip whitespace
@@ -346,13 +355,13 @@ TVResult<CDictionary> sReadDictionary(const SInt8*& charPtr)
 			ReturnValueIfError(error, TVResult<CDictionary>(*error));
 
 			// Read value
-			TVResult<SValue>	valueResult = sReadValue(charPtr);
+			TVResult<SValue>	valueResult = sReadValue(charPtr, arena);
 			ReturnValueIfResultError(valueResult, TVResult<CDictionary>(valueResult.getError()));
 
 			// Check if got value
 			if (valueResult.hasValue())
 				// Store
-				dictionary.set(*keyResult, *valueResult);
+				dictionary.set(*keyResult, std::move(*valueResult));
 
 			// Skip whitespace
 			sSkipWhitespace(charPtr);
@@ -370,7 +379,7 @@ TVResult<CDictionary> sReadDictionary(const SInt8*& charPtr)
 			// End
 			charPtr++;
 
-			return TVResult<CDictionary>(dictionary);
+			return TVResult<CDictionary>(std::move(dictionary));
 		} else
 			// Invalid token
 			return TVResult<CDictionary>(sInvalidTokenError);
@@ -378,7 +387,37 @@ TVResult<CDictionary> sReadDictionary(const SInt8*& charPtr)
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-TVResult<CString> sReadString(const SInt8*& charPtr)
+TVResult<SValue> sReadNumber(const char* charPtr, const char* endCharPtr, bool isFloat)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Check if integer
+	if (!isFloat) {
+		// Try SInt64
+		const	char*	sInt64CharPtr = charPtr;
+				SInt64	sInt64;
+		if (SNumber::getSInt64(sInt64CharPtr, endCharPtr, sInt64) && (sInt64CharPtr == endCharPtr))
+			// SInt64
+			return TVResult<SValue>(SValue(sInt64));
+
+		// Try UInt64 for values past the SInt64 range
+		const	char*	uInt64CharPtr = charPtr;
+				UInt64	uInt64;
+		if (SNumber::getUInt64(uInt64CharPtr, endCharPtr, uInt64) && (uInt64CharPtr == endCharPtr))
+			// UInt64
+			return TVResult<SValue>(SValue(uInt64));
+	}
+
+	// Try Float64
+	Float64	float64;
+	if (SNumber::getFloat64(charPtr, endCharPtr, float64) && (charPtr == endCharPtr))
+		// Float64
+		return TVResult<SValue>(SValue(float64));
+
+	return TVResult<SValue>(sInvalidTokenError);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+TVResult<CString> sReadString(const SInt8*& charPtr, CSlabAllocator::Arena& arena)
 //----------------------------------------------------------------------------------------------------------------------
 {
 	// Validate opening "
@@ -387,33 +426,58 @@ TVResult<CString> sReadString(const SInt8*& charPtr)
 
 	// Scan looking for closing "
 	const	SInt8*	startCharPtr = charPtr;
-	while (true) {
+			bool	hasEscapes = false;
+	while (*charPtr != '\"') {
 		// Check character
-		if ((*charPtr == '\\') && (*(charPtr + 1) == '\"'))
-			// Not the quotes we're looking for
+		if (*charPtr == '\\') {
+			// Escape, so the next character can't be the quote we're looking for
+			hasEscapes = true;
 			charPtr += 2;
-		else if (*charPtr == '\"') {
-			// End quote
-			charPtr++;
-
-			return TVResult<CString>(
-					CString((const void*) startCharPtr, (UInt32) (charPtr - startCharPtr - 1), CString::kEncodingUTF8)
-							.replacingSubStrings(CString(OSSTR("\\\"")), CString(OSSTR("\"")))
-							.replacingSubStrings(CString(OSSTR("\\/")), CString(OSSTR("/")))
-							.replacingSubStrings(CString(OSSTR("\\b")), CString(OSSTR("\b")))
-							.replacingSubStrings(CString(OSSTR("\\f")), CString(OSSTR("\f")))
-							.replacingSubStrings(CString(OSSTR("\\n")), CString(OSSTR("\n")))
-							.replacingSubStrings(CString(OSSTR("\\r")), CString(OSSTR("\r")))
-							.replacingSubStrings(CString(OSSTR("\\t")), CString(OSSTR("\t")))
-							.replacingSubStrings(CString(OSSTR("\\\\")), CString(OSSTR("\\"))));
 		} else
 			// One more char
 			charPtr++;
 	}
+	UInt32	byteCount = (UInt32) (charPtr - startCharPtr);
+	charPtr++;
+
+	// Check if have escapes
+	if (!hasEscapes)
+		// Use as is
+		return TVResult<CString>(CString((const void*) startCharPtr, byteCount, CString::kEncodingUTF8));
+
+	// Unescape in one pass into scratch space from the arena
+	char*	bytePtr = (char*) arena.allocate(byteCount);
+	UInt32	unescapedByteCount = 0;
+	for (const SInt8* escapedCharPtr = startCharPtr; escapedCharPtr < charPtr - 1; escapedCharPtr++) {
+		// Check character
+		if ((*escapedCharPtr == '\\') && (escapedCharPtr + 1 < charPtr - 1)) {
+			// Escape
+			char	escapedChar = *(++escapedCharPtr);
+			switch (escapedChar) {
+				case '\"':
+				case '/':
+				case '\\':	bytePtr[unescapedByteCount++] = escapedChar;	break;
+				case 'b':	bytePtr[unescapedByteCount++] = '\b';			break;
+				case 'f':	bytePtr[unescapedByteCount++] = '\f';			break;
+				case 'n':	bytePtr[unescapedByteCount++] = '\n';			break;
+				case 'r':	bytePtr[unescapedByteCount++] = '\r';			break;
+				case 't':	bytePtr[unescapedByteCount++] = '\t';			break;
+				default:
+					// Keep as is
+					bytePtr[unescapedByteCount++] = '\\';
+					bytePtr[unescapedByteCount++] = escapedChar;
+					break;
+			}
+		} else
+			// Copy
+			bytePtr[unescapedByteCount++] = *escapedCharPtr;
+	}
+
+	return TVResult<CString>(CString((const void*) bytePtr, unescapedByteCount, CString::kEncodingUTF8));
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-TVResult<SValue> sReadValue(const SInt8*& charPtr)
+TVResult<SValue> sReadValue(const SInt8*& charPtr, CSlabAllocator::Arena& arena)
 //----------------------------------------------------------------------------------------------------------------------
 {
 	// Skip whitespace
@@ -422,22 +486,22 @@ TVResult<SValue> sReadValue(const SInt8*& charPtr)
 	// Check token
 	if (*charPtr == '\"') {
 		// String
-		TVResult<CString>	result = sReadString(charPtr);
+		TVResult<CString>	result = sReadString(charPtr, arena);
 		ReturnValueIfResultError(result, TVResult<SValue>(result.getError()));
 
 		// Skip whitespace
 		sSkipWhitespace(charPtr);
 
-		return TVResult<SValue>(SValue(*result));
+		return TVResult<SValue>(SValue(std::move(*result)));
 	} else if (*charPtr == '{') {
 		// Dictionary
-		TVResult<CDictionary>	result = sReadDictionary(charPtr);
+		TVResult<CDictionary>	result = sReadDictionary(charPtr, arena);
 		ReturnValueIfResultError(result, TVResult<SValue>(result.getError()));
 
 		// Skip whitespace
 		sSkipWhitespace(charPtr);
 
-		return TVResult<SValue>(SValue(*result));
+		return TVResult<SValue>(SValue(std::move(*result)));
 	} else if (*charPtr == '[') {
 		// Array
 		charPtr++;
@@ -447,18 +511,18 @@ TVResult<SValue> sReadValue(const SInt8*& charPtr)
 
 		if (*charPtr == '{') {
 			// Array of dictionaries
-			TVResult<TArray<CDictionary> >	result = sReadArrayOfDictionaries(charPtr);
+			TVResult<TArray<CDictionary> >	result = sReadArrayOfDictionaries(charPtr, arena);
 			ReturnValueIfResultError(result, TVResult<SValue>(result.getError()));
 
-			return TVResult<SValue>(SValue(*result));
+			return TVResult<SValue>(SValue(std::move(*result)));
 		} else if (*charPtr == '\"') {
 			// Array of strings
 			TNArray<CString>	array;
 			while (true) {
 				// Read string
-				TVResult<CString>	result = sReadString(charPtr);
+				TVResult<CString>	result = sReadString(charPtr, arena);
 				ReturnValueIfResultError(result, TVResult<SValue>(result.getError()));
-				array += *result;
+				array += std::move(*result);
 
 				// Skip whitespace
 				sSkipWhitespace(charPtr);
@@ -477,7 +541,7 @@ TVResult<SValue> sReadValue(const SInt8*& charPtr)
 					// Skip whitespace
 					sSkipWhitespace(charPtr);
 
-					return TVResult<SValue>(SValue(array));
+					return TVResult<SValue>(SValue(std::move(array)));
 				} else
 					// Invalid token
 					return TVResult<SValue>(sInvalidTokenError);
@@ -524,17 +588,15 @@ TVResult<SValue> sReadValue(const SInt8*& charPtr)
 		while ((*charPtr != '}') && (*charPtr != ',') && (*charPtr != ']') &&
 				(*charPtr != ' ') && (*charPtr != '\t') && (*charPtr != '\n') && (*charPtr != '\r')) {
 			// Still in number
-			isFloat |= (*charPtr == '.');
+			isFloat |= (*charPtr == '.') || (*charPtr == 'e') || (*charPtr == 'E');
 			charPtr++;
 		}
 
 		// Skip whitespace
+		const	SInt8*	endCharPtr = charPtr;
 		sSkipWhitespace(charPtr);
 
-		// Compose string
-		CString	string((const void*) startCharPtr, (UInt32) (charPtr - startCharPtr), CString::kEncodingUTF8);
-
-		return TVResult<SValue>(isFloat ? SValue(string.getFloat64()) : SValue(string.getSInt64()));
+		return sReadNumber((const char*) startCharPtr, (const char*) endCharPtr, isFloat);
 	}
 }
 
@@ -0,0 +1,138 @@
+//----------------------------------------------------------------------------------------------------------------------
+//	CWorkItemQueueTests.cpp			©2026 Stevo Brock	All rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+//	Standalone checks for CWorkItemQueue.  Build optimized together with the Base and Concurrency sources and the
+//		platform Add On sources, with Source/Base, Source/Concurrency, the platform Add On folders and
+//		"Source/Add On - Hash/xxHash" on the include path.
+//	Exits with 0 when all checks pass.
+//----------------------------------------------------------------------------------------------------------------------
+
+#include "CWorkItemQueue.h"
+
+#include <stdio.h>
+
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: Local data
+
+static	const	UInt32				kSerialWorkItemsCount = 10000;
+static	const	UInt32				kDeletedQueueWorkItemsCount = 1000;
+
+static			std::atomic<UInt32>	sActiveCount(0);
+static			std::atomic<UInt32>	sOverlapsCount(0);
+static			std::atomic<UInt32>	sFinishedCount(0);
+static			std::atomic<UInt32>	sPerformedCount(0);
+static			std::atomic<bool>	sCanFinishSlowWorkItem(false);
+static			std::atomic<bool>	sDidPerformDependent(false);
+
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - Local proc definitions
+
+//----------------------------------------------------------------------------------------------------------------------
+static void sSerialProc(void* userData)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Unused
+	(void) userData;
+
+	// Note if another Work Item is running at the same time
+	if (++sActiveCount > 1)
+		// Overlap
+		sOverlapsCount++;
+
+	// Do a little work so any overlap has a chance to show
+	for (volatile UInt32 i = 0; i < 2000; i++) ;
+
+	// Done
+	sActiveCount--;
+	sFinishedCount++;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+static void sCountProc(void* userData)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Unused
+	(void) userData;
+
+	// Do a little work so some Work Items are still scheduled when the queue is deleted
+	for (volatile UInt32 i = 0; i < 2000; i++) ;
+
+	// Done
+	sPerformedCount++;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+static void sSlowProc(const I<CWorkItem>& workItem, void* userData)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Unused
+	(void) workItem;
+	(void) userData;
+
+	// Keep the dependent pending until told to finish
+	while (!sCanFinishSlowWorkItem) ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+static void sDependentProc(const I<CWorkItem>& workItem, void* userData)
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Unused
+	(void) workItem;
+	(void) userData;
+
+	// Note
+	sDidPerformDependent = true;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// MARK: - Main
+
+//----------------------------------------------------------------------------------------------------------------------
+int main()
+//----------------------------------------------------------------------------------------------------------------------
+{
+	// Work-stealing mode must be selected before any Work Items are added
+	CWorkItemQueue::setSchedulerMode(CWorkItemQueue::kSchedulerModeWorkStealing);
+
+	// A serial queue below main must never run two Work Items at once, even when the waiting thread helps run them
+	CWorkItemQueue	serialWorkItemQueue(CWorkItemQueue::main(), OR<CItemsProgress>(), 1);
+	for (UInt32 i = 0; i < kSerialWorkItemsCount; i++)
+		// Submit
+		serialWorkItemQueue.submit(sSerialProc, nil);
+	serialWorkItemQueue.wait();
+
+	// Check results
+	bool	serialPassed = (sFinishedCount == kSerialWorkItemsCount) && (sOverlapsCount == 0);
+	::printf("Serial queue in work-stealing mode: %u finished, %u overlaps - %s\n", (UInt32) sFinishedCount,
+			(UInt32) sOverlapsCount, serialPassed ? "passed" : "FAILED");
+
+	// Deleting a queue right after cancelling must not free Work Items the pool threads still hold
+	CWorkItemQueue*	workItemQueue = new CWorkItemQueue(CWorkItemQueue::main());
+	for (UInt32 i = 0; i < kDeletedQueueWorkItemsCount; i++)
+		// Submit
+		workItemQueue->submit(sCountProc, nil);
+	workItemQueue->cancelAll();
+	Delete(workItemQueue);
+	UInt32	performedCount = sPerformedCount;
+
+	// Nothing may be performed once the queue is gone and main must still be usable
+	CWorkItemQueue::main().wait();
+	bool	deletedQueuePassed = sPerformedCount == performedCount;
+	::printf("Queue deleted after cancelAll(): %u of %u performed - %s\n", performedCount,
+			kDeletedQueueWorkItemsCount, deletedQueuePassed ? "passed" : "FAILED");
+
+	// Deleting a queue with a Work Item still waiting on a dependency must drop it once the dependency finishes
+	I<CWorkItem>	slowWorkItem = CWorkItemQueue::main().add(sSlowProc, nil);
+	workItemQueue = new CWorkItemQueue(CWorkItemQueue::main());
+	workItemQueue->then(slowWorkItem, sDependentProc, nil);
+	Delete(workItemQueue);
+	sCanFinishSlowWorkItem = true;
+	CWorkItemQueue::waitUntilFinished(slowWorkItem);
+	CWorkItemQueue::main().wait();
+	bool	pendingPassed = !sDidPerformDependent;
+	::printf("Queue deleted with a pending Work Item: %s - %s\n",
+			sDidPerformDependent ? "performed" : "dropped", pendingPassed ? "passed" : "FAILED");
+
+	return (serialPassed && deletedQueuePassed && pendingPassed) ? 0 : 1;
+}